@@ -0,0 +1,166 @@
+#pragma once
+
+/* This file is generated by CMake */
+
+/* stdio.h */
+#define YUNI_HAS_STDIO_H
+
+/* string.h - memcmp, memcmpy... */
+#define YUNI_HAS_STRING_H
+
+/* time.h */
+#define YUNI_HAS_TIME_H
+
+/* assert.h */
+#define YUNI_HAS_ASSERT_H
+
+/* errno.h */
+#define YUNI_HAS_ERRNO_H
+
+/* cstddef */
+#define YUNI_HAS_CSTDDEF
+
+/* dirent.h */
+#define YUNI_HAS_DIRENT_H
+
+/* stdlib.h */
+#define YUNI_HAS_STDLIB_H
+
+/* unistd.h */
+#define YUNI_HAS_UNISTD_H
+
+/* fcntl.h */
+#define YUNI_HAS_FCNTL_H
+
+/* cstdlib */
+/* #undef YUNI_HAS_CSTDLIB */
+
+/* stdarg.h */
+#define YUNI_HAS_STDARG_H
+
+/* va_copy */
+#define YUNI_HAS_VA_COPY
+
+/* sys/sendfile.h */
+#define YUNI_HAS_SYS_SENDFILE_H
+
+
+
+
+/* sys/types.h */
+#define YUNI_HAS_SYS_TYPES_H
+
+/* winsock2.h */
+/* #undef YUNI_HAS_WINSOCK_2 */
+
+/* ShellApi.h */
+/* #undef YUNI_HAS_SHELLAPI_H */
+
+/* climits */
+#define YUNI_HAS_CLIMITS
+
+/* vector */
+#define YUNI_HAS_VECTOR
+
+/* list */
+#define YUNI_HAS_LIST
+
+/* map */
+#define YUNI_HAS_MAP
+
+/* algorithm */
+#define YUNI_HAS_ALGORITHM
+
+/* cassert */
+#define YUNI_HAS_CASSERT
+
+
+
+
+
+
+/* C++0x support by gcc (-std=c++0x) */
+#define YUNI_HAS_GCC_CPP0X_SUPPORT
+
+/* GCC __builtin_expect */
+#define YUNI_HAS_GCC_BUILTIN_EXPECT
+
+/* GCC __builtin_popcount */
+#define YUNI_HAS_GCC_BUILTIN_POPCOUNT
+
+/* long types - different from int */
+/* #undef YUNI_HAS_LONG */
+
+/* int64_t, from stdint.h */
+#define YUNI_HAS_INT64_T
+
+/* int128_t, from stdint.h */
+#define YUNI_HAS_INT128_T
+
+/* uint */
+#define YUNI_HAS_UINT
+
+/* ssize_t */
+#define YUNI_HAS_SSIZE_T
+
+
+
+/* pthread pthread_getthreadid_np */
+/* #undef YUNI_HAS_PTHREAD_GETTHREADID_NP */
+
+/* pthread pthread_attr_setstacksize */
+#define YUNI_HAS_PTHREAD_ATTR_SETSTACKSIZE
+
+
+
+
+
+/* C++0x support: nullptr (GCC: only >= 4.6 with -std=gnu++0x, VS: only >= 10) */
+#define YUNI_HAS_NULLPTR
+
+/* gcc __sync_add_and_fetch */
+#define YUNI_HAS_SYNC_ADD_AND_FETCH
+
+/* C++11 constexpr */
+/* #undef YUNI_HAS_CONSTEXPR */
+
+/* C++11 std::hash */
+#define YUNI_HAS_STL_HASH
+
+/* C++11 std::unordered_map */
+#define YUNI_HAS_STL_UNORDERED_MAP
+
+/* C++11 std::unordered_set */
+#define YUNI_HAS_STL_UNORDERED_SET
+
+/* C++ gcc always inline */
+#define YUNI_HAS_GCC_ALWAYS_INLINE
+
+/* C++ msvc force inline */
+/* #undef YUNI_HAS_MSVC_FORCE_INLINE */
+
+/* C++ gcc attribute 'pure' */
+#define YUNI_HAS_GCC_ATTR_PURE
+
+/* C++ gcc attribute 'const' */
+#define YUNI_HAS_GCC_ATTR_CONST
+
+/* C++11 keyword override */
+#define YUNI_HAS_CPP_KEYWORD_OVERRIDE
+
+/* C++11 keyword final */
+#define YUNI_HAS_CPP_KEYWORD_FINAL
+
+/* C++11 move operator */
+#define YUNI_HAS_CPP_MOVE
+
+/* C++11 lambda */
+#define YUNI_HAS_CPP_LAMBDA
+
+/* C++11 static_assert */
+#define YUNI_HAS_CPP_STATIC_ASSERT
+
+/* lambda for Yuni::Bind / Yuni::Event */
+#if defined(YUNI_HAS_CPP_MOVE) && defined(YUNI_HAS_CPP_LAMBDA)
+# define YUNI_HAS_CPP_BIND_LAMBDA
+# endif
@@ -33,7 +33,6 @@ class Matrix;
 namespace Antares
 {
 // Forward declarations
-const char* get_format(bool isDecimal, uint precision);
 template<class T, class ReadWriteT, class PredicateT>
 class I_mtx_to_buffer_dumper;
 
@@ -63,24 +62,21 @@ public:
                            PredicateT& predicate):
         mtx_(mtx),
         buffer_(data),
-        predicate_(predicate),
-        format_(nullptr)
+        predicate_(predicate)
     {
     }
 
+    virtual ~I_mtx_to_buffer_dumper() = default;
+
+    //! Number of decimals of the values (only used for decimal types)
     void set_print_format(bool isDecimal, uint precision);
     virtual void run() = 0;
 
-    ~I_mtx_to_buffer_dumper()
-    {
-        delete format_;
-    }
-
 protected:
     const Matrix<T, ReadWriteT>* mtx_;
     std::string& buffer_;
     PredicateT& predicate_;
-    const char* format_;
+    uint precision_ = 0;
 };
 
 template<class T, class ReadWriteT, class PredicateT>
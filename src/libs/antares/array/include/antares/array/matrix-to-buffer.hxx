@@ -22,30 +22,35 @@
 #ifndef __ANTARES_LIBS_ARRAY_MATRIX_TO_BUFFER_SENDER_HXX__
 #define __ANTARES_LIBS_ARRAY_MATRIX_TO_BUFFER_SENDER_HXX__
 
-#ifdef YUNI_OS_MSVC
-#define ANTARES_MATRIX_SNPRINTF sprintf_s
-#else
-#define ANTARES_MATRIX_SNPRINTF snprintf
-#endif
+#include <memory>
+#include <type_traits>
 
+#include <antares/utils/number_format.h>
 #include <antares/utils/utils.h>
 
 namespace Antares
 {
 namespace // anonymous
 {
+using MatrixNumberWriter = Utils::NumberWriter<std::string>;
+
 template<class T>
 struct MatrixScalar
 {
-    static inline void Append(std::string& file, T v, const char* const)
+    static inline void Append(MatrixNumberWriter& writer, T v, uint)
     {
         if (Utils::isZero(v))
         {
-            file.append(std::to_string(0));
+            writer.put('0');
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            writer.integer(v);
         }
         else
         {
-            file.append(std::to_string(v));
+            const std::string text = std::to_string(v);
+            writer.put(text.c_str(), text.size());
         }
     }
 };
@@ -53,33 +58,15 @@ struct MatrixScalar
 template<>
 struct MatrixScalar<double>
 {
-    static void Append(std::string& file, double v, const char* const format)
+    static void Append(MatrixNumberWriter& writer, double v, uint precision)
     {
         if (Utils::isZero(v))
         {
-            file += '0';
+            writer.put('0');
         }
         else
         {
-            char ConversionBuffer[128];
-            const int sizePrintf = Utils::isZero(v - floor(v))
-                                     ? ANTARES_MATRIX_SNPRINTF(ConversionBuffer,
-                                                               sizeof(ConversionBuffer),
-                                                               "%.0f",
-                                                               v)
-                                     : ANTARES_MATRIX_SNPRINTF(ConversionBuffer,
-                                                               sizeof(ConversionBuffer),
-                                                               format,
-                                                               v);
-
-            if (sizePrintf >= 0 and sizePrintf < (int)(sizeof(ConversionBuffer)))
-            {
-                file += (const char*)ConversionBuffer;
-            }
-            else
-            {
-                file += "ERR";
-            }
+            writer.fixed(v, Utils::isZero(v - floor(v)) ? 0 : precision);
         }
     }
 };
@@ -87,34 +74,9 @@ struct MatrixScalar<double>
 template<>
 struct MatrixScalar<float>
 {
-    static void Append(std::string& file, float v, const char* const format)
+    static void Append(MatrixNumberWriter& writer, float v, uint precision)
     {
-        if (Utils::isZero(v))
-        {
-            file += '0';
-        }
-        else
-        {
-            char ConversionBuffer[128];
-            const int sizePrintf = Utils::isZero(v - floor(v))
-                                     ? ANTARES_MATRIX_SNPRINTF(ConversionBuffer,
-                                                               sizeof(ConversionBuffer),
-                                                               "%.0f",
-                                                               (double)v)
-                                     : ANTARES_MATRIX_SNPRINTF(ConversionBuffer,
-                                                               sizeof(ConversionBuffer),
-                                                               format,
-                                                               (double)v);
-
-            if (sizePrintf >= 0 and sizePrintf < (int)(sizeof(ConversionBuffer)))
-            {
-                file += (const char*)ConversionBuffer;
-            }
-            else
-            {
-                file += "ERR";
-            }
-        }
+        MatrixScalar<double>::Append(writer, (double)v, precision);
     }
 };
 
@@ -140,69 +102,44 @@ template<class T, class ReadWriteT, class PredicateT>
 void I_mtx_to_buffer_dumper<T, ReadWriteT, PredicateT>::set_print_format(bool isDecimal,
                                                                          uint precision)
 {
-    // Determining the string format to use according the given precision
-    format_ = "%.0f";
-
-    if (isDecimal and precision)
-    {
-        const char* const sfmt[] = {
-          "%.0f",
-          "%.1f",
-          "%.2f",
-          "%.3f",
-          "%.4f",
-          "%.5f",
-          "%.6f",
-          "%.7f",
-          "%.8f",
-          "%.9f",
-          "%.10f",
-          "%.11f",
-          "%.12f",
-          "%.13f",
-          "%.14f",
-          "%.15f",
-          "%.16f",
-        };
-        assert(precision <= 16);
-        format_ = sfmt[precision];
-    }
+    assert(precision <= Utils::maxFixedPrecision);
+    precision_ = isDecimal ? precision : 0;
 }
 
 template<class T, class ReadWriteT, class PredicateT>
 void one_column__dumper<T, ReadWriteT, PredicateT>::run()
 {
+    MatrixNumberWriter writer(this->buffer_);
     for (uint y = 0; y != (this->mtx_)->height; ++y)
     {
-        MatrixScalar<ReadWriteT>::Append(this->buffer_,
+        MatrixScalar<ReadWriteT>::Append(writer,
                                          (ReadWriteT)this->predicate_((this->mtx_)->entry[0][y]),
-                                         this->format_);
-        this->buffer_ += '\n';
+                                         this->precision_);
+        writer.put('\n');
     }
 }
 
 template<class T, class ReadWriteT, class PredicateT>
 void multiple_columns__dumper<T, ReadWriteT, PredicateT>::run()
 {
+    MatrixNumberWriter writer(this->buffer_);
     for (uint y = 0; y < (this->mtx_)->height; ++y)
     {
-        MatrixScalar<ReadWriteT>::Append(this->buffer_,
+        MatrixScalar<ReadWriteT>::Append(writer,
                                          (ReadWriteT)this->predicate_((this->mtx_)->entry[0][y]),
-                                         this->format_);
+                                         this->precision_);
         for (uint x = 1; x < (this->mtx_)->width; ++x)
         {
-            this->buffer_ += '\t';
-            MatrixScalar<ReadWriteT>::Append(this->buffer_,
+            writer.put('\t');
+            MatrixScalar<ReadWriteT>::Append(writer,
                                              (ReadWriteT)this->predicate_(
                                                (this->mtx_)->entry[x][y]),
-                                             this->format_);
+                                             this->precision_);
         }
-        this->buffer_ += '\n';
+        writer.put('\n');
     }
 }
 
 } // namespace Antares
 
-#undef ANTARES_MATRIX_SNPRINTF
-
 #endif // __ANTARES_LIBS_ARRAY_MATRIX_TO_BUFFER_SENDER_HXX__
@@ -23,6 +23,7 @@
 
 #include <cassert>
 #include <set>
+#include <vector>
 
 #include <yuni/yuni.h>
 #include <yuni/io/file.h>
@@ -175,6 +176,32 @@ public:
 
     bool loadFromCSVFile(const AnyString& filename);
 
+    /*!
+    ** \brief Load some columns of a CSV file
+    **
+    ** The matrix gets the width of the file as loadFromCSVFile() would, but only the given
+    ** columns are read, the other ones being released (see releaseColumn()).
+    **
+    ** \param filename A filename to a CSV file
+    ** \param columns The columns to read (those beyond its size are not read)
+    ** \param minWidth The minimum allowed width
+    ** \param maxHeight The new height
+    ** \param buffer An optional buffer for reading the file
+    ** \return True if the operation succeeded
+    */
+    bool loadColumnsFromCSVFile(const AnyString& filename,
+                                const std::vector<bool>& columns,
+                                uint minWidth,
+                                uint maxHeight,
+                                BufferType* buffer = NULL);
+
+    /*!
+    ** \brief Get the number of columns of a CSV file, from its first line only
+    **
+    ** \return The number of columns, 0 if the first line can not be read or holds a header
+    */
+    static uint CSVFileWidth(const AnyString& filename);
+
     /*!
     ** \brief Trying to open a file
     **
@@ -247,6 +274,13 @@ public:
     */
     void resize(uint w, uint h, bool fixedSize = false);
 
+    /*!
+    ** \brief Resize the matrix without allocating any column
+    **
+    ** All the columns are released (see releaseColumn()).
+    */
+    void resizeReleased(uint w, uint h);
+
     /*!
     ** \brief Resize the matrix without destroying its content
     */
@@ -399,6 +433,18 @@ public:
     */
     void unloadFromMemory() const;
 
+    /*!
+    ** \brief Release the memory of a column
+    **
+    ** The width of the matrix is kept, but the values of the column must not be accessed
+    ** anymore (its pointer is null). The matrix must not be copied, saved or resized afterwards.
+    ** zero() and multiplyAllEntriesBy() skip the released columns.
+    */
+    void releaseColumn(uint x);
+
+    //! Get if a column was released
+    bool columnReleased(uint x) const;
+
     /*!
     ** \brief Mark the matrix as modified
     **
@@ -481,7 +527,8 @@ private:
                              uint minWidth,
                              uint maxHeight,
                              uint options,
-                             BufferType* buffer = NULL);
+                             BufferType* buffer = NULL,
+                             const std::vector<bool>* columns = nullptr);
 
     //! Initialize the JIT structures and returns true
     bool internalLoadJITData(const AnyString& filename,
@@ -504,7 +551,8 @@ private:
                         uint minWidth,
                         uint maxHeight,
                         const int fixedSize,
-                        uint options);
+                        uint options,
+                        const std::vector<bool>* columns = nullptr);
     /*!
     ** \brief Make sure that all JIT Data are loaded into memory
     */
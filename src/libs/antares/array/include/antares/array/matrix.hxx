@@ -21,8 +21,11 @@
 #ifndef __ANTARES_LIBS_ARRAY_MATRIX_HXX__
 #define __ANTARES_LIBS_ARRAY_MATRIX_HXX__
 
+#include <array>
+#include <charconv>
 #include <cmath>
 #include <cstdlib>
+#include <memory>
 #include <utility>
 
 #include <yuni/yuni.h>
@@ -111,6 +114,15 @@ public:
 public:
     inline static bool Do(const AnyString& str, double& out)
     {
+        // Fast path, without locale: plain decimal numbers, which are nearly all the cells
+        const char* const last = str.c_str() + str.size();
+        auto [ptr, ec] = std::from_chars(str.c_str(), last, out);
+        if (ec == std::errc() and ptr == last)
+        {
+            return true;
+        }
+        // strtod accepts a few more syntaxes (leading '+' or spaces, hexadecimal,
+        // out of range values...). The string must be zero-terminated.
         char* pend;
         out = ::strtod(str.c_str(), &pend);
         return (NULL != pend and '\0' == *pend);
@@ -129,9 +141,11 @@ public:
 public:
     inline static bool Do(const AnyString& str, float& out)
     {
-        char* pend;
-        out = static_cast<float>(::strtod(str.c_str(), &pend));
-        return (NULL != pend and '\0' == *pend);
+        // Read as a double, as strtod used to do, to get the very same values
+        double value;
+        bool ok = MatrixStringConverter<double>::Do(str, value);
+        out = static_cast<float>(value);
+        return ok;
     }
 };
 
@@ -154,6 +168,37 @@ public:
     }
 };
 
+//! Characters ending a cell (see ANTARES_MATRIX_CSV_SEPARATORS)
+constexpr std::array<bool, 256> csvSeparatorTable = []
+{
+    std::array<bool, 256> table{};
+    for (const char* c = ANTARES_MATRIX_CSV_SEPARATORS; *c; ++c)
+    {
+        table[(unsigned char)*c] = true;
+    }
+    return table;
+}();
+
+/*!
+** \brief Same as `data.find_first_of(ANTARES_MATRIX_CSV_SEPARATORS, offset)`
+**
+** A single lookup per character, instead of a comparison against each separator.
+*/
+template<class StringT>
+inline typename StringT::Size FindCSVSeparator(const StringT& data, typename StringT::Size offset)
+{
+    const char* const text = data.c_str();
+    const typename StringT::Size size = data.size();
+    for (; offset < size; ++offset)
+    {
+        if (csvSeparatorTable[(unsigned char)text[offset]])
+        {
+            return offset;
+        }
+    }
+    return StringT::npos;
+}
+
 template<unsigned A, bool B>
 Yuni::CString<A, B> trunc(Yuni::CString<A, B>& str)
 {
@@ -294,8 +339,10 @@ inline void Matrix<T, ReadWriteT>::zero()
 {
     for (uint i = 0; i != width; ++i)
     {
-        ColumnType& column = entry[i];
-        (void)::memset((void*)column, 0, sizeof(T) * height);
+        if (entry[i])
+        {
+            (void)::memset((void*)entry[i], 0, sizeof(T) * height);
+        }
     }
 }
 
@@ -442,6 +489,68 @@ bool Matrix<T, ReadWriteT>::loadFromCSVFile(const AnyString& filename,
     }
 }
 
+template<class T, class ReadWriteT>
+bool Matrix<T, ReadWriteT>::loadColumnsFromCSVFile(const AnyString& filename,
+                                                   const std::vector<bool>& columns,
+                                                   uint minWidth,
+                                                   uint maxHeight,
+                                                   BufferType* buffer)
+{
+    assert(not filename.empty() and "Matrix<>:: loadColumnsFromCSVFile: empty filename");
+    // Never delayed, the released columns could not be loaded later
+    return internalLoadCSVFile(filename, minWidth, maxHeight, optImmediate, buffer, &columns);
+}
+
+template<class T, class ReadWriteT>
+uint Matrix<T, ReadWriteT>::CSVFileWidth(const AnyString& filename)
+{
+    Yuni::IO::File::Stream file;
+    if (not file.open(filename))
+    {
+        return 0;
+    }
+
+    // Same detection as loadFromBuffer(), on the first line only: the separators are counted
+    // until the last character which is not a final trailing whitespace
+    static constexpr char header[] = "size:";
+    static constexpr uint headerSize = sizeof(header) - 1;
+    char chunk[4096];
+    uint position = 0;
+    uint separators = 0;
+    uint pending = 0;
+    bool empty = true;
+    for (uint64_t size; (size = file.read(chunk, sizeof(chunk))) > 0;)
+    {
+        for (uint64_t i = 0; i != size; ++i, ++position)
+        {
+            const char c = chunk[i];
+            if (c == '\n')
+            {
+                return empty ? 0 : separators + 1;
+            }
+            if (position < headerSize and c != header[position])
+            {
+                position = headerSize; // not a header
+            }
+            else if (position + 1 == headerSize)
+            {
+                return 0; // legacy header, read entirely
+            }
+            if (c == '\t' or c == ';' or c == ',')
+            {
+                ++pending;
+            }
+            if (c != '\r' and c != '\t' and c != ' ')
+            {
+                separators += pending;
+                pending = 0;
+                empty = false;
+            }
+        }
+    }
+    return empty ? 0 : separators + 1;
+}
+
 template<class T, class ReadWriteT>
 bool Matrix<T, ReadWriteT>::saveToCSVFile(const AnyString& filename,
                                           uint precision,
@@ -557,6 +666,40 @@ void Matrix<T, ReadWriteT>::clear()
     height = 0;
 }
 
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::releaseColumn(uint x)
+{
+    assert(x < width && "Invalid column index");
+    Antares::Memory::Release(entry[x]);
+}
+
+template<class T, class ReadWriteT>
+inline bool Matrix<T, ReadWriteT>::columnReleased(uint x) const
+{
+    assert(x < width && "Invalid column index");
+    return !entry[x];
+}
+
+template<class T, class ReadWriteT>
+void Matrix<T, ReadWriteT>::resizeReleased(uint w, uint h)
+{
+    assert(w <= 50000 and "The new width seems a bit excessive");
+    assert(h <= 50000 and "The new height seems a bit excessive");
+
+    clear();
+    if (w and h)
+    {
+        width = w;
+        height = h;
+        entry = new typename Antares::Memory::Stored<T>::Type[width + 1];
+        for (uint i = 0; i != width + 1; ++i)
+        {
+            entry[i] = nullptr;
+        }
+    }
+    markAsModified();
+}
+
 template<class T, class ReadWriteT>
 void Matrix<T, ReadWriteT>::reset()
 {
@@ -689,10 +832,29 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
                                            uint minWidth,
                                            uint maxHeight,
                                            const int fixedSize,
-                                           uint options)
+                                           uint options,
+                                           const std::vector<bool>* columns)
 {
     using namespace Yuni;
 
+    // Only the selected columns are allocated when some are given
+    auto resizeToLoad = [this, columns](uint w, uint h)
+    {
+        if (!columns)
+        {
+            resize(w, h);
+            return;
+        }
+        resizeReleased(w, h);
+        for (uint i = 0; i < width and i < columns->size(); ++i)
+        {
+            if ((*columns)[i])
+            {
+                Antares::Memory::Allocate<T>(entry[i], height);
+            }
+        }
+    };
+
 #ifndef NDEBUG
     logs.debug() << "  :: loading `" << filename << "`";
 #endif
@@ -789,7 +951,7 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
                 y = maxHeight;
             }
             maxHeight = y;
-            resize((uint)x, (uint)y);
+            resizeToLoad((uint)x, (uint)y);
         }
         else
         {
@@ -804,7 +966,7 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
                     ++x;
                 }
             }
-            resize(((x < minWidth) ? minWidth : x), maxHeight);
+            resizeToLoad(((x < minWidth) ? minWidth : x), maxHeight);
 #ifndef NDEBUG
 // logs.debug() << "  :: (" << width << 'x' << height << ')';
 #endif
@@ -837,8 +999,7 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
         pos = offset;
         uint lineOffset = (uint)offset;
 
-        while ((offset = data.find_first_of(ANTARES_MATRIX_CSV_SEPARATORS, offset))
-               != BufferType::npos)
+        while ((offset = FindCSVSeparator(data, offset)) != BufferType::npos)
         {
             assert(offset != BufferType::npos);
 
@@ -846,7 +1007,7 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
             // the final zero is mandatory for string-to-double convertions
             data[offset] = '\0';
             // Adding the value
-            converter = (const char*)((const char*)data.c_str() + pos);
+            converter.adapt((const char*)data.c_str() + pos, offset - pos);
 
             // Convert string into double or something else
             if (not converter.empty())
@@ -902,7 +1063,11 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
                     }
                 }
 
-                if (MatrixStringConverter<ReadWriteType>::direct)
+                if (!entry[x])
+                {
+                    // Column not loaded
+                }
+                else if (MatrixStringConverter<ReadWriteType>::direct)
                 {
                     // We can perform a direct copy, instead of using a temporary buffer
                     // for complex conversions
@@ -950,7 +1115,7 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
             else
             {
                 // We may encounter final tabs, which must not be managed as an error
-                if (x < width)
+                if (x < width and entry[x])
                 {
                     MatrixData<T>::Init(entry[x][y]);
                     if (not(options & optQuiet))
@@ -1004,7 +1169,10 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
             }
             while (x < width) // Init for missing entry
             {
-                MatrixData<T>::Init(entry[x][y]);
+                if (entry[x])
+                {
+                    MatrixData<T>::Init(entry[x][y]);
+                }
                 ++x;
             }
         }
@@ -1028,7 +1196,10 @@ bool Matrix<T, ReadWriteT>::loadFromBuffer(const AnyString& filename,
         {
             for (x = 0; x < width; ++x)
             {
-                MatrixData<T>::Init(entry[x][y]);
+                if (entry[x])
+                {
+                    MatrixData<T>::Init(entry[x][y]);
+                }
             }
             ++y;
         }
@@ -1042,7 +1213,8 @@ bool Matrix<T, ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
                                                 uint minWidth,
                                                 uint maxHeight,
                                                 uint options,
-                                                BufferType* buffer)
+                                                BufferType* buffer,
+                                                const std::vector<bool>* columns)
 {
     // Status
     bool result = false;
@@ -1084,7 +1256,8 @@ bool Matrix<T, ReadWriteT>::internalLoadCSVFile(const AnyString& filename,
                                 minWidth,
                                 maxHeight,
                                 (options & optFixedSize),
-                                options);
+                                options,
+                                columns);
 
         // Mark as modified
         if (0 != (options & optMarkAsModified))
@@ -1224,8 +1397,8 @@ void Matrix<T, ReadWriteT>::saveToBuffer(std::string& data,
 
     matrix_to_buffer_dumper_factory mtx_to_buffer_dumper_factory;
 
-    I_mtx_to_buffer_dumper<T, ReadWriteT, PredicateT>* mtx_to_buffer_dpr
-      = mtx_to_buffer_dumper_factory.get_dumper<T, ReadWriteT, PredicateT>(this, data, predicate);
+    std::unique_ptr<I_mtx_to_buffer_dumper<T, ReadWriteT, PredicateT>> mtx_to_buffer_dpr(
+      mtx_to_buffer_dumper_factory.get_dumper<T, ReadWriteT, PredicateT>(this, data, predicate));
 
     // Determining the string format to use according the given precision
     mtx_to_buffer_dpr->set_print_format(isDecimal, precision);
@@ -1413,6 +1586,10 @@ void Matrix<T, ReadWriteT>::multiplyAllEntriesBy(const U& c)
         for (uint x = 0; x != width; ++x)
         {
             ColumnType& column = entry[x];
+            if (!column)
+            {
+                continue;
+            }
 
             for (uint y = 0; y != height; ++y)
             {
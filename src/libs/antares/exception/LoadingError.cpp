@@ -202,6 +202,21 @@ IncompatibleOutputOptions::IncompatibleOutputOptions(const std::string& text):
 {
 }
 
+InvalidSolverRacing::InvalidSolverRacing(const std::string& text):
+    LoadingError(text)
+{
+}
+
+InvalidShardOptions::InvalidShardOptions(const std::string& text):
+    LoadingError(text)
+{
+}
+
+IncompatibleServiceOptions::IncompatibleServiceOptions(const std::string& text):
+    LoadingError(text)
+{
+}
+
 IncompatibleCO2CostColumns::IncompatibleCO2CostColumns():
     LoadingError(
       "Number of columns for CO2 Cost can be one or same as number of TS in Availability")
@@ -137,6 +137,12 @@ public:
                                              const std::string& specificParameters);
 };
 
+class InvalidSolverRacing: public LoadingError
+{
+public:
+    explicit InvalidSolverRacing(const std::string& text);
+};
+
 class InvalidStudy: public LoadingError
 {
 public:
@@ -206,6 +212,18 @@ public:
     explicit IncompatibleOutputOptions(const std::string& text);
 };
 
+class InvalidShardOptions: public LoadingError
+{
+public:
+    explicit InvalidShardOptions(const std::string& text);
+};
+
+class IncompatibleServiceOptions: public LoadingError
+{
+public:
+    explicit IncompatibleServiceOptions(const std::string& text);
+};
+
 class IncompatibleCO2CostColumns: public LoadingError
 {
 public:
@@ -0,0 +1,254 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/logs/async_logs.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Antares
+{
+namespace
+{
+//! Delay between two drains of the queues, when they were found empty
+constexpr auto drainInterval = std::chrono::milliseconds(20);
+
+using Logger = decltype(logs);
+
+int verbosityLevelOf(LogLevel level)
+{
+    switch (level)
+    {
+    case logFatal:
+        return Yuni::Logs::Verbosity::Fatal::level;
+    case logError:
+        return Yuni::Logs::Verbosity::Error::level;
+    case logWarning:
+        return Yuni::Logs::Verbosity::Warning::level;
+    default:
+        return Yuni::Logs::Verbosity::Info::level;
+    }
+}
+} // namespace
+
+/*!
+** \brief Ring buffer with a single producer (the bound thread) and a single consumer, holding the
+**   lock of the logger (the thread of the sink, or the bound thread when the queue is full)
+*/
+class AsyncLogs::Queue final
+{
+public:
+    struct Entry
+    {
+        int verbosityLevel = Yuni::Logs::Verbosity::Info::level;
+        std::string message;
+    };
+
+    explicit Queue(uint capacity):
+        entries_(capacity)
+    {
+    }
+
+    bool push(int verbosityLevel, std::string&& message)
+    {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == entries_.size())
+        {
+            return false;
+        }
+        auto& entry = entries_[tail % entries_.size()];
+        entry.verbosityLevel = verbosityLevel;
+        entry.message = std::move(message);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool drain()
+    {
+        auto head = head_.load(std::memory_order_relaxed);
+        const auto tail = tail_.load(std::memory_order_acquire);
+        if (head == tail)
+        {
+            return false;
+        }
+        for (; head != tail; ++head)
+        {
+            const auto& entry = entries_[head % entries_.size()];
+            AsyncLogs::writeLocked(entry.verbosityLevel, entry.message);
+            // Releasing the slot, the producer may be waiting for it
+            head_.store(head + 1, std::memory_order_release);
+        }
+        return true;
+    }
+
+    bool empty() const
+    {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::vector<Entry> entries_;
+    // Written by the consumer and by the producer respectively, on distinct cache lines
+    alignas(64) std::atomic<std::size_t> head_ = 0;
+    alignas(64) std::atomic<std::size_t> tail_ = 0;
+};
+
+thread_local AsyncLogs::Queue* AsyncLogs::boundQueue_ = nullptr;
+
+AsyncLogs::Binding::Binding(AsyncLogs& sink, uint queue):
+    previous_(boundQueue_)
+{
+    boundQueue_ = sink.queues_[queue].get();
+}
+
+AsyncLogs::Binding::~Binding()
+{
+    boundQueue_ = previous_;
+}
+
+AsyncLogs::AsyncLogs(uint nbQueues, uint capacity)
+{
+    queues_.reserve(nbQueues);
+    for (uint i = 0; i != nbQueues; ++i)
+    {
+        queues_.push_back(std::make_unique<Queue>(std::max(capacity, 1u)));
+    }
+    thread_ = std::thread([this] { run(); });
+}
+
+AsyncLogs::~AsyncLogs()
+{
+    stopped_ = true;
+    thread_.join();
+    // The bound threads are gone, the last messages can be written from here
+    drain();
+}
+
+void AsyncLogs::push(LogLevel level, std::string&& message)
+{
+    if (!boundQueue_)
+    {
+        Logger::ThreadingPolicy::MutexLocker locker(logs);
+        writeLocked(verbosityLevelOf(level), message);
+        return;
+    }
+    while (!boundQueue_->push(verbosityLevelOf(level), std::move(message)))
+    {
+        // The queue is full, waiting for the background thread
+        std::this_thread::yield();
+    }
+}
+
+bool LogToBoundQueue(int verbosityLevel, const AnyString& message)
+{
+    auto* queue = AsyncLogs::boundQueue_;
+    if (!queue)
+    {
+        return false;
+    }
+    std::string entry(message.c_str(), message.size());
+    if (!queue->push(verbosityLevel, std::move(entry)))
+    {
+        // The queue is full, but the background thread can not drain it while the lock of the
+        // logger is held: the bound thread writes its pending messages itself
+        queue->drain();
+        queue->push(verbosityLevel, std::move(entry));
+    }
+    return true;
+}
+
+void AsyncLogs::writeLocked(int verbosityLevel, const std::string& message)
+{
+    using namespace Yuni::Logs::Verbosity;
+    if (verbosityLevel > logs.verbosityLevel)
+    {
+        return;
+    }
+    const AnyString s(message);
+    switch (verbosityLevel)
+    {
+    case Fatal::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Fatal>(logs, s);
+        break;
+    case Error::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Error>(logs, s);
+        break;
+    case Warning::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Warning>(logs, s);
+        break;
+    case Checkpoint::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Checkpoint>(logs, s);
+        break;
+    case Notice::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Notice>(logs, s);
+        break;
+    case Progress::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Progress>(logs, s);
+        break;
+    case Info::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Info>(logs, s);
+        break;
+    case Compatibility::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Compatibility>(logs, s);
+        break;
+    case Debug::level:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Debug>(logs, s);
+        break;
+    default:
+        logs.OutputHandlers::internalDecoratorWriteWL<Logger, Unknown>(logs, s);
+        break;
+    }
+}
+
+bool AsyncLogs::drain()
+{
+    Logger::ThreadingPolicy::MutexLocker locker(logs);
+    bool drained = false;
+    for (auto& queue: queues_)
+    {
+        drained = queue->drain() || drained;
+    }
+    return drained;
+}
+
+void AsyncLogs::run()
+{
+    while (!stopped_)
+    {
+        if (!drain())
+        {
+            std::this_thread::sleep_for(drainInterval);
+        }
+    }
+}
+
+void AsyncLogs::flush()
+{
+    for (auto& queue: queues_)
+    {
+        while (!queue->empty())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+} // namespace Antares
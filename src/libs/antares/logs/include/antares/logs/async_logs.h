@@ -0,0 +1,162 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_LOGS_ASYNC_LOGS_H__
+#define __ANTARES_LIBS_LOGS_ASYNC_LOGS_H__
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "logs.h"
+
+namespace Antares
+{
+/*!
+** \brief Asynchronous sink for the logs emitted while the MC years are computed
+**
+** The logger takes a global lock and writes each message to the console and to the log file,
+** which becomes a point of contention when many years are computed in parallel. Instead, a
+** thread computing a year is bound to a queue of the sink (one per space), where its messages
+** are pushed without any lock. A background thread drains the queues into the logger.
+**
+** The messages of a queue are written in the order they were pushed, so the logs of a year keep
+** their order. The messages a bound thread emits with `logs` go to its queue as well, after
+** taking the lock of the logger but without writing anything (see BoundThreadHandler). A thread
+** which is not bound to any queue writes directly to the logger.
+**
+** \code
+** AsyncLogs::info() << "[adq-patch] CSR triggered for Year:" << year + 1;
+** \endcode
+*/
+class AsyncLogs final
+{
+    class Queue;
+
+public:
+    /*!
+    ** \brief Message being built, pushed when destroyed
+    */
+    template<LogLevel Level>
+    class Message final
+    {
+    public:
+        Message() = default;
+        Message(const Message&) = delete;
+        Message& operator=(const Message&) = delete;
+
+        ~Message()
+        {
+            AsyncLogs::push(Level, std::string(message_.c_str(), message_.size()));
+        }
+
+        template<class T>
+        Message& operator<<(const T& value)
+        {
+            message_ << value;
+            return *this;
+        }
+
+    private:
+        Yuni::String message_;
+    };
+
+    /*!
+    ** \brief Bind the calling thread to a queue of a sink, until destroyed
+    **
+    ** A queue must not be bound to two threads at the same time.
+    */
+    class Binding final
+    {
+    public:
+        Binding(AsyncLogs& sink, uint queue);
+        ~Binding();
+
+        Binding(const Binding&) = delete;
+        Binding& operator=(const Binding&) = delete;
+
+    private:
+        Queue* previous_;
+    };
+
+    /*!
+    ** \brief Start the thread writing the messages
+    **
+    ** \param nbQueues Number of threads which may be bound at the same time
+    ** \param capacity Number of messages a queue can hold. When a queue is full, the thread
+    **   pushing a message waits for the queue to be drained.
+    */
+    explicit AsyncLogs(uint nbQueues, uint capacity = 1024);
+    //! Write the pending messages and stop the thread
+    ~AsyncLogs();
+
+    AsyncLogs(const AsyncLogs&) = delete;
+    AsyncLogs& operator=(const AsyncLogs&) = delete;
+
+    //! Wait for all the messages pushed so far to be written
+    void flush();
+
+    //! \name Messages
+    //@{
+    static Message<logInfo> info()
+    {
+        return {};
+    }
+
+    static Message<logWarning> warning()
+    {
+        return {};
+    }
+
+    static Message<logError> error()
+    {
+        return {};
+    }
+
+    static Message<logFatal> fatal()
+    {
+        return {};
+    }
+    //@}
+
+private:
+    static void push(LogLevel level, std::string&& message);
+    //! Write a message to the output handlers, the lock of the logger must be held
+    static void writeLocked(int verbosityLevel, const std::string& message);
+
+    //! Write the pending messages of all the queues, return false if there was none
+    bool drain();
+    void run();
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::atomic<bool> stopped_ = false;
+    std::thread thread_;
+
+    //! Queue the calling thread is bound to, if any
+    static thread_local Queue* boundQueue_;
+
+    friend bool LogToBoundQueue(int verbosityLevel, const AnyString& message);
+};
+
+} // namespace Antares
+
+#endif // __ANTARES_LIBS_LOGS_ASYNC_LOGS_H__
@@ -65,12 +65,43 @@
 
 namespace Antares
 {
-//! Handlers for logging
-using LoggingHandlers = Yuni::Logs::StdCout< // For writing to the standard output
-  Yuni::Logs::File<                          // For writing into a log file
-    Yuni::Logs::Callback<>                   // Callback
+/*!
+** \brief Push a message to the queue of AsyncLogs the calling thread is bound to, if any
+**
+** The lock of the logger must be held.
+** \return False if the thread is not bound, the message being left to the other handlers
+*/
+bool LogToBoundQueue(int verbosityLevel, const AnyString& message);
+
+/*!
+** \brief Log Handler: the messages of a thread bound to AsyncLogs go to its queue
+**
+** Thus all the messages of a MC year keep their order, whether they were emitted with `logs`
+** or with AsyncLogs.
+*/
+template<class NextHandler = Yuni::Logs::NullHandler>
+class BoundThreadHandler: public NextHandler
+{
+public:
+    template<class LoggerT, class VerbosityType>
+    void internalDecoratorWriteWL(LoggerT& logger, const AnyString& s) const
+    {
+        if (!LogToBoundQueue(VerbosityType::level, s))
+        {
+            NextHandler::template internalDecoratorWriteWL<LoggerT, VerbosityType>(logger, s);
+        }
+    }
+};
+
+//! Handlers writing the messages
+using OutputHandlers = Yuni::Logs::StdCout< // For writing to the standard output
+  Yuni::Logs::File<                         // For writing into a log file
+    Yuni::Logs::Callback<>                  // Callback
     >>;
 
+//! Handlers for logging
+using LoggingHandlers = BoundThreadHandler<OutputHandlers>;
+
 //! Decorators for logging
 using LoggingDecorators = Yuni::Logs::Time< // Date/Time when the entry log is added
   Yuni::Logs::ApplicationName<              // Name of the current running application
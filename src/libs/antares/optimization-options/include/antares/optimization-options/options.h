@@ -33,5 +33,11 @@ struct OptimizationOptions
     std::string ortoolsSolver = "sirius";
     bool solverLogs = false;
     std::string solverParameters;
+    //! OR-Tools solver raced against the main one on the slow weeks, no racing if empty
+    std::string racingSolver;
+    //! Merge the thermal clusters sharing the same parameters before the optimization
+    bool aggregateThermalClusters = false;
+    //! Remove the fixed variables from the weekly problems before calling the solver
+    bool presolve = false;
 };
 } // namespace Antares::Solver::Optimization
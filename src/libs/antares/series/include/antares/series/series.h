@@ -24,6 +24,7 @@
 #include <map>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <antares/array/matrix.h>
 
@@ -75,6 +76,28 @@ public:
      ** \return A non-zero value if the operation succeeded, 0 otherwise
      */
     bool loadFromFile(const std::string& path, const bool average);
+    /*!
+     ** \brief Defer the loading of the series of a file until the time series numbers are drawn
+     **
+     ** Only the number of series is read, from the first line of the file, all the series being
+     ** released until loadUsedColumns() is called. The file is loaded entirely by loadFromFile()
+     ** when its number of series can not be read this way or when it has a single series.
+     **
+     ** \param path path of the file
+     ** \return A non-zero value if the operation succeeded, 0 otherwise
+     */
+    bool deferLoadingFromFile(const std::string& path);
+    /*!
+     ** \brief Load the series used by the given MC years, if the loading was deferred
+     **
+     ** The time series numbers must have been drawn. The other series stay released.
+     **
+     ** \param years The MC years to load the series of (e.g. the years of the playlist)
+     ** \return A non-zero value if the operation succeeded, 0 otherwise
+     */
+    bool loadUsedColumns(const std::vector<bool>& years);
+    //! Get if the loading of the series was deferred, and not done yet
+    bool loadingDeferred() const;
     /*!
      ** \brief Save time series to a file
      **
@@ -90,9 +113,31 @@ public:
     int saveToFile(const std::string& filename, bool saveEvenIfAllZero) const;
 
     double getCoefficient(uint32_t year, uint32_t timestep) const;
+    /*!
+     ** \brief Get the series of a MC year
+     **
+     ** The series must not have been released (see usedColumnsLoaded())
+     */
     const double* getColumn(uint32_t year) const;
     uint32_t getSeriesIndex(uint32_t year) const;
 
+    /*!
+     ** \brief Release the series which are not used by the given MC years
+     **
+     ** The time series numbers must have been drawn. The released series can not be
+     ** accessed anymore, the width of the matrix is kept.
+     **
+     ** \param years The MC years to keep the series of (e.g. the years of the playlist)
+     ** \return The number of released series
+     */
+    uint32_t releaseUnusedColumns(const std::vector<bool>& years);
+    /*!
+     ** \brief Get if the series used by the given MC years are all loaded
+     */
+    bool usedColumnsLoaded(const std::vector<bool>& years) const;
+    //! Get the number of released series
+    uint32_t releasedColumnCount() const;
+
     /// \brief overload operator to return a column
     /// Unlike getColumn() it uses direct indexing and not timeseriesNumbers
     double* operator[](uint32_t index);
@@ -114,6 +159,13 @@ public:
     TimeSeriesNumbers& timeseriesNumbers;
 
     static const std::vector<double> emptyColumn; ///< used in getColumn if timeSeries empty
+
+private:
+    //! The series used by the given MC years
+    std::vector<bool> usedColumns(const std::vector<bool>& years) const;
+
+    //! The file to load the used series from, when the loading is deferred
+    std::string deferredPath_;
 };
 
 } // namespace Antares::Data
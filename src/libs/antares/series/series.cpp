@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 
 #include <yuni/yuni.h>
@@ -129,6 +130,37 @@ bool TimeSeries::loadFromFile(const std::string& path, const bool average)
     return ret;
 }
 
+bool TimeSeries::deferLoadingFromFile(const std::string& path)
+{
+    const uint width = Matrix<>::CSVFileWidth(path);
+    if (width <= 1)
+    {
+        return loadFromFile(path, false);
+    }
+
+    timeSeries.resizeReleased(width, HOURS_PER_YEAR);
+    deferredPath_ = path;
+    timeseriesNumbers.clear();
+    return true;
+}
+
+bool TimeSeries::loadUsedColumns(const std::vector<bool>& years)
+{
+    if (deferredPath_.empty())
+    {
+        return true;
+    }
+
+    Matrix<>::BufferType dataBuffer;
+    const bool ret = timeSeries.loadColumnsFromCSVFile(deferredPath_,
+                                                       usedColumns(years),
+                                                       1,
+                                                       HOURS_PER_YEAR,
+                                                       &dataBuffer);
+    deferredPath_.clear();
+    return ret;
+}
+
 int TimeSeries::saveToFolder(const AreaName& areaID,
                              const std::string& folder,
                              const std::string& prefix) const
@@ -145,12 +177,26 @@ int TimeSeries::saveToFile(const std::string& filename, bool saveEvenIfAllZero)
 
 double TimeSeries::getCoefficient(uint32_t year, uint32_t timestep) const
 {
-    return timeSeries[getSeriesIndex(year)][timestep];
+    return getColumn(year)[timestep];
+}
+
+bool TimeSeries::loadingDeferred() const
+{
+    return !deferredPath_.empty();
 }
 
 const double* TimeSeries::getColumn(uint32_t year) const
 {
-    return timeSeries[getSeriesIndex(year)];
+    const uint32_t index = getSeriesIndex(year);
+    if (timeSeries.columnReleased(index)) [[unlikely]]
+    {
+        std::ostringstream msg;
+        msg << "The time-series " << index + 1 << " is required by the MC year " << year + 1
+            << " but it was not loaded or was released, as it is not used by the MC years of the"
+            << " playlist (playlist-series-only option)";
+        throw std::runtime_error(msg.str());
+    }
+    return timeSeries[index];
 }
 
 uint32_t TimeSeries::getSeriesIndex(uint32_t year) const
@@ -164,6 +210,61 @@ uint32_t TimeSeries::getSeriesIndex(uint32_t year) const
     return timeseriesNumbers[year];
 }
 
+std::vector<bool> TimeSeries::usedColumns(const std::vector<bool>& years) const
+{
+    std::vector<bool> used(numberOfColumns(), numberOfColumns() == 1);
+    for (uint32_t year = 0; year < years.size() && year < timeseriesNumbers.height(); ++year)
+    {
+        if (years[year])
+        {
+            used[getSeriesIndex(year)] = true;
+        }
+    }
+    return used;
+}
+
+uint32_t TimeSeries::releaseUnusedColumns(const std::vector<bool>& years)
+{
+    if (numberOfColumns() <= 1)
+    {
+        return 0;
+    }
+
+    const std::vector<bool> used = usedColumns(years);
+    uint32_t released = 0;
+    for (uint32_t index = 0; index < numberOfColumns(); ++index)
+    {
+        if (!used[index] && !timeSeries.columnReleased(index))
+        {
+            timeSeries.releaseColumn(index);
+            ++released;
+        }
+    }
+    return released;
+}
+
+bool TimeSeries::usedColumnsLoaded(const std::vector<bool>& years) const
+{
+    for (uint32_t year = 0; year < years.size() && year < timeseriesNumbers.height(); ++year)
+    {
+        if (years[year] && timeSeries.columnReleased(getSeriesIndex(year)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t TimeSeries::releasedColumnCount() const
+{
+    uint32_t released = 0;
+    for (uint32_t index = 0; index < numberOfColumns(); ++index)
+    {
+        released += timeSeries.columnReleased(index);
+    }
+    return released;
+}
+
 double* TimeSeries::operator[](uint32_t index)
 {
     if (timeSeries.width <= index)
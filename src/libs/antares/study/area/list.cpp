@@ -885,6 +885,15 @@ static bool AreaListLoadFromFolderSingleArea(Study& study,
     }
 
     bool averageTs = (study.usedByTheSolver && study.parameters.derated);
+    // Only the series used by the playlist are loaded, once drawn
+    const auto loadSeries = [&study, averageTs](TimeSeries& series, const std::string& path)
+    {
+        if (study.parameters.playlistSeriesOnly)
+        {
+            return series.deferLoadingFromFile(path);
+        }
+        return series.loadFromFile(path, averageTs);
+    };
     // Load
     {
         if (area.load.prepro) // Prepro
@@ -898,7 +907,7 @@ static bool AreaListLoadFromFolderSingleArea(Study& study,
         {
             buffer.clear() << study.folderInput << SEP << "load" << SEP << "series" << SEP
                            << "load_" << area.id << ".txt";
-            ret = area.load.series.loadFromFile(buffer.c_str(), averageTs) && ret;
+            ret = loadSeries(area.load.series, buffer.c_str()) && ret;
         }
     }
 
@@ -915,7 +924,7 @@ static bool AreaListLoadFromFolderSingleArea(Study& study,
         {
             buffer.clear() << study.folderInput << SEP << "solar" << SEP << "series" << SEP
                            << "solar_" << area.id << ".txt";
-            ret = area.solar.series.loadFromFile(buffer.c_str(), averageTs) && ret;
+            ret = loadSeries(area.solar.series, buffer.c_str()) && ret;
         }
     }
 
@@ -974,7 +983,7 @@ static bool AreaListLoadFromFolderSingleArea(Study& study,
         {
             buffer.clear() << study.folderInput << SEP << "wind" << SEP << "series" << SEP
                            << "wind_" << area.id << ".txt";
-            ret = area.wind.series.loadFromFile(buffer.c_str(), averageTs) && ret;
+            ret = loadSeries(area.wind.series, buffer.c_str()) && ret;
         }
     }
 
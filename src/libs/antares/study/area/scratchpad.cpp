@@ -60,13 +60,14 @@ void CalculateDailyMeanPower(const Matrix<double>::ColumnType& hourlyColumn,
     }
 }
 
-AreaScratchpad::AreaScratchpad(const StudyRuntimeInfos& rinfos, Area& area):
-    meanMaxDailyGenPower(area.hydro.series->timeseriesNumbers),
-    meanMaxDailyPumpPower(area.hydro.series->timeseriesNumbers)
+AreaScratchpad::AreaScratchpad(std::shared_ptr<const YearIndependentData> shared):
+    shared_(std::move(shared)),
+    miscGenSum(shared_->miscGenSum.data()),
+    hydroHasMod(shared_->hydroHasMod),
+    pumpHasMod(shared_->pumpHasMod),
+    meanMaxDailyGenPower(shared_->meanMaxDailyGenPower),
+    meanMaxDailyPumpPower(shared_->meanMaxDailyPumpPower)
 {
-    // alias to the simulation mode
-    auto mode = rinfos.mode;
-
     for (uint i = 0; i != 168; ++i)
     {
         dispatchableGenerationMargin[i] = 0;
@@ -77,6 +78,15 @@ AreaScratchpad::AreaScratchpad(const StudyRuntimeInfos& rinfos, Area& area):
         mustrunSum[h] = std::numeric_limits<double>::quiet_NaN();
         originalMustrunSum[h] = std::numeric_limits<double>::quiet_NaN();
     }
+}
+
+AreaScratchpad::YearIndependentData::YearIndependentData(const StudyRuntimeInfos& rinfos,
+                                                         Area& area):
+    meanMaxDailyGenPower(area.hydro.series->timeseriesNumbers),
+    meanMaxDailyPumpPower(area.hydro.series->timeseriesNumbers)
+{
+    // alias to the simulation mode
+    auto mode = rinfos.mode;
 
     // Fatal hors hydro
     {
@@ -111,15 +121,9 @@ AreaScratchpad::AreaScratchpad(const StudyRuntimeInfos& rinfos, Area& area):
     //     So a possible solution to move this computation to some place else is to host
     //     these means TS in the hydro part of areas, and compute them right after
     //     their the hourly TS (max power).
-    //     Note that scratchpad instances are duplicated for multi-threading purpose,
-    //     and that moving these TS elsewhere could create concurrency issues.
-    //     But these daily TS, once computed, are then only read (in daily.cpp
-    //     and when building the weekly optimization problem).
-    //     Thus we don't have to fear such issues.
-    //   - Besides, there is a performance problem here : for a given area, we compute
-    //     the max power daily means for each call to scratchpad constructor, that is
-    //     the same computation for each thread.
-    //     This is another reason to move the computation from here.
+    //     These daily TS, once computed, are then only read (in daily.cpp
+    //     and when building the weekly optimization problem), which is why they are
+    //     computed once and shared by the scratchpads of all the threads.
     //*******************************************************************************
 
     //  Hourly maximum generation/pumping power matrices and their number of TS's (width of
@@ -192,8 +196,15 @@ AreaScratchpad::AreaScratchpad(const StudyRuntimeInfos& rinfos, Area& area):
                                                    dailyNbHoursAtPumpPmax);
 }
 
-void AreaScratchpad::CalculateMeanDailyMaxPowerMatrices(const Matrix<double>& hourlyMaxGenMatrix,
-                                                        const Matrix<double>& hourlyMaxPumpMatrix)
+uint64_t AreaScratchpad::YearIndependentData::memoryUsage() const
+{
+    return sizeof(YearIndependentData) + meanMaxDailyGenPower.memoryUsage()
+           + meanMaxDailyPumpPower.memoryUsage();
+}
+
+void AreaScratchpad::YearIndependentData::CalculateMeanDailyMaxPowerMatrices(
+  const Matrix<double>& hourlyMaxGenMatrix,
+  const Matrix<double>& hourlyMaxPumpMatrix)
 {
     for (uint nbOfTimeSeries = 0; nbOfTimeSeries < hourlyMaxGenMatrix.width; ++nbOfTimeSeries)
     {
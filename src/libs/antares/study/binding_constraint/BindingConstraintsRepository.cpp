@@ -97,6 +97,7 @@ void BindingConstraintsRepository::removeConstraintsWhoseNameConstains(const Any
     WhoseNameContains pred(filter);
     constraints_.erase(std::remove_if(constraints_.begin(), constraints_.end(), pred),
                        constraints_.end());
+    updateActiveConstraints();
 }
 
 static int valueForSort(BindingConstraint::Operator op)
@@ -249,6 +250,7 @@ bool BindingConstraintsRepository::loadFromFolder(Study& study,
         changeConstraintsWeeklyToDaily();
     }
 
+    updateActiveConstraints();
     return true;
 }
 
@@ -358,7 +360,7 @@ void BindingConstraintsRepository::remove(const Area* area)
     RemovePredicate<Area> predicate(area);
     auto e = std::remove_if(constraints_.begin(), constraints_.end(), predicate);
     constraints_.erase(e, constraints_.end());
-    activeConstraints_.clear();
+    updateActiveConstraints();
 }
 
 void BindingConstraintsRepository::remove(const AreaLink* lnk)
@@ -366,7 +368,7 @@ void BindingConstraintsRepository::remove(const AreaLink* lnk)
     RemovePredicate<AreaLink> predicate(lnk);
     auto e = std::remove_if(constraints_.begin(), constraints_.end(), predicate);
     constraints_.erase(e, constraints_.end());
-    activeConstraints_.clear();
+    updateActiveConstraints();
 }
 
 void BindingConstraintsRepository::remove(const BindingConstraint* bc)
@@ -374,7 +376,7 @@ void BindingConstraintsRepository::remove(const BindingConstraint* bc)
     RemovePredicate<BindingConstraint> predicate(bc);
     auto e = std::remove_if(constraints_.begin(), constraints_.end(), predicate);
     constraints_.erase(e, constraints_.end());
-    activeConstraints_.clear();
+    updateActiveConstraints();
 }
 
 BindingConstraintsRepository::iterator BindingConstraintsRepository::begin()
@@ -405,14 +407,9 @@ void BindingConstraintsRepository::markAsModified() const
     }
 }
 
-std::vector<std::shared_ptr<BindingConstraint>> BindingConstraintsRepository::activeConstraints()
-  const
+void BindingConstraintsRepository::updateActiveConstraints()
 {
-    if (!activeConstraints_.empty())
-    {
-        return activeConstraints_;
-    }
-
+    activeConstraints_.clear();
     for (auto& bc: constraints_)
     {
         if (bc->isActive())
@@ -420,7 +417,11 @@ std::vector<std::shared_ptr<BindingConstraint>> BindingConstraintsRepository::ac
             activeConstraints_.push_back(bc);
         }
     }
+}
 
+const std::vector<std::shared_ptr<BindingConstraint>>& BindingConstraintsRepository::
+  activeConstraints() const
+{
     return activeConstraints_;
 }
 
@@ -21,6 +21,8 @@
 #ifndef __ANTARES_LIBS_STUDY_AREA_SCRATCHPAD_H__
 #define __ANTARES_LIBS_STUDY_AREA_SCRATCHPAD_H__
 
+#include <array>
+#include <memory>
 #include <numeric>
 #include <set>
 #include <vector>
@@ -38,6 +40,10 @@ namespace Antares::Data
 {
 /*!
 ** \brief Scratchpad for temporary data performed by the solver
+**
+** There is one scratchpad per area and per space (year computed in parallel). The data which do
+** not depend on the MC year are computed once per area, and shared by the scratchpads of all the
+** spaces (see YearIndependentData).
 */
 class AreaScratchpad final
 {
@@ -45,24 +51,75 @@ public:
     //! Matrix used for time-series
     using TSMatrix = Matrix<double, int32_t>;
 
+    /*!
+    ** \brief Data of the scratchpad which do not depend on the MC year
+    **
+    ** Computed once per area, only read afterwards
+    */
+    class YearIndependentData final
+    {
+    public:
+        YearIndependentData(const StudyRuntimeInfos& rinfos, Area& area);
+
+        //! Sum of all fatal hors hydro
+        std::array<double, HOURS_PER_YEAR> miscGenSum;
+
+        bool hydroHasMod;
+
+        //! if sum(365)[pumpMaxP * pumpMaxE] > 0. then pumpHasMod = true
+        //	else pumpHasMod = false
+        bool pumpHasMod;
+
+        /*!
+        ** \brief Daily mean maximum power matrices
+        **
+        ** These matrices will be calculated based on maximum
+        ** hourly generation/pumping matrices
+        */
+        TimeSeries meanMaxDailyGenPower;
+        TimeSeries meanMaxDailyPumpPower;
+
+        //! Size (in bytes) in memory
+        uint64_t memoryUsage() const;
+
+    private:
+        /*!
+        ** \brief Caluclation of daily mean maximum power matrices
+        **
+        ** Calculates daily mean maximum generation/pumping power
+        ** power matrices meanMaxDailyGenPower/meanMaxDailyPumpPower
+        */
+        void CalculateMeanDailyMaxPowerMatrices(const Matrix<double>& hourlyMaxGenMatrix,
+                                                const Matrix<double>& hourlyMaxPumpMatrix);
+    };
+
     //! \name Constructor
     //@{
     /*!
     ** \brief Constructor
+    **
+    ** \param shared The year-independent data of the area
     */
-    AreaScratchpad(const StudyRuntimeInfos& rinfos, Area& area);
+    explicit AreaScratchpad(std::shared_ptr<const YearIndependentData> shared);
     //! Destructor
     ~AreaScratchpad() = default;
     //@}
 
-    //! Sum of all fatal hors hydro
-    double miscGenSum[HOURS_PER_YEAR];
+private:
+    // Declared first, the references below point into it
+    std::shared_ptr<const YearIndependentData> shared_;
 
+public:
+    //! \name Year-independent data, shared by the scratchpads of all the spaces
+    //@{
+    //! Sum of all fatal hors hydro
+    const double* miscGenSum;
     bool hydroHasMod;
-
-    //! if sum(365)[pumpMaxP * pumpMaxE] > 0. then pumpHasMod = true
-    //	else pumpHasMod = false
     bool pumpHasMod;
+    //! Daily mean maximum power matrices
+    const TimeSeries& meanMaxDailyGenPower;
+    const TimeSeries& meanMaxDailyPumpPower;
+    //@}
 
     //! Sum of all 'must-run' clusters
     // This variable is initialized every MC-year
@@ -80,25 +137,6 @@ public:
      */
     double dispatchableGenerationMargin[168];
 
-    /*!
-    ** \brief Daily mean maximum power matrices
-    **
-    ** These matrices will be calculated based on maximum
-    ** hourly generation/pumping matrices
-    */
-    TimeSeries meanMaxDailyGenPower;
-    TimeSeries meanMaxDailyPumpPower;
-
-private:
-    /*!
-    ** \brief Caluclation of daily mean maximum power matrices
-    **
-    ** Calculates daily mean maximum generation/pumping power
-    ** power matrices meanMaxDailyGenPower/meanMaxDailyPumpPower
-    */
-    void CalculateMeanDailyMaxPowerMatrices(const Matrix<double>& hourlyMaxGenMatrix,
-                                            const Matrix<double>& hourlyMaxPumpMatrix);
-
 }; // class AreaScratchpad
 
 } // namespace Antares::Data
@@ -174,7 +174,17 @@ public:
 
     static std::vector<std::shared_ptr<BindingConstraint>> LoadBindingConstraint(EnvForLoading env);
 
-    [[nodiscard]] std::vector<std::shared_ptr<BindingConstraint>> activeConstraints() const;
+    /*!
+    ** \brief Select the active constraints, as returned by activeConstraints()
+    **
+    ** Called at loading time, each time a constraint is removed and when the runtime infos are
+    ** initialized. The selection is not updated on access : it is read concurrently by the MC
+    ** years run in parallel.
+    */
+    void updateActiveConstraints();
+
+    //! The active constraints, as selected by the last call to updateActiveConstraints()
+    [[nodiscard]] const std::vector<std::shared_ptr<BindingConstraint>>& activeConstraints() const;
 
     [[nodiscard]] Vector getPtrForInequalityBindingConstraints() const;
 
@@ -184,7 +194,7 @@ private:
     //! All constraints
     Data::BindingConstraintsRepository::Vector constraints_;
 
-    mutable std::vector<std::shared_ptr<BindingConstraint>> activeConstraints_;
+    std::vector<std::shared_ptr<BindingConstraint>> activeConstraints_;
 };
 
 struct WhoseNameContains final
@@ -56,6 +56,9 @@ public:
     //! Force the derated mode
     bool forceDerated;
 
+    //! Only load the time-series used by the MC years of the playlist, once drawn
+    bool playlistSeriesOnly = false;
+
     //! No Timeseries import in the input
     // This option might be useful for running old studies without upgrading
     bool noTimeseriesImportIntoInput;
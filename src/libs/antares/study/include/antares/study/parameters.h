@@ -481,6 +481,10 @@ public:
     bool noOutput = false;
     //@}
 
+    //! Only load the time-series used by the MC years of the playlist, once drawn
+    // This variable is not stored within the study but only used by the solver
+    bool playlistSeriesOnly = false;
+
     bool hydroDebug;
 
     //! \name Seeds
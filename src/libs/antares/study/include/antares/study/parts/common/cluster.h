@@ -148,6 +148,8 @@ protected:
 
 private:
     virtual unsigned int precision() const = 0;
+    //! True if the series are generated by Antares, and not only loaded
+    virtual bool seriesGenerated(const Study& study) const;
 };
 } // namespace Data
 } // namespace Antares
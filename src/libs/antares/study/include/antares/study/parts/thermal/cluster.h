@@ -379,6 +379,8 @@ public:
     unsigned int precision() const override;
 
 private:
+    bool seriesGenerated(const Study& study) const override;
+
     // Calculation of marketBid and marginal costs hourly time series
     //
     // Calculation of market bid and marginals costs per hour
@@ -49,20 +49,21 @@ inline void Progression::add(Section section, int nbTicks)
 inline void Progression::setNumberOfParallelYears(uint nb)
 {
     pProgressMeter.nbParallelYears = nb;
-    pProgressMeter.allocateLogsContainer(nb);
+    // The time-series generators may also run at the same time, one task each
+    pProgressMeter.allocateLogsContainer(nb + (sectTSGThermal - sectTSGLoad + 1));
 }
 
 inline Progression::Part& Progression::begin(uint year, Progression::Section section)
 {
+    // Several tasks may begin at the same time
+    std::lock_guard locker(pProgressMeter.mutex);
     // Alias
     Part& part = pProgressMeter.parts[year][section];
     // Reset
     part.tickCount = 0;
     // It is useless to display 0%, so lastTickCount and tickCount can be equals
     part.lastTickCount = 0;
-    pProgressMeter.mutex.lock();
     pProgressMeter.inUse.push_front(&part);
-    pProgressMeter.mutex.unlock();
     return part;
 }
 
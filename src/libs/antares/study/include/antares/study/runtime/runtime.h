@@ -131,6 +131,13 @@ public:
     */
     bool quadraticOptimizationHasFailed;
 
+    /*!
+    ** \brief False when no hourly result over all the MC years is written
+    **
+    ** The hourly values of the synthesis are then neither allocated nor accumulated.
+    */
+    bool hourlySynthesis = true;
+
 private:
     void initializeRangeLimits(const Study& study, StudyRangeLimits& limits);
     //! Prepare all thermal clusters in 'must-run' mode
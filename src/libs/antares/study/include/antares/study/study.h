@@ -309,6 +309,19 @@ public:
     */
     void resizeAllTimeseriesNumbers(uint n);
 
+    /*!
+    ** \brief Load the time-series used by the MC years of the playlist
+    **
+    ** The loading of the series read from the input (load, solar, wind, thermal and renewable
+    ** clusters) is deferred until the time-series numbers are drawn, the generated ones being
+    ** loaded entirely. The capacities of the links are loaded entirely, and released here.
+    ** The time-series numbers must have been drawn.
+    **
+    ** \return False if a series could not be loaded, or if a series used by the playlist is
+    ** missing
+    */
+    bool loadTimeSeriesUsedByThePlaylist();
+
     /*!
     ** \brief Store the timeseries numbers
     **
@@ -1218,6 +1218,9 @@ void Parameters::handleOptimizationOptions(const StudyLoadOptions& options)
     optOptions.ortoolsUsed = options.optOptions.ortoolsUsed;
     optOptions.ortoolsSolver = options.optOptions.ortoolsSolver;
     optOptions.solverParameters = options.optOptions.solverParameters;
+    optOptions.racingSolver = options.optOptions.racingSolver;
+    optOptions.aggregateThermalClusters = options.optOptions.aggregateThermalClusters;
+    optOptions.presolve = options.optOptions.presolve;
 
     // Options that can be set both in command-line and file
     optOptions.solverLogs = options.optOptions.solverLogs || optOptions.solverLogs;
@@ -1317,6 +1320,8 @@ void Parameters::validateOptions(const StudyLoadOptions& options)
     {
         derated = true;
     }
+    // The averaged series of the derated mode are all used
+    playlistSeriesOnly = options.usedByTheSolver && options.playlistSeriesOnly && !derated;
     // forcing value
     if (options.nbYears != 0)
     {
@@ -1721,6 +1726,19 @@ void Parameters::prepareForSimulation(const StudyLoadOptions& options)
         logs.info() << "  :: ortools solver " << options.optOptions.ortoolsSolver
                     << " used for problem resolution";
     }
+    if (!options.optOptions.racingSolver.empty())
+    {
+        logs.info() << "  :: ortools solver " << options.optOptions.racingSolver
+                    << " raced on the slowest weeks";
+    }
+    if (options.optOptions.aggregateThermalClusters)
+    {
+        logs.info() << "  :: thermal clusters with identical parameters optimized as one cluster";
+    }
+    if (options.optOptions.presolve)
+    {
+        logs.info() << "  :: fixed variables removed from the problems given to the solver";
+    }
 
     // indicated that Problems will be named
     if (namedProblems)
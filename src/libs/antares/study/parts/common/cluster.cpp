@@ -96,6 +96,12 @@ bool Cluster::loadDataSeriesFromFolder(Study& s, const AnyString& folder)
     bool ret = true;
     buffer.clear() << folder << SEP << parentArea->id << SEP << id() << SEP << "series."
                    << s.inputExtension;
+    // The generated series must be loaded entirely, the generators overwriting them
+    if (s.parameters.playlistSeriesOnly && !seriesGenerated(s))
+    {
+        return series.deferLoadingFromFile(buffer.c_str()) && ret;
+    }
+
     ret = series.timeSeries.loadFromCSVFile(buffer, 1, HOURS_PER_YEAR, &s.dataBuffer) && ret;
 
     if (s.usedByTheSolver && s.parameters.derated)
@@ -108,6 +114,11 @@ bool Cluster::loadDataSeriesFromFolder(Study& s, const AnyString& folder)
     return ret;
 }
 
+bool Cluster::seriesGenerated(const Study&) const
+{
+    return false;
+}
+
 #undef SEP
 
 void Cluster::invalidateArea()
@@ -716,6 +716,11 @@ bool ThermalCluster::doWeGenerateTS(bool globalTSgeneration) const
     }
 }
 
+bool ThermalCluster::seriesGenerated(const Study& study) const
+{
+    return doWeGenerateTS(0 != (study.parameters.timeSeriesToGenerate & timeSeriesThermal));
+}
+
 unsigned int ThermalCluster::precision() const
 {
     return 0;
@@ -780,9 +785,14 @@ void ThermalCluster::checkAndCorrectAvailability()
     bool condition = false;
     bool report = false;
 
-    for (uint y = 0; y != series.timeSeries.height; ++y)
+    for (uint x = 0; x != series.timeSeries.width; ++x)
     {
-        for (uint x = 0; x != series.timeSeries.width; ++x)
+        // Series not used by the playlist (playlist-series-only option)
+        if (series.timeSeries.columnReleased(x))
+        {
+            continue;
+        }
+        for (uint y = 0; y != series.timeSeries.height; ++y)
         {
             auto rightpart = PminDUnGroupeDuPalierThermique
                              * ceil(series.timeSeries.entry[x][y] / PmaxDUnGroupeDuPalierThermique);
@@ -21,6 +21,8 @@
 
 #include "antares/study/runtime/runtime.h"
 
+#include <chrono>
+
 #include <antares/study/study.h>
 #include <antares/utils/utils.h>
 #include "antares/antares/fatal-error.h"
@@ -34,6 +36,8 @@ static void StudyRuntimeInfosInitializeAllAreas(Study& study, StudyRuntimeInfos&
 {
     uint areaCount = study.areas.size();
     uint nbYearsInParallel = study.maxNbYearsInParallel;
+    uint64_t sharedScratchpadMemory = 0;
+    std::chrono::steady_clock::duration sharedScratchpadDuration{0};
 
     // For each area
     for (uint a = 0; a != areaCount; ++a)
@@ -83,10 +87,16 @@ static void StudyRuntimeInfosInitializeAllAreas(Study& study, StudyRuntimeInfos&
             area.thermal.list.calculationOfSpinning();
         }
 
+        // The year-independent data of the scratchpads are computed once, and shared by all
+        // the spaces
+        auto start = std::chrono::steady_clock::now();
+        auto shared = std::make_shared<const AreaScratchpad::YearIndependentData>(r, area);
+        sharedScratchpadDuration += std::chrono::steady_clock::now() - start;
+        sharedScratchpadMemory += shared->memoryUsage();
         area.scratchpad.reserve(nbYearsInParallel);
         for (uint numSpace = 0; numSpace < nbYearsInParallel; numSpace++)
         {
-            area.scratchpad.emplace_back(r, area);
+            area.scratchpad.emplace_back(shared);
         }
 
         // statistics
@@ -95,6 +105,15 @@ static void StudyRuntimeInfosInitializeAllAreas(Study& study, StudyRuntimeInfos&
 
         r.shortTermStorageCount += area.shortTermStorage.count();
     }
+
+    // Without the sharing, each space would have computed and held its own copy
+    uint64_t copiesSaved = nbYearsInParallel > 1 ? nbYearsInParallel - 1 : 0;
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(sharedScratchpadDuration);
+    logs.info() << "Scratchpads: year-independent data of "
+                << (sharedScratchpadMemory / 1024 / 1024) << "Mo computed in " << ms.count()
+                << "ms, shared by " << nbYearsInParallel << " spaces (saved: "
+                << (copiesSaved * sharedScratchpadMemory / 1024 / 1024) << "Mo, "
+                << copiesSaved * ms.count() << "ms)";
 }
 
 static void StudyRuntimeInfosInitializeAreaLinks(Study& study, StudyRuntimeInfos& r)
@@ -293,6 +312,50 @@ void StudyRuntimeInfos::initializeRandomNumberGenerators(const Parameters& param
     }
 }
 
+// Do the output filters request some hourly results over all the MC years ?
+static bool isHourlySynthesisWritten(const Study& study)
+{
+    if (!study.parameters.synthesis)
+    {
+        return false;
+    }
+
+    // The districts have no filter
+    for (uint i = 0; i != study.setsOfAreas.size(); ++i)
+    {
+        if (study.setsOfAreas.hasOutput(i))
+        {
+            return true;
+        }
+    }
+
+    for (uint a = 0; a != study.areas.size(); ++a)
+    {
+        const auto& area = *(study.areas.byIndex[a]);
+        if (area.filterSynthesis & filterHourly)
+        {
+            return true;
+        }
+        for (const auto& [_, link]: area.links)
+        {
+            if (link->filterSynthesis & filterHourly)
+            {
+                return true;
+            }
+        }
+    }
+
+    // The synthesis of the binding constraints follows their year-by-year filter
+    for (const auto& constraint: study.bindingConstraints.activeConstraints())
+    {
+        if (constraint->yearByYearFilter() & filterHourly)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool StudyRuntimeInfos::loadFromStudy(Study& study)
 {
     auto& gd = study.parameters;
@@ -340,6 +403,9 @@ bool StudyRuntimeInfos::loadFromStudy(Study& study)
     // Area links
     StudyRuntimeInfosInitializeAreaLinks(study, *this);
 
+    // The binding constraints are read concurrently by the MC years from now on
+    study.bindingConstraints.updateActiveConstraints();
+
     // Check if some clusters request TS generation
     checkThermalTSGeneration(study);
 
@@ -347,6 +413,7 @@ bool StudyRuntimeInfos::loadFromStudy(Study& study)
     {
         disableAllFilters(study);
     }
+    hourlySynthesis = isHourlySynthesisWritten(study);
 
     initializeRandomNumberGenerators(study.parameters);
 
@@ -360,6 +427,7 @@ bool StudyRuntimeInfos::loadFromStudy(Study& study)
     logs.info() << "     binding constraints: "
                 << study.bindingConstraints.activeConstraints().size();
     logs.info() << "     geographic trimming:" << (gd.geographicTrimming ? "true" : "false");
+    logs.info() << "     hourly synthesis: " << (hourlySynthesis ? "true" : "false");
     logs.info() << "     memory : " << ((study.memoryUsage()) / 1024 / 1024) << "Mo";
     logs.info();
 
@@ -428,6 +428,10 @@ void Study::performTransformationsBeforeLaunchingSimulation()
           // Adding DSM values
           for (uint timeSeries = 0; timeSeries < matrix.width; ++timeSeries)
           {
+              if (matrix.columnReleased(timeSeries))
+              {
+                  continue;
+              }
               auto& perHour = matrix[timeSeries];
               for (uint h = 0; h < matrix.height; ++h)
               {
@@ -1205,6 +1209,62 @@ void Study::resizeAllTimeseriesNumbers(uint n)
     bindingConstraintsGroups.resizeAllTimeseriesNumbers(n);
 }
 
+bool Study::loadTimeSeriesUsedByThePlaylist()
+{
+    const auto& years = parameters.yearsFilter;
+    // The spinning was applied to the thermal series before they were loaded
+    const bool applySpinning = !(timeSeriesThermal & parameters.timeSeriesToRefresh);
+
+    bool ret = true;
+    uint64_t released = 0;
+    const auto load = [&ret, &released, &years](TimeSeries& series)
+    {
+        ret = series.loadUsedColumns(years) && ret;
+        if (!series.usedColumnsLoaded(years))
+        {
+            ret = false;
+        }
+        released += series.releasedColumnCount();
+    };
+
+    areas.each(
+      [&](Data::Area& area)
+      {
+          load(area.load.series);
+          load(area.solar.series);
+          load(area.wind.series);
+          for (auto& cluster: area.thermal.list.all())
+          {
+              const bool deferred = cluster->series.loadingDeferred();
+              load(cluster->series);
+              if (deferred && applySpinning && cluster->isEnabled())
+              {
+                  cluster->calculationOfSpinning();
+              }
+          }
+          for (auto& cluster: area.renewable.list.all())
+          {
+              load(cluster->series);
+          }
+          for (auto& [_, link]: area.links)
+          {
+              link->directCapacities.releaseUnusedColumns(years);
+              link->indirectCapacities.releaseUnusedColumns(years);
+              load(link->directCapacities);
+              load(link->indirectCapacities);
+          }
+      });
+
+    logs.info() << "  " << released
+                << " time-series not used by the playlist not loaded or released ("
+                << (released * HOURS_PER_YEAR * sizeof(double)) / (1024 * 1024) << " MB)";
+    if (!ret)
+    {
+        logs.error() << "The time-series used by the MC years of the playlist could not be loaded";
+    }
+    return ret;
+}
+
 // TODO VP: Could be removed with the GUI
 bool Study::checkForFilenameLimits(bool output, const String& chfolder) const
 {
@@ -0,0 +1,158 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __ANTARES_LIBS_UTILS_NUMBER_FORMAT_H__
+#define __ANTARES_LIBS_UTILS_NUMBER_FORMAT_H__
+
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace Antares::Utils
+{
+//! The highest number of decimals accepted by formatFixed()
+constexpr unsigned maxFixedPrecision = 16;
+
+/*!
+** \brief Size of a buffer large enough for any number written by the functions below
+**
+** The longest text is a fixed notation of DBL_MAX : sign, 309 digits, point and decimals.
+*/
+constexpr std::size_t numberBufferSize = 352;
+
+/*!
+** \brief Write `v` with exactly `precision` decimals
+**
+** The text is byte-identical to `printf("%.<precision>f", v)`, without going through the
+** locale and without any allocation.
+**
+** \return The end of the written text, nullptr if [first, last) is too small
+*/
+char* formatFixed(char* first, char* last, double v, unsigned precision);
+
+/*!
+** \brief Get the number of decimals of a `%.<N>f` printf format
+**
+** \return N, or -1 if the format has another shape
+*/
+int precisionOfPrintfFormat(const char* format);
+
+/*!
+** \brief Buffered writer of numbers into a string
+**
+** Numbers are formatted in a chunk kept on the stack, and the chunk is appended to the
+** output string only when it is full (or on flush()). Writing a whole column or row of a
+** matrix thus costs a few appends to the output, instead of one per cell.
+**
+** The output string must not be modified by other means before flush() is called.
+** `StringT` can be any string with an `append(const char*, size)` method (std::string,
+** Yuni::CString...).
+*/
+template<class StringT>
+class NumberWriter final
+{
+public:
+    explicit NumberWriter(StringT& out):
+        out_(out),
+        cursor_(chunk_)
+    {
+    }
+
+    NumberWriter(const NumberWriter&) = delete;
+    NumberWriter& operator=(const NumberWriter&) = delete;
+
+    ~NumberWriter()
+    {
+        flush();
+    }
+
+    void put(char c)
+    {
+        ensureRoom(1);
+        *cursor_++ = c;
+    }
+
+    void put(const char* text, std::size_t size)
+    {
+        if (size > numberBufferSize)
+        {
+            flush();
+            out_.append(text, size);
+            return;
+        }
+        ensureRoom(size);
+        std::memcpy(cursor_, text, size);
+        cursor_ += size;
+    }
+
+    //! Same as printf("%.<precision>f")
+    void fixed(double v, unsigned precision)
+    {
+        ensureRoom(numberBufferSize);
+        cursor_ = formatFixed(cursor_, chunkEnd(), v, precision);
+    }
+
+    //! Same as std::to_string() for integers
+    template<class IntT>
+    void integer(IntT v)
+    {
+        static_assert(std::is_integral_v<IntT>);
+        ensureRoom(numberBufferSize);
+        cursor_ = std::to_chars(cursor_, chunkEnd(), v).ptr;
+    }
+
+    //! Append the pending text to the output string
+    void flush()
+    {
+        if (cursor_ != chunk_)
+        {
+            out_.append(chunk_, static_cast<std::size_t>(cursor_ - chunk_));
+            cursor_ = chunk_;
+        }
+    }
+
+private:
+    enum
+    {
+        chunkSize = 8 * numberBufferSize,
+    };
+
+    char* chunkEnd()
+    {
+        return chunk_ + chunkSize;
+    }
+
+    void ensureRoom(std::size_t size)
+    {
+        if (static_cast<std::size_t>(chunkEnd() - cursor_) < size)
+        {
+            flush();
+        }
+    }
+
+    StringT& out_;
+    char chunk_[chunkSize];
+    char* cursor_;
+}; // class NumberWriter
+
+} // namespace Antares::Utils
+
+#endif // __ANTARES_LIBS_UTILS_NUMBER_FORMAT_H__
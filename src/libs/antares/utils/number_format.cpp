@@ -0,0 +1,56 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+
+#include "antares/utils/number_format.h"
+
+#include <cassert>
+
+namespace Antares::Utils
+{
+char* formatFixed(char* first, char* last, double v, unsigned precision)
+{
+    assert(precision <= maxFixedPrecision);
+    auto [ptr, ec] = std::to_chars(first, last, v, std::chars_format::fixed, (int)precision);
+    return ec == std::errc() ? ptr : nullptr;
+}
+
+int precisionOfPrintfFormat(const char* format)
+{
+    if (!format || format[0] != '%' || format[1] != '.')
+    {
+        return -1;
+    }
+
+    int precision = 0;
+    const char* p = format + 2;
+    for (; *p >= '0' && *p <= '9'; ++p)
+    {
+        precision = precision * 10 + (*p - '0');
+    }
+    if (p == format + 2 || p[0] != 'f' || p[1] != '\0' || precision > (int)maxFixedPrecision)
+    {
+        return -1;
+    }
+    return precision;
+}
+
+} // namespace Antares::Utils
@@ -0,0 +1,402 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#include "antares/application/SimulationSession.h"
+
+#include <iostream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <antares/application/ScenarioBuilderOwner.h>
+#include <antares/benchmarking/file_content.h>
+#include <antares/benchmarking/timer.h>
+#include <antares/logs/logs.h>
+#include <antares/writer/writer_factory.h>
+#include "antares/signal-handling/public.h"
+#include "antares/solver/simulation/ISimulationObserver.h"
+#include "antares/solver/simulation/adequacy_mode.h"
+#include "antares/solver/simulation/economy_mode.h"
+#include "antares/solver/simulation/sim_structure_probleme_economique.h"
+
+namespace Antares::Solver
+{
+namespace
+{
+constexpr const char* answerPrefix = "[service] ";
+
+uint parseYear(const std::string& token, uint nbYears)
+{
+    std::size_t end = 0;
+    unsigned long year = std::stoul(token, &end);
+    if (end != token.size() || year == 0)
+    {
+        throw std::invalid_argument("invalid MC year '" + token + "'");
+    }
+    if (year > nbYears)
+    {
+        throw std::invalid_argument("MC year " + token + " is out of range ("
+                                    + std::to_string(nbYears) + " MC years)");
+    }
+    return static_cast<uint>(year - 1);
+}
+
+std::vector<uint> parsePlaylist(const std::string& value, uint nbYears)
+{
+    std::vector<uint> years;
+    std::istringstream stream(value);
+    std::string range;
+    while (std::getline(stream, range, ','))
+    {
+        if (auto dash = range.find('-'); dash != std::string::npos)
+        {
+            // Both ends are checked before expanding, to bound the size of the playlist
+            uint first = parseYear(range.substr(0, dash), nbYears);
+            uint last = parseYear(range.substr(dash + 1), nbYears);
+            if (last < first)
+            {
+                throw std::invalid_argument("invalid range of MC years '" + range + "'");
+            }
+            for (uint y = first; y <= last; ++y)
+            {
+                years.push_back(y);
+            }
+        }
+        else
+        {
+            years.push_back(parseYear(range, nbYears));
+        }
+    }
+    if (years.empty())
+    {
+        throw std::invalid_argument("the playlist must contain at least one MC year");
+    }
+    return years;
+}
+
+bool parseBool(const std::string& key, const std::string& value)
+{
+    if (value == "true" || value == "1")
+    {
+        return true;
+    }
+    if (value == "false" || value == "0")
+    {
+        return false;
+    }
+    throw std::invalid_argument("invalid boolean '" + value + "' for '" + key + "'");
+}
+} // namespace
+
+SimulationRequest parseSimulationRequest(const std::string& line, uint nbYears)
+{
+    SimulationRequest request;
+    std::istringstream stream(line);
+    std::string token;
+    while (stream >> token)
+    {
+        auto eq = token.find('=');
+        if (eq == std::string::npos || eq == 0)
+        {
+            throw std::invalid_argument("expected key=value, got '" + token + "'");
+        }
+        std::string key = token.substr(0, eq);
+        std::string value = token.substr(eq + 1);
+
+        if (key == "name")
+        {
+            request.name = value;
+        }
+        else if (key == "playlist")
+        {
+            request.playlist = parsePlaylist(value, nbYears);
+        }
+        else if (key == "rules")
+        {
+            request.activeRules = value;
+        }
+        else if (key == "year-by-year")
+        {
+            request.yearByYear = parseBool(key, value);
+        }
+        else
+        {
+            throw std::invalid_argument("unknown key '" + key + "'");
+        }
+    }
+    return request;
+}
+
+uint serveSimulationRequests(
+  std::istream& in,
+  std::ostream& out,
+  uint nbYears,
+  const std::function<std::string(const SimulationRequest&)>& runSimulation)
+{
+    out << answerPrefix << "ready" << std::endl;
+
+    uint answered = 0;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream stream(line);
+        std::string command;
+        if (!(stream >> command))
+        {
+            continue; // empty line
+        }
+        if (command == "quit")
+        {
+            break;
+        }
+
+        ++answered;
+        if (command != "run")
+        {
+            out << answerPrefix << "error unknown command '" << command << "'" << std::endl;
+            continue;
+        }
+
+        std::string arguments;
+        std::getline(stream, arguments);
+        try
+        {
+            auto outputFolder = runSimulation(parseSimulationRequest(arguments, nbYears));
+            out << answerPrefix << "ok " << outputFolder << std::endl;
+        }
+        catch (const std::exception& e)
+        {
+            logs.error() << "Service: " << e.what();
+            out << answerPrefix << "error " << e.what() << std::endl;
+        }
+    }
+    return answered;
+}
+
+ServiceOutput::ServiceOutput():
+    standardOutput_(std::cout.rdbuf(std::cerr.rdbuf())),
+    answers_(standardOutput_)
+{
+}
+
+ServiceOutput::~ServiceOutput()
+{
+    answers_.flush();
+    std::cout.rdbuf(standardOutput_);
+}
+
+SimulationSession::SimulationSession(Data::Study& study, const Settings& settings):
+    study_(study),
+    settings_(settings),
+    yearsFilter_(study.parameters.yearsFilter),
+    userPlaylist_(study.parameters.userPlaylist),
+    effectiveNbYears_(study.parameters.effectiveNbYears),
+    useCustomScenario_(study.parameters.useCustomScenario),
+    activeRules_(study.parameters.activeRulesScenario),
+    yearByYear_(study.parameters.yearByYear),
+    simulationName_(study.simulationComments.name),
+    maxNbYearsInParallel_(study.maxNbYearsInParallel),
+    minNbYearsInParallel_(study.minNbYearsInParallel)
+{
+    ioQueueService_ = std::make_shared<Yuni::Job::QueueService>();
+    ioQueueService_->maximumThreadCount(1);
+    ioQueueService_->start();
+}
+
+SimulationSession::~SimulationSession() = default;
+
+void SimulationSession::restoreParameters()
+{
+    auto& parameters = study_.parameters;
+    parameters.yearsFilter = yearsFilter_;
+    parameters.userPlaylist = userPlaylist_;
+    parameters.effectiveNbYears = effectiveNbYears_;
+    parameters.useCustomScenario = useCustomScenario_;
+    parameters.activeRulesScenario = activeRules_;
+    parameters.yearByYear = yearByYear_;
+    study_.simulationComments.name = simulationName_;
+    study_.maxNbYearsInParallel = maxNbYearsInParallel_;
+    study_.minNbYearsInParallel = minNbYearsInParallel_;
+}
+
+void SimulationSession::updateNbYearsInParallel()
+{
+    // The sets of parallel years depend on the playlist. The scratchpads of the areas were
+    // allocated for the number of parallel years computed at loading time, which is the upper
+    // bound here, as if forced by '--force-parallel'.
+    study_.getNumberOfCores(true, maxNbYearsInParallel_);
+
+    if (residentProblems_.size() != study_.maxNbYearsInParallel)
+    {
+        // One weekly problem per space : they are rebuilt by the simulation
+        residentProblems_.clear();
+    }
+}
+
+void SimulationSession::applyOverrides(const SimulationRequest& request)
+{
+    auto& parameters = study_.parameters;
+
+    if (!request.name.empty())
+    {
+        study_.simulationComments.name = request.name;
+    }
+
+    if (request.playlist)
+    {
+        if (parameters.derated)
+        {
+            throw std::invalid_argument("a playlist can not be used with the derated mode");
+        }
+        std::fill(parameters.yearsFilter.begin(), parameters.yearsFilter.end(), false);
+        parameters.effectiveNbYears = 0;
+        for (uint y: *request.playlist)
+        {
+            if (y >= parameters.nbYears)
+            {
+                throw std::invalid_argument("MC year " + std::to_string(y + 1)
+                                            + " is out of range ("
+                                            + std::to_string(parameters.nbYears) + " MC years)");
+            }
+            if (!parameters.yearsFilter[y])
+            {
+                parameters.yearsFilter[y] = true;
+                ++parameters.effectiveNbYears;
+            }
+        }
+        parameters.userPlaylist = true;
+    }
+
+    if (request.activeRules)
+    {
+        if (parameters.derated)
+        {
+            throw std::invalid_argument(
+              "the custom build mode can not be used with the derated mode");
+        }
+        parameters.useCustomScenario = true;
+        parameters.activeRulesScenario = *request.activeRules;
+    }
+
+    if (request.yearByYear)
+    {
+        parameters.yearByYear = *request.yearByYear;
+    }
+}
+
+std::string SimulationSession::run(const SimulationRequest& request)
+{
+    restoreParameters();
+    applyOverrides(request);
+    updateNbYearsInParallel();
+
+    logs.info();
+    logs.checkpoint() << "Service: simulation #" << (runCount_ + 1);
+
+    // The random draws of a run must not depend on the previous runs
+    study_.runtime.initializeRandomNumberGenerators(study_.parameters);
+    ScenarioBuilderOwner(study_).callScenarioBuilder();
+
+    study_.prepareOutput();
+
+    Benchmarking::Timer totalTimer;
+    Benchmarking::DurationCollector durationCollector;
+    Benchmarking::OptimizationInfo optimizationInfo;
+    auto resultWriter = resultWriterFactory(study_.parameters.resultFormat,
+                                            study_.folderOutput,
+                                            ioQueueService_,
+                                            durationCollector);
+    initializeSignalHandlers(resultWriter);
+
+    if (!settings_.noOutput)
+    {
+        study_.saveAboutTheStudy(*resultWriter);
+    }
+
+    Simulation::NullSimulationObserver observer;
+    switch (study_.runtime.mode)
+    {
+    case Data::SimulationMode::Economy:
+    case Data::SimulationMode::Expansion:
+        runSimulationInEconomicMode(study_,
+                                    settings_,
+                                    durationCollector,
+                                    *resultWriter,
+                                    optimizationInfo,
+                                    observer,
+                                    &residentProblems_);
+        break;
+    case Data::SimulationMode::Adequacy:
+        runSimulationInAdequacyMode(study_,
+                                    settings_,
+                                    durationCollector,
+                                    *resultWriter,
+                                    optimizationInfo,
+                                    observer,
+                                    &residentProblems_);
+        break;
+    default:
+        break;
+    }
+
+    totalTimer.stop();
+    durationCollector.addDuration("total", totalTimer.get_duration());
+
+    if (!settings_.noOutput)
+    {
+        writeExecutionInfo(*resultWriter, durationCollector, optimizationInfo);
+    }
+    resultWriter->flush();
+
+    ++runCount_;
+    return study_.folderOutput.to<std::string>();
+}
+
+void SimulationSession::writeExecutionInfo(IResultWriter& writer,
+                                           Benchmarking::DurationCollector& durationCollector,
+                                           const Benchmarking::OptimizationInfo& optimizationInfo)
+{
+    Benchmarking::StudyInfoCollector studyInfoCollector(study_);
+    Benchmarking::SimulationInfoCollector simulationInfoCollector(optimizationInfo);
+
+    Benchmarking::FileContent fileContent;
+    durationCollector.toFileContent(fileContent);
+    studyInfoCollector.toFileContent(fileContent);
+    simulationInfoCollector.toFileContent(fileContent);
+
+    std::string content = fileContent.saveToBufferAsIni();
+    writer.addEntryFromBuffer("execution_info.ini", content);
+}
+
+void SimulationSession::serve(std::istream& in, std::ostream& out)
+{
+    logs.info() << "Service mode: waiting for requests on the standard input";
+    serveSimulationRequests(in,
+                            out,
+                            study_.parameters.nbYears,
+                            [this](const SimulationRequest& request) { return run(request); });
+
+    restoreParameters();
+    ioQueueService_->stop();
+    logs.info() << "Service mode: " << runCount_ << " simulation(s) performed";
+}
+
+} // namespace Antares::Solver
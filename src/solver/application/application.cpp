@@ -24,6 +24,7 @@
 
 #include <antares/antares/fatal-error.h>
 #include <antares/application/ScenarioBuilderOwner.h>
+#include <antares/application/SimulationSession.h>
 #include <antares/benchmarking/timer.h>
 #include <antares/checks/checkLoadedInputData.h>
 #include <antares/exception/LoadingError.hpp>
@@ -229,11 +230,23 @@ void Application::readDataForTheStudy(Data::StudyLoadOptions& options)
         throw Error::RuntimeInfoInitialization();
     }
 
-    // Apply transformations needed by the solver only (and not the interface for example)
-    study.performTransformationsBeforeLaunchingSimulation();
+    if (pSettings.shardCount > study.parameters.effectiveNbYears)
+    {
+        throw Error::InvalidShardOptions("The number of shards can not exceed the number of MC "
+                                         "years of the playlist");
+    }
 
     ScenarioBuilderOwner(study).callScenarioBuilder();
 
+    // The time-series numbers being drawn, the series used by the playlist can be loaded
+    if (study.parameters.playlistSeriesOnly && !study.loadTimeSeriesUsedByThePlaylist())
+    {
+        throw Error::ReadingStudy();
+    }
+
+    // Apply transformations needed by the solver only (and not the interface for example)
+    study.performTransformationsBeforeLaunchingSimulation();
+
     // alloc global vectors
     SIM_AllocationTableaux(study);
 }
@@ -346,6 +359,12 @@ void Application::prepare(int argc, const char* argv[])
         return;
     }
 
+    // In service mode, the standard output is left to the answers to the requests
+    if (pSettings.serviceMode)
+    {
+        pServiceOutput = std::make_unique<ServiceOutput>();
+    }
+
     // Perform some checks
     checkAndCorrectSettingsAndOptions(pSettings, options);
 
@@ -389,6 +408,14 @@ void Application::execute()
 
     pStudy->computePThetaInfForThermalClusters();
 
+    if (pSettings.serviceMode)
+    {
+        SimulationSession session(*pStudy, pSettings);
+        session.serve(std::cin, pServiceOutput->answers());
+        pStudy->progression.stop();
+        return;
+    }
+
     // Run the simulation
     switch (pStudy->runtime.mode)
     {
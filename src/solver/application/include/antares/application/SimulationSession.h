@@ -0,0 +1,181 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#pragma once
+
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <ostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <yuni/job/queue/service.h>
+
+#include <antares/benchmarking/DurationCollector.h>
+#include <antares/study/study.h>
+#include <antares/writer/i_writer.h>
+#include "antares/infoCollection/StudyInfoCollector.h"
+#include "antares/solver/misc/options.h"
+
+struct PROBLEME_HEBDO;
+
+namespace Antares::Solver
+{
+/*!
+** \brief Overrides applied on top of the resident study for a single simulation
+**
+** Every field left empty keeps the value read from the study at loading time.
+*/
+struct SimulationRequest
+{
+    //! Label appended to the output folder name
+    std::string name;
+    //! MC years to perform (0-based), replaces the playlist of the study
+    std::optional<std::vector<uint>> playlist;
+    //! Scenario builder ruleset to apply (enables the custom scenario mode)
+    std::optional<std::string> activeRules;
+    //! Export the results of each MC year
+    std::optional<bool> yearByYear;
+};
+
+/*!
+** \brief Parse a request line of the service protocol
+**
+** A request is a whitespace separated list of `key=value` tokens :
+**   name=<label> playlist=<1,3,5-8> rules=<ruleset> year-by-year=<true|false>
+** MC years are given 1-based, as displayed in the logs, and must not exceed `nbYears`.
+**
+** \throw std::invalid_argument if the line is malformed
+*/
+SimulationRequest parseSimulationRequest(const std::string& line, uint nbYears);
+
+/*!
+** \brief Read requests line by line until `quit` or the end of the stream
+**
+** Each `run [key=value ...]` line calls `runSimulation`. The answer is written as a single line
+** on `out`, either `[service] ok <output folder>` or `[service] error <reason>`. The playlists
+** are checked against the `nbYears` MC years of the study.
+**
+** \return The number of requests answered
+*/
+uint serveSimulationRequests(
+  std::istream& in,
+  std::ostream& out,
+  uint nbYears,
+  const std::function<std::string(const SimulationRequest&)>& runSimulation);
+
+/*!
+** \brief Reserve the standard output to the answers of the service
+**
+** While alive, everything written on `std::cout` (the logs in particular) goes to the standard
+** error instead, so that `answers()` is the only stream left on the standard output.
+*/
+class ServiceOutput final
+{
+public:
+    ServiceOutput();
+    ~ServiceOutput();
+
+    ServiceOutput(const ServiceOutput&) = delete;
+    ServiceOutput& operator=(const ServiceOutput&) = delete;
+
+    std::ostream& answers()
+    {
+        return answers_;
+    }
+
+private:
+    std::streambuf* standardOutput_;
+    std::ostream answers_;
+};
+
+/*!
+** \brief Keep a loaded study resident and run several simulations on it
+**
+** The study is loaded, checked and prepared once (see Application::prepare). Each call to
+** run() restores the parameters read at loading time, applies the overrides of the request,
+** resets the random number generators and re-applies the scenario builder, so that a run
+** gives the same results as a fresh solver launched on the overridden study.
+**
+** The weekly problems (and their LP matrices) are kept from one run to the next, the same way
+** they are kept from one MC year to the next within a run. The number of MC years run in
+** parallel is computed again for the playlist of each run, up to the number computed at loading
+** time. The weekly problems are rebuilt when it changes.
+*/
+class SimulationSession final
+{
+public:
+    SimulationSession(Data::Study& study, const Settings& settings);
+    ~SimulationSession();
+
+    SimulationSession(const SimulationSession&) = delete;
+    SimulationSession& operator=(const SimulationSession&) = delete;
+
+    /*!
+    ** \brief Run a single simulation
+    **
+    ** \return The output folder of the simulation
+    */
+    std::string run(const SimulationRequest& request);
+
+    //! Run the simulations requested on `in` (see serveSimulationRequests())
+    void serve(std::istream& in, std::ostream& out);
+
+    //! The number of simulations performed so far
+    uint runCount() const
+    {
+        return runCount_;
+    }
+
+private:
+    void restoreParameters();
+    void applyOverrides(const SimulationRequest& request);
+    //! Compute the sets of parallel years again, for the playlist of the run
+    void updateNbYearsInParallel();
+    void writeExecutionInfo(IResultWriter& writer,
+                            Benchmarking::DurationCollector& durationCollector,
+                            const Benchmarking::OptimizationInfo& optimizationInfo);
+
+    Data::Study& study_;
+    const Settings& settings_;
+
+    //! \name Parameters as loaded, restored before each run
+    //@{
+    std::vector<bool> yearsFilter_;
+    bool userPlaylist_;
+    uint effectiveNbYears_;
+    bool useCustomScenario_;
+    Data::RulesScenarioName activeRules_;
+    bool yearByYear_;
+    Yuni::String simulationName_;
+    //! Upper bound of the number of MC years run in parallel
+    uint maxNbYearsInParallel_;
+    uint minNbYearsInParallel_;
+    //@}
+
+    std::shared_ptr<Yuni::Job::QueueService> ioQueueService_;
+    //! The weekly problems of each space, allocated by the first run
+    std::vector<PROBLEME_HEBDO> residentProblems_;
+    uint runCount_ = 0;
+}; // class SimulationSession
+
+} // namespace Antares::Solver
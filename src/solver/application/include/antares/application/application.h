@@ -32,6 +32,8 @@
 
 namespace Antares::Solver
 {
+class ServiceOutput;
+
 class Application final: public Yuni::IEventObserver<Application, Yuni::Policy::SingleThreaded>
 {
 public:
@@ -118,6 +120,8 @@ private:
 
     std::shared_ptr<Yuni::Job::QueueService> ioQueueService;
     IResultWriter::Ptr resultWriter = nullptr;
+    //! Answers of the service mode, the logs going to the standard error meanwhile
+    std::unique_ptr<ServiceOutput> pServiceOutput;
 
     void prepareWriter(const Antares::Data::Study& study,
                        Benchmarking::DurationCollector& duration_collector);
@@ -21,8 +21,10 @@
 
 #include "antares/solver/constraints-builder/cbuilder.h"
 
+#include <algorithm>
 #include <cmath>
 #include <filesystem>
+#include <thread>
 
 #include "antares/solver/constraints-builder/grid.h"
 
@@ -54,6 +56,17 @@ CBuilder::CBuilder(Antares::Data::Study& study):
 {
 }
 
+Yuni::Job::QueueService& CBuilder::threads()
+{
+    if (!pThreads)
+    {
+        pThreads = std::make_unique<Yuni::Job::QueueService>();
+        pThreads->maximumThreadCount(std::max(1u, std::thread::hardware_concurrency()));
+        pThreads->start();
+    }
+    return *pThreads;
+}
+
 bool Antares::CBuilder::isCycleDriver(linkInfo* lnkI)
 {
     std::string s1(lnkI->ptr->from->name.to<std::string>());
@@ -239,24 +252,45 @@ bool CBuilder::update()
         return true;
     }
 
-    logs.info() << "Search basis ";
-
-    _grid.clear();
-
-    // create the graph
+    // The mesh only depends on the topology of the grid and on the weights of the lines
+    // (i.e. their number of impedance changes). It is kept when none of them has changed,
+    // otherwise only its loops crossing a changed line are searched again.
+    std::vector<Graph::EdgeDefinition> gridEdges;
+    gridEdges.reserve(enabledACLines.size());
     for (auto l = enabledACLines.begin(); l != enabledACLines.end(); l++)
     {
-        std::string s1((*l)->ptr->from->name.to<std::string>());
-        std::string s2((*l)->ptr->with->name.to<std::string>());
-        auto n1 = _grid.addNode(*((*l)->ptr->from), s1);
-        auto n2 = _grid.addNode(*((*l)->ptr->with), s2);
-        _grid.addEdge(n1, n2, (long)(*l)->getWeightWithImpedance());
+        gridEdges.emplace_back((*l)->ptr->from->name.to<std::string>(),
+                               (*l)->ptr->with->name.to<std::string>(),
+                               (long)(*l)->getWeightWithImpedance());
     }
 
-    // build the set of loops which span the grid
-    if (!_grid.buildMesh())
+    if (gridEdges != pMeshGridEdges)
     {
-        return false;
+        logs.info() << "Search basis ";
+
+        const auto previousMesh = _grid.getMeshDefinition();
+        pMeshGridEdges.clear();
+        _grid.clear();
+
+        // create the graph
+        for (uint l = 0; l != enabledACLines.size(); ++l)
+        {
+            auto& [s1, s2, weight] = gridEdges[l];
+            auto n1 = _grid.addNode(*(enabledACLines[l]->ptr->from), s1);
+            auto n2 = _grid.addNode(*(enabledACLines[l]->ptr->with), s2);
+            _grid.addEdge(n1, n2, weight);
+        }
+
+        // build the set of loops which span the grid
+        if (!_grid.buildMesh(&threads(), previousMesh))
+        {
+            return false;
+        }
+        pMeshGridEdges = std::move(gridEdges);
+    }
+    else
+    {
+        logs.info() << "Search basis: the grid has not changed, keeping the previous basis";
     }
 
     // create the constraints
@@ -22,112 +22,129 @@
 #include <sstream>
 #include <string>
 
+#include <antares/concurrency/concurrency.h>
 #include "antares/solver/constraints-builder/cbuilder.h"
 
 using namespace Yuni;
 
 namespace Antares
 {
-bool CBuilder::createConstraints(const std::vector<Vector>& mesh)
+void CBuilder::computeCycleStates(Cycle& currentCycle) const
 {
-    uint nCount = alreadyExistingNetworkConstraints(CB_PREFIX) + 1;
-    uint nSubCount = 1;
-    bool ret = false;
-
     uint columnImpedance = (uint)Antares::Data::fhlImpedances;
     uint columnLoopFlow = (uint)Antares::Data::fhlLoopFlow;
+    const Vector& loop = currentCycle.loop;
 
-    std::vector<Cycle> cycleBase;
-    int count = 1;
-    auto i = mesh.begin();
-    logs.debug() << "calendarstart: " << calendarStart;
-    logs.debug() << "calendarEnd: " << calendarEnd;
-    logs.debug() << "infinite_value: " << infiniteSecondMember;
-    logs.debug() << "nodal_loopflow_check: " << checkNodalLoopFlow;
-    logs.debug() << "delete: " << pDelete;
+    std::vector<double> impedanceVector;
+    impedanceVector.reserve(loop.size());
 
-    for (; i != mesh.end(); i++, count++)
+    for (uint hour = 0; hour < currentCycle.time; ++hour)
     {
-        logs.info() << "Writing constraints (" << count << "/" << mesh.size() << ")";
-        const Vector& loop = (*i);
-
-        Cycle currentCycle(loop, infiniteSecondMember);
-        if (calendarEnd != 8760 || calendarStart != 1)
+        impedanceVector.clear();
+        // initiate second members
+        double lb(0), ub(0);
+        int i = 0;
+        for (auto line = loop.begin(); line != loop.end(); line++, i++)
         {
-            currentCycle.opType = Data::BindingConstraint::opBoth;
+            impedanceVector.push_back((*line)->ptr->parameters[columnImpedance][hour]);
+            /*PN-TODO: Check the formula (page 3)*/
+            if (currentCycle.opType == Data::BindingConstraint::opEquality)
+            {
+                ub += ((*line)->ptr->parameters[columnImpedance][hour]
+                         * (*line)->ptr->parameters[columnLoopFlow][hour] * (int)includeLoopFlow
+                       + (*line)->ptr->parameters[Data::fhlPShiftMinus][hour] * includePhaseShift)
+                      * currentCycle.sign[i];
+            }
+            else if (currentCycle.opType == Data::BindingConstraint::opBoth
+                     && hour + 1 <= calendarEnd && hour + 1 >= calendarStart)
+            {
+                ub += ((*line)->ptr->parameters[columnImpedance][hour]
+                       * (*line)->ptr->parameters[columnLoopFlow][hour] * (int)includeLoopFlow)
+                        * currentCycle.sign[i]
+                      + std::min(((*line)->ptr->parameters[Data::fhlPShiftMinus][hour]
+                                  * includePhaseShift)
+                                   * currentCycle.sign[i],
+                                 ((*line)->ptr->parameters[Data::fhlPShiftPlus][hour]
+                                  * includePhaseShift)
+                                   * currentCycle.sign[i]);
+
+                lb += ((*line)->ptr->parameters[columnImpedance][hour]
+                       * (*line)->ptr->parameters[columnLoopFlow][hour] * (int)includeLoopFlow)
+                        * currentCycle.sign[i]
+                      + std::max(((*line)->ptr->parameters[Data::fhlPShiftMinus][hour]
+                                  * includePhaseShift)
+                                   * currentCycle.sign[i],
+                                 ((*line)->ptr->parameters[Data::fhlPShiftPlus][hour]
+                                  * includePhaseShift)
+                                   * currentCycle.sign[i]);
+            }
+            else
+            {
+                lb = infiniteSecondMember;
+                ub = -1 * infiniteSecondMember;
+            }
+        }
+
+        State& st = currentCycle.getState(impedanceVector);
 
-            logs.error() << "Calendar start and end needs to be default values: 1 and 8760";
-            logs.error() << "Actual values: start " << calendarStart << " end " << calendarEnd;
-            return false;
+        if (currentCycle.opType == Data::BindingConstraint::opBoth)
+        {
+            st.secondMember.entry[0][hour] = std::max(lb, ub);
+            st.secondMember.entry[1][hour] = std::min(ub, lb);
+        }
+        else
+        {
+            st.secondMember.entry[2][hour] = ub;
         }
 
-        for (uint hour = 0; hour < currentCycle.time; ++hour)
+        // The weights only depend on the impedances, which identify the state
+        if (st.WeightMap.empty())
         {
-            std::vector<double> impedanceVector;
-            WeightMap wm;
-            // initiate second members
-            double lb(0), ub(0);
-            int i = 0;
+            i = 0;
             for (auto line = loop.begin(); line != loop.end(); line++, i++)
             {
-                impedanceVector.push_back((*line)->ptr->parameters[columnImpedance][hour]);
-                /*PN-TODO: Check the formula (page 3)*/
-                if (currentCycle.opType == Data::BindingConstraint::opEquality)
-                {
-                    ub += ((*line)->ptr->parameters[columnImpedance][hour]
-                             * (*line)->ptr->parameters[columnLoopFlow][hour] * (int)includeLoopFlow
-                           + (*line)->ptr->parameters[Data::fhlPShiftMinus][hour]
-                               * includePhaseShift)
-                          * currentCycle.sign[i];
-                }
-                else if (currentCycle.opType == Data::BindingConstraint::opBoth
-                         && hour + 1 <= calendarEnd && hour + 1 >= calendarStart)
-                {
-                    ub += ((*line)->ptr->parameters[columnImpedance][hour]
-                           * (*line)->ptr->parameters[columnLoopFlow][hour] * (int)includeLoopFlow)
-                            * currentCycle.sign[i]
-                          + std::min(((*line)->ptr->parameters[Data::fhlPShiftMinus][hour]
-                                      * includePhaseShift)
-                                       * currentCycle.sign[i],
-                                     ((*line)->ptr->parameters[Data::fhlPShiftPlus][hour]
-                                      * includePhaseShift)
-                                       * currentCycle.sign[i]);
-
-                    lb += ((*line)->ptr->parameters[columnImpedance][hour]
-                           * (*line)->ptr->parameters[columnLoopFlow][hour] * (int)includeLoopFlow)
-                            * currentCycle.sign[i]
-                          + std::max(((*line)->ptr->parameters[Data::fhlPShiftMinus][hour]
-                                      * includePhaseShift)
-                                       * currentCycle.sign[i],
-                                     ((*line)->ptr->parameters[Data::fhlPShiftPlus][hour]
-                                      * includePhaseShift)
-                                       * currentCycle.sign[i]);
-                }
-                else
-                {
-                    lb = infiniteSecondMember;
-                    ub = -1 * infiniteSecondMember;
-                }
-
-                wm[(*line)] = (*line)->ptr->parameters[columnImpedance][hour]
-                              * currentCycle.sign[i];
+                st.WeightMap[(*line)] = impedanceVector[i] * currentCycle.sign[i];
             }
+        }
+    }
+}
 
-            State& st = currentCycle.getState(impedanceVector);
+bool CBuilder::createConstraints(const std::vector<Vector>& mesh)
+{
+    uint nCount = alreadyExistingNetworkConstraints(CB_PREFIX) + 1;
+    uint nSubCount = 1;
+    bool ret = false;
 
-            if (currentCycle.opType == Data::BindingConstraint::opBoth)
-            {
-                st.secondMember.entry[0][hour] = std::max(lb, ub);
-                st.secondMember.entry[1][hour] = std::min(ub, lb);
-            }
-            else
-            {
-                st.secondMember.entry[2][hour] = ub;
-            }
-            st.WeightMap = wm;
-        }
+    logs.debug() << "calendarstart: " << calendarStart;
+    logs.debug() << "calendarEnd: " << calendarEnd;
+    logs.debug() << "infinite_value: " << infiniteSecondMember;
+    logs.debug() << "nodal_loopflow_check: " << checkNodalLoopFlow;
+    logs.debug() << "delete: " << pDelete;
 
-        cycleBase.push_back(currentCycle);
+    if (!mesh.empty() && (calendarEnd != 8760 || calendarStart != 1))
+    {
+        logs.error() << "Calendar start and end needs to be default values: 1 and 8760";
+        logs.error() << "Actual values: start " << calendarStart << " end " << calendarEnd;
+        return false;
+    }
+
+    std::vector<Cycle> cycleBase;
+    cycleBase.reserve(mesh.size());
+    for (auto i = mesh.begin(); i != mesh.end(); i++)
+    {
+        cycleBase.emplace_back(*i, infiniteSecondMember);
+    }
+
+    // The cycles are independent from each other
+    {
+        logs.info() << "Writing constraints (" << cycleBase.size() << " cycles)";
+        Concurrency::FutureSet tasks;
+        for (auto& cycle: cycleBase)
+        {
+            tasks.add(
+              Concurrency::AddTask(threads(), [this, &cycle] { computeCycleStates(cycle); }));
+        }
+        tasks.join();
     }
 
     for (auto cycle = cycleBase.begin(); cycle != cycleBase.end(); cycle++)
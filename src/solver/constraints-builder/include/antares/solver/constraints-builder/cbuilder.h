@@ -21,6 +21,10 @@
 #ifndef __ANTARES_CONSTRAINTSBUILDER_BUILDER_CBUILDER_H__
 #define __ANTARES_CONSTRAINTSBUILDER_BUILDER_CBUILDER_H__
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <yuni/yuni.h>
 #include <yuni/core/string.h>
 
@@ -407,6 +411,16 @@ public:
     }
 
 private:
+    //! Threads of the builder, started on first use
+    Yuni::Job::QueueService& threads();
+
+    /*!
+    ** \brief Compute the second members and weights of all the states of a cycle
+    **
+    ** Only reads the links, so that the cycles can be computed in parallel
+    */
+    void computeCycleStates(Cycle& cycle) const;
+
     /*!
     ** \brief add one constraint to the study
     */
@@ -435,12 +449,17 @@ private:
 
     std::vector<std::vector<linkInfo*>> pMesh;
 
+    //! Edges of the grid the current mesh was built from
+    std::vector<Graph::EdgeDefinition> pMeshGridEdges;
+
     std::map<Data::Area*, std::set<linkInfo*>> areaToLinks;
 
     Antares::Data::Study& pStudy;
 
     Graph::Grid<Antares::Data::Area> _grid;
 
+    std::unique_ptr<Yuni::Job::QueueService> pThreads;
+
 }; // class cbuilder
 
 } // namespace Antares
@@ -21,10 +21,15 @@
 #ifndef CONSTRAINTSBUILDER_BUILDER_GRID_H
 #define CONSTRAINTSBUILDER_BUILDER_GRID_H
 
+#include <bit>
+#include <cstdint>
 #include <numeric>
+#include <tuple>
+#include <unordered_map>
 
 #include <yuni/yuni.h>
 #include <yuni/core/string.h>
+#include <yuni/job/queue/service.h>
 
 #include <antares/study/study.h>
 
@@ -125,6 +130,70 @@ public:
     };
 };
 
+/*!
+** \brief Set of edges of a grid, as a packed bitset (one bit per edge index)
+*/
+class EdgeIncidence
+{
+public:
+    EdgeIncidence() = default;
+
+    explicit EdgeIncidence(std::size_t size):
+        words_((size + 63) / 64, 0)
+    {
+    }
+
+    void set(std::size_t i)
+    {
+        words_[i / 64] |= std::uint64_t(1) << (i % 64);
+    }
+
+    bool test(std::size_t i) const
+    {
+        return (words_[i / 64] >> (i % 64)) & 1;
+    }
+
+    //! Symmetric difference
+    EdgeIncidence& operator^=(const EdgeIncidence& other)
+    {
+        for (std::size_t w = 0; w != words_.size(); ++w)
+        {
+            words_[w] ^= other.words_[w];
+        }
+        return *this;
+    }
+
+    //! Parity of the number of edges belonging to both sets
+    int innerProductParity(const EdgeIncidence& other) const
+    {
+        std::uint64_t parity = 0;
+        for (std::size_t w = 0; w != words_.size(); ++w)
+        {
+            parity ^= words_[w] & other.words_[w];
+        }
+        return std::popcount(parity) % 2;
+    }
+
+    //! Call `f(index)` for each edge of the set, by increasing index
+    template<class F>
+    void forEach(F&& f) const
+    {
+        for (std::size_t w = 0; w != words_.size(); ++w)
+        {
+            for (std::uint64_t bits = words_[w]; bits; bits &= bits - 1)
+            {
+                f(w * 64 + (std::size_t)std::countr_zero(bits));
+            }
+        }
+    }
+
+private:
+    std::vector<std::uint64_t> words_;
+};
+
+//! Definition of an edge, independent from the grid: origin, destination and weight
+typedef std::tuple<std::string, std::string, long> EdgeDefinition;
+
 /*!
 ** \brief Antares Grid (graph)
 */
@@ -137,7 +206,7 @@ public:
     typedef std::vector<NodeP> VectorNodeP;
     typedef std::vector<EdgeP> VectorEdgeP;
     typedef std::map<NodeP, NodeP> MapNodes;
-    typedef std::vector<bool> EdgeIncidence;
+    typedef Graph::EdgeIncidence EdgeIncidence;
 
 public:
     //! \name Constructor & Destructor
@@ -159,32 +228,22 @@ public:
     VectorEdgeP findShortestPath(NodeP node1, NodeP node2) const;
 
     //! find an edge from node names
-    EdgeP findEdgeFromNodeNames(std::string u, std::string v)
+    EdgeP findEdgeFromNodeNames(const std::string& u, const std::string& v) const
     {
-        auto edgeIT = std::find_if(pEdgesList.begin(),
-                                   pEdgesList.end(),
-                                   [&u, &v](const EdgeP& edgeP) -> bool
-                                   {
-                                       if (edgeP->getOrigin()->getName() == u
-                                           && edgeP->getDestination()->getName() == v)
-                                       {
-                                           return true;
-                                       }
-                                       if (edgeP->getDestination()->getName() == u
-                                           && edgeP->getOrigin()->getName() == v)
-                                       {
-                                           return true;
-                                       }
-                                       else
-                                       {
-                                           return false;
-                                       }
-                                   });
-        if (edgeIT != pEdgesList.end())
+        NodeP n1 = findNodeFromName(u);
+        NodeP n2 = findNodeFromName(v);
+        if (!n1 || !n2)
         {
-            return *edgeIT;
+            return nullptr;
+        }
+        // There is at most one edge between two nodes (see addEdge())
+        if (auto adj = adjency.find(n1); adj != adjency.end())
+        {
+            if (auto e = adj->second.find(n2); e != adj->second.end())
+            {
+                return e->second;
+            }
         }
-
         return nullptr;
     }
 
@@ -221,32 +280,25 @@ public:
     void removeEdge(EdgeP e)
     {
         auto edgeIT = std::find(pEdgesList.begin(), pEdgesList.end(), e);
-        auto edge = *edgeIT;
         if (edgeIT != pEdgesList.end())
         {
             pEdgesList.erase(edgeIT);
+            // The positions of the next edges have changed
+            edgeIndices.clear();
+            searchAdjencyIsValid = false;
 
             adjency[e->getOrigin()].erase(e->getDestination());
             adjency[e->getDestination()].erase(e->getOrigin());
 
-            delete edge;
+            delete e;
         }
     }
 
     //! find a node from it's name
-    NodeP findNodeFromName(std::string name)
+    NodeP findNodeFromName(const std::string& name) const
     {
-        auto nodeIT = std::find_if(pNodesList.begin(),
-                                   pNodesList.end(),
-                                   [&name](NodeP& n) -> bool { return n->getName() == name; });
-        if (nodeIT != pNodesList.end())
-        {
-            return *nodeIT;
-        }
-        else
-        {
-            return nullptr;
-        }
+        auto nodeIT = nodesByName.find(name);
+        return nodeIT != nodesByName.end() ? nodeIT->second : nullptr;
     }
 
     /*!
@@ -276,8 +328,36 @@ public:
     ** \brief Build pMesh
     **
     ** the smallest set of loops meshing the graph
+    **
+    ** \param threads If not null, the shortest paths of each loop are searched in parallel
+    ** \param previousMesh Loops of a previous mesh (see getMeshDefinition()). Those whose
+    **   edges all belong to the grid with the same weight are kept, and only the other loops
+    **   are searched
     */
-    bool buildMesh();
+    bool buildMesh(Yuni::Job::QueueService* threads = nullptr,
+                   const std::vector<std::vector<EdgeDefinition>>& previousMesh = {});
+
+    /*!
+    ** \brief Get the loops of the mesh, as definitions of their edges
+    **
+    ** To be given to buildMesh() once the grid has changed
+    */
+    std::vector<std::vector<EdgeDefinition>> getMeshDefinition() const
+    {
+        std::vector<std::vector<EdgeDefinition>> mesh;
+        mesh.reserve(pMesh.size());
+        for (const VectorEdgeP& loop: pMesh)
+        {
+            auto& edges = mesh.emplace_back();
+            for (EdgeP e: loop)
+            {
+                edges.emplace_back(e->getOrigin()->getName(),
+                                   e->getDestination()->getName(),
+                                   e->getWeight());
+            }
+        }
+        return mesh;
+    }
 
     /*!
     ** \brief Get the min cycle basis mesh
@@ -289,7 +369,7 @@ public:
         return meshIndexMatrix;
     }
 
-    VectorEdgeP twoLevelPath(VectorNodeP vN);
+    VectorEdgeP twoLevelPath(const VectorNodeP& vN, Yuni::Job::QueueService* threads = nullptr);
 
     /*!
     ** \brief get a Gid where edges and nodes are duplicated
@@ -309,58 +389,41 @@ public:
     }
 
 public:
-    EdgeIncidence getIncidenceVector(VectorEdgeP vE)
+    EdgeIncidence getIncidenceVector(const VectorEdgeP& vE) const
     {
-        EdgeIncidence Ei(pEdgesList.size(), false);
-        for (uint i = 0; i < pEdgesList.size(); i++)
+        EdgeIncidence Ei(pEdgesList.size());
+        for (EdgeP e: vE)
         {
-            if (std::find(vE.begin(), vE.end(), pEdgesList[i]) != vE.end())
+            if (auto i = edgeIndex(e); i >= 0)
             {
-                Ei[i] = true;
+                Ei.set(i);
             }
         }
         return Ei;
     }
 
-    EdgeIncidence getIncidenceVector(EdgeP vE)
+    EdgeIncidence getIncidenceVector(EdgeP vE) const
     {
-        EdgeIncidence Ei(pEdgesList.size(), false);
-        for (uint i = 0; i < pEdgesList.size(); i++)
-        {
-            if (vE == pEdgesList[i])
-            {
-                Ei[i] = true;
-                break;
-            }
-        }
-        return Ei;
+        return getIncidenceVector(VectorEdgeP{vE});
     }
 
-    VectorEdgeP getEdgeVectorFromIncidence(EdgeIncidence vI)
+    VectorEdgeP getEdgeVectorFromIncidence(const EdgeIncidence& vI) const
     {
         VectorEdgeP vE;
-        for (uint i = 0; i < pEdgesList.size(); i++)
-        {
-            if (vI[i] == true)
-            {
-                vE.push_back(pEdgesList[i]);
-            }
-        }
+        vI.forEach([this, &vE](std::size_t i) { vE.push_back(pEdgesList[i]); });
         return vE;
     }
 
-    EdgeIncidence incidenceXOR(EdgeIncidence& e1, EdgeIncidence& e2)
+    EdgeIncidence incidenceXOR(const EdgeIncidence& e1, const EdgeIncidence& e2) const
     {
-        EdgeIncidence Ei(e1.size(), false);
-        std::transform(e1.begin(), e1.end(), e2.begin(), Ei.begin(), std::bit_xor<bool>());
-
+        EdgeIncidence Ei(e1);
+        Ei ^= e2;
         return Ei;
     }
 
-    int incidenceInnerProduct(EdgeIncidence& e1, EdgeIncidence& e2)
+    int incidenceInnerProduct(const EdgeIncidence& e1, const EdgeIncidence& e2) const
     {
-        int r1 = std::inner_product(e1.begin(), e1.end(), e2.begin(), 0);
-        return r1 % 2;
+        return e1.innerProductParity(e2);
     }
 
     void clear()
@@ -376,6 +439,11 @@ public:
             delete (*it);
         }
         pEdgesList.clear();
+        nodesByName.clear();
+        nodeIndices.clear();
+        edgeIndices.clear();
+        searchAdjency.clear();
+        searchAdjencyIsValid = false;
 
         pMinSpanningTree.clear();
         pMesh.clear();
@@ -384,6 +452,23 @@ public:
     }
 
 private:
+    /*!
+    ** \brief Add a loop to the mesh, for the witness i
+    **
+    ** The next witnesses which are not orthogonal to the loop are updated
+    */
+    void addLoop(VectorEdgeP&& loop, std::vector<EdgeIncidence>& witnesses, uint i);
+
+    //! Index of an edge in pEdgesList, -1 if not found
+    int edgeIndex(EdgeP e) const;
+
+    /*!
+    ** \brief Build searchAdjency if the grid has changed since the last call
+    **
+    ** Must be called before searching paths from several threads
+    */
+    void prepareSearches() const;
+
     //! \definition of the graph
     //@{
     //! list of nodes
@@ -392,6 +477,19 @@ private:
     VectorEdgeP pEdgesList;
     //@}
 
+    //! \name Indexes, to avoid linear searches on large grids
+    //@{
+    //! Nodes by name
+    std::unordered_map<std::string, NodeP> nodesByName;
+    //! Position of the nodes in pNodesList (nodes are never removed)
+    std::unordered_map<NodeP, uint> nodeIndices;
+    //! Position of the edges in pEdgesList (rebuilt lazily after a removal)
+    mutable std::unordered_map<EdgeP, uint> edgeIndices;
+    //! Neighbours (node index, edge) of each node, in the order of `adjency`
+    mutable std::vector<std::vector<std::pair<uint, EdgeP>>> searchAdjency;
+    mutable bool searchAdjencyIsValid = false;
+    //@}
+
     //! Minimum Spanning Tree of the graph
     VectorEdgeP pMinSpanningTree;
     //! Smallest set of loops meshing all the graph
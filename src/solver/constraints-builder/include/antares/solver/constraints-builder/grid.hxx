@@ -21,9 +21,12 @@
 #include <algorithm>
 #include <list>
 #include <numeric>
+#include <queue>
 #include <stack>
+#include <unordered_set>
 #include <utility>
 
+#include <antares/concurrency/concurrency.h>
 #include "antares/solver/constraints-builder/cbuilder.h"
 #include "antares/solver/constraints-builder/grid.h"
 
@@ -55,22 +58,17 @@ Grid<NodeT>::~Grid()
 template<class NodeT>
 typename Grid<NodeT>::NodeP Grid<NodeT>::addNode(NodeT& n, std::string id)
 {
-    auto nodeIT = std::find_if(pNodesList.begin(),
-                               pNodesList.end(),
-                               [&id](const NodeP& nodeP) -> bool
-                               { return nodeP->getName() == id; });
-
-    if (nodeIT == pNodesList.end())
-    {
-        NodeP newNode = new Graph::Node<NodeT>(&n);
-        newNode->setName(id);
-        pNodesList.push_back(newNode);
-        return newNode;
-    }
-    else
+    if (NodeP node = findNodeFromName(id))
     {
-        return *nodeIT;
+        return node;
     }
+
+    NodeP newNode = new Graph::Node<NodeT>(&n);
+    newNode->setName(id);
+    nodeIndices[newNode] = (uint)pNodesList.size();
+    pNodesList.push_back(newNode);
+    nodesByName[id] = newNode;
+    return newNode;
 }
 
 template<class NodeT>
@@ -85,7 +83,13 @@ typename Grid<NodeT>::EdgeP Grid<NodeT>::addEdge(NodeP n1, NodeP n2, long weight
         inf += weight;
         newEdge->setWeight(weight);
 
+        searchAdjencyIsValid = false;
+
         // add edge to the list
+        if (edgeIndices.size() == pEdgesList.size())
+        {
+            edgeIndices[newEdge] = (uint)pEdgesList.size();
+        }
         pEdgesList.push_back(newEdge);
 
         // redefine inf
@@ -103,6 +107,41 @@ typename Grid<NodeT>::EdgeP Grid<NodeT>::addEdge(NodeP n1, NodeP n2, long weight
     }
 }
 
+template<class NodeT>
+int Grid<NodeT>::edgeIndex(EdgeP e) const
+{
+    if (edgeIndices.size() != pEdgesList.size())
+    {
+        edgeIndices.clear();
+        for (uint i = 0; i != pEdgesList.size(); ++i)
+        {
+            edgeIndices[pEdgesList[i]] = i;
+        }
+    }
+    auto it = edgeIndices.find(e);
+    return it != edgeIndices.end() ? (int)it->second : -1;
+}
+
+template<class NodeT>
+void Grid<NodeT>::prepareSearches() const
+{
+    if (searchAdjencyIsValid)
+    {
+        return;
+    }
+    searchAdjency.assign(pNodesList.size(), {});
+    for (auto& [node, neighbours]: adjency)
+    {
+        auto& compact = searchAdjency[nodeIndices.at(node)];
+        compact.reserve(neighbours.size());
+        for (auto& [neighbour, edge]: neighbours)
+        {
+            compact.emplace_back(nodeIndices.at(neighbour), edge);
+        }
+    }
+    searchAdjencyIsValid = true;
+}
+
 template<class NodeT>
 uint Grid<NodeT>::getNumberOfConnectedComponents()
 {
@@ -147,13 +186,18 @@ void Grid<NodeT>::kruskal()
     // clear spanning tree
     pMinSpanningTree.clear();
 
-    // create union-find set
-    MapNodes uf;
-
-    for (auto i = pNodesList.begin(); i != pNodesList.end(); i++)
+    // create union-find set, on the node indices
+    std::vector<uint> uf(pNodesList.size());
+    std::iota(uf.begin(), uf.end(), 0);
+    auto findSet = [&uf](uint n)
     {
-        uf.insert(std::make_pair(*i, *i));
-    }
+        while (uf[n] != n)
+        {
+            uf[n] = uf[uf[n]];
+            n = uf[n];
+        }
+        return n;
+    };
 
     // create temporary sorted vector of Link
     VectorEdgeP tempEdgesList = pEdgesList;
@@ -164,26 +208,43 @@ void Grid<NodeT>::kruskal()
     // algorithm
     for (auto i = tempEdgesList.begin(); i != tempEdgesList.end(); i++)
     {
+        uint originSet = findSet(nodeIndices.at((*i)->getOrigin()));
+        uint destinationSet = findSet(nodeIndices.at((*i)->getDestination()));
         // if the two areas are not yet connected
-        if (uf[(*i)->getOrigin()] != uf[(*i)->getDestination()])
+        if (originSet != destinationSet)
         {
             pMinSpanningTree.push_back(*i);
+            uf[destinationSet] = originSet;
+        }
+    }
+}
 
-            // update uf
-            NodeP cset(uf[(*i)->getDestination()]);
-            for (auto j = pNodesList.begin(); j != pNodesList.end(); j++)
-            {
-                if (uf[*j] == cset)
-                {
-                    uf[*j] = uf[(*i)->getOrigin()];
-                }
-            }
+template<class NodeT>
+void Grid<NodeT>::addLoop(VectorEdgeP&& loop, std::vector<EdgeIncidence>& witnesses, uint i)
+{
+    std::vector<int> edgeIndicesOfCycle;
+    edgeIndicesOfCycle.reserve(loop.size());
+    for (EdgeP e: loop)
+    {
+        edgeIndicesOfCycle.push_back(edgeIndex(e));
+    }
+    EdgeIncidence I = getIncidenceVector(loop);
+    pMesh.push_back(std::move(loop));
+    meshIndexMatrix.push_back(std::move(edgeIndicesOfCycle));
+
+    // remplacement par la différence symétrique des des jeux d'arêtes
+    for (uint j = i + 1; j < witnesses.size(); j++)
+    {
+        if (I.innerProductParity(witnesses[j]) == 1)
+        {
+            witnesses[j] ^= witnesses[i];
         }
     }
 }
 
 template<class NodeT>
-bool Grid<NodeT>::buildMesh()
+bool Grid<NodeT>::buildMesh(Yuni::Job::QueueService* threads,
+                            const std::vector<std::vector<EdgeDefinition>>& previousMesh)
 {
     // build the minimum spanning tree
     kruskal();
@@ -198,12 +259,12 @@ bool Grid<NodeT>::buildMesh()
     meshIndexMatrix.clear();
 
     // initialization
+    std::unordered_set<EdgeP> skeleton(pMinSpanningTree.begin(), pMinSpanningTree.end());
     std::vector<EdgeP> linksToBeAdded;
     for (auto i = pEdgesList.begin(); i != pEdgesList.end(); i++)
     {
         // check if the link already belong to the skeleton
-        if (std::find(pMinSpanningTree.begin(), pMinSpanningTree.end(), (*i))
-            == pMinSpanningTree.end())
+        if (!skeleton.count(*i))
         {
             linksToBeAdded.push_back(*i);
         }
@@ -215,9 +276,53 @@ bool Grid<NodeT>::buildMesh()
         incidenceMatrix[i] = getIncidenceVector(linksToBeAdded[i]);
     }
 
-    for (uint i = 0; i < linksToBeAdded.size(); i++)
+    // The loops of the previous mesh whose edges are unchanged are still independent loops of
+    // the grid: each one is kept for the first witness it is not orthogonal to
+    uint first = 0;
+    for (auto& previousLoop: previousMesh)
     {
-        logs.info() << "Searching basis (loop " << i + 1 << "/" << linksToBeAdded.size() << ")";
+        VectorEdgeP loop;
+        for (auto& [origin, destination, weight]: previousLoop)
+        {
+            EdgeP e = findEdgeFromNodeNames(origin, destination);
+            if (!e || e->getWeight() != weight)
+            {
+                loop.clear();
+                break;
+            }
+            loop.push_back(e);
+        }
+        if (loop.empty())
+        {
+            continue;
+        }
+
+        EdgeIncidence I = getIncidenceVector(loop);
+        uint witness = first;
+        while (witness < incidenceMatrix.size()
+               && I.innerProductParity(incidenceMatrix[witness]) == 0)
+        {
+            ++witness;
+        }
+        if (witness == incidenceMatrix.size())
+        {
+            continue;
+        }
+        std::swap(incidenceMatrix[first], incidenceMatrix[witness]);
+        addLoop(std::move(loop), incidenceMatrix, first);
+        ++first;
+    }
+
+    if (!previousMesh.empty())
+    {
+        logs.info() << "Searching basis: " << first << " loops kept, "
+                    << linksToBeAdded.size() - first << " to search";
+    }
+
+    for (uint i = first; i < linksToBeAdded.size(); i++)
+    {
+        logs.info() << "Searching basis (loop " << i - first + 1 << "/"
+                    << linksToBeAdded.size() - first << ")";
         // build the graph with two copies (+/-) for each node and edge
         Grid<NodeT> polarisedDuplicate;
         getDuplicatedGrid(polarisedDuplicate);
@@ -225,17 +330,16 @@ bool Grid<NodeT>::buildMesh()
         VectorEdgeP Ci;
         //! vecteur contenant les sommets adjacents aux arêtes Ei
         VectorNodeP adjacentNodes;
+        std::unordered_set<NodeP> adjacentNodesSet;
         // retrait des arêtes (u,v) qui sont dans Ei et remplacement dans le graphe dupliqué
         // par(u+,v-) et (u-,v+)
         for (uint j = 0; j < v.size(); j++)
         {
-            if (std::find(adjacentNodes.begin(), adjacentNodes.end(), v[j]->getOrigin())
-                == adjacentNodes.end())
+            if (adjacentNodesSet.insert(v[j]->getOrigin()).second)
             {
                 adjacentNodes.push_back(v[j]->getOrigin());
             }
-            if (std::find(adjacentNodes.begin(), adjacentNodes.end(), v[j]->getDestination())
-                == adjacentNodes.end())
+            if (adjacentNodesSet.insert(v[j]->getDestination()).second)
             {
                 adjacentNodes.push_back(v[j]->getDestination());
             }
@@ -262,36 +366,20 @@ bool Grid<NodeT>::buildMesh()
         }
 
         //! extraction du chemin sur deux niveaux
-        v = polarisedDuplicate.twoLevelPath(adjacentNodes);
+        v = polarisedDuplicate.twoLevelPath(adjacentNodes, threads);
 
         //! définition du cycle correspondant dans le graph d'origine (non signé)
         Ci.clear();
-        std::vector<int> edgeIndices;
         for (typename VectorEdgeP::iterator e = v.begin(); e != v.end(); e++)
         {
             auto name1 = (*e)->getOrigin()->getName();
             name1 = name1.substr(0, name1.length() - 1);
             auto name2 = (*e)->getDestination()->getName();
             name2 = name2.substr(0, name2.length() - 1);
-            EdgeP ei = findEdgeFromNodeNames(name1, name2);
-            Ci.push_back(ei);
-
-            auto eIT = std::find(pEdgesList.begin(), pEdgesList.end(), ei);
-            int pos = (int)std::distance(pEdgesList.begin(), eIT);
-            edgeIndices.push_back(pos);
+            Ci.push_back(findEdgeFromNodeNames(name1, name2));
         }
 
-        pMesh.push_back(Ci);
-        EdgeIncidence I = getIncidenceVector(Ci);
-        meshIndexMatrix.push_back(edgeIndices);
-        // remplacement par la différence symétrique des des jeux d'arêtes
-        for (uint j = i + 1; j < linksToBeAdded.size(); j++)
-        {
-            if (incidenceInnerProduct(I, incidenceMatrix[j]) == 1)
-            {
-                incidenceMatrix[j] = incidenceXOR(incidenceMatrix[i], incidenceMatrix[j]);
-            }
-        }
+        addLoop(std::move(Ci), incidenceMatrix, i);
     }
 
     return true;
@@ -319,41 +407,16 @@ bool Grid<NodeT>::getDuplicatedGrid(Grid<NodeT>& grid)
     // Duplicate edges
     for (typename VectorEdgeP::iterator e = pEdgesList.begin(); e != pEdgesList.end(); e++)
     {
-        { //+
-            auto nodeOrigIT = std::find_if(grid.pNodesList.begin(),
-                                           grid.pNodesList.end(),
-                                           [&e](const NodeP& nodeP) -> bool {
-                                               return nodeP->getName()
-                                                      == (*e)->getOrigin()->getName() + "+";
-                                           });
-
-            auto nodeDestIT = std::find_if(grid.pNodesList.begin(),
-                                           grid.pNodesList.end(),
-                                           [&e](const NodeP& nodeP) -> bool {
-                                               return nodeP->getName()
-                                                      == (*e)->getDestination()->getName() + "+";
-                                           });
-
-            grid.addEdge(*nodeOrigIT, *nodeDestIT, (*e)->getWeight());
-        }
-
-        { //-
-            auto nodeOrigIT = std::find_if(grid.pNodesList.begin(),
-                                           grid.pNodesList.end(),
-                                           [&e](const NodeP& nodeP) -> bool {
-                                               return nodeP->getName()
-                                                      == (*e)->getOrigin()->getName() + "-";
-                                           });
-
-            auto nodeDestIT = std::find_if(grid.pNodesList.begin(),
-                                           grid.pNodesList.end(),
-                                           [&e](const NodeP& nodeP) -> bool {
-                                               return nodeP->getName()
-                                                      == (*e)->getDestination()->getName() + "-";
-                                           });
-
-            grid.addEdge(*nodeOrigIT, *nodeDestIT, (*e)->getWeight());
-        }
+        const std::string& origin = (*e)->getOrigin()->getName();
+        const std::string& destination = (*e)->getDestination()->getName();
+        //+
+        grid.addEdge(grid.findNodeFromName(origin + "+"),
+                     grid.findNodeFromName(destination + "+"),
+                     (*e)->getWeight());
+        //-
+        grid.addEdge(grid.findNodeFromName(origin + "-"),
+                     grid.findNodeFromName(destination + "-"),
+                     (*e)->getWeight());
     }
     return true;
 }
@@ -376,36 +439,48 @@ bool Grid<NodeT>::cloneGrid(Grid<NodeT>& grid)
     // duplicate edges
     for (typename VectorEdgeP::iterator e = pEdgesList.begin(); e != pEdgesList.end(); e++)
     {
-        { //+
-            auto nodeOrigIT = std::find_if(grid.pNodesList.begin(),
-                                           grid.pNodesList.end(),
-                                           [&e](const NodeP& nodeP) -> bool {
-                                               return nodeP->getName()
-                                                      == (*e)->getOrigin()->getName();
-                                           });
-
-            auto nodeDestIT = std::find_if(grid.pNodesList.begin(),
-                                           grid.pNodesList.end(),
-                                           [&e](const NodeP& nodeP) -> bool {
-                                               return nodeP->getName()
-                                                      == (*e)->getDestination()->getName();
-                                           });
-
-            grid.addEdge(*nodeOrigIT, *nodeDestIT, (*e)->getWeight());
-        }
+        grid.addEdge(grid.findNodeFromName((*e)->getOrigin()->getName()),
+                     grid.findNodeFromName((*e)->getDestination()->getName()),
+                     (*e)->getWeight());
     }
     return true;
 }
 
 template<class NodeT>
-typename Grid<NodeT>::VectorEdgeP Grid<NodeT>::twoLevelPath(VectorNodeP vN)
+typename Grid<NodeT>::VectorEdgeP Grid<NodeT>::twoLevelPath(const VectorNodeP& vN,
+                                                            Yuni::Job::QueueService* threads)
 {
-    VectorEdgeP SP, minSP;
+    // The searches are independent, and only read the grid
+    prepareSearches();
+    std::vector<VectorEdgeP> paths(vN.size());
+    auto search = [this, &vN, &paths](uint n)
+    {
+        paths[n] = findShortestPath(findNodeFromName(vN[n]->getName() + "+"),
+                                    findNodeFromName(vN[n]->getName() + "-"));
+    };
+
+    if (threads && vN.size() > 1)
+    {
+        Concurrency::FutureSet tasks;
+        for (uint n = 0; n != vN.size(); ++n)
+        {
+            tasks.add(Concurrency::AddTask(*threads, [&search, n] { search(n); }));
+        }
+        tasks.join();
+    }
+    else
+    {
+        for (uint n = 0; n != vN.size(); ++n)
+        {
+            search(n);
+        }
+    }
+
+    // The first shortest one, as if the searches were sequential
+    VectorEdgeP minSP;
     double minLength = DBL_MAX, length;
-    for (typename VectorNodeP::iterator n = vN.begin(); n != vN.end(); n++)
+    for (auto& SP: paths)
     {
-        SP = findShortestPath(findNodeFromName((*n)->getName() + "+"),
-                              findNodeFromName((*n)->getName() + "-"));
         length = std::accumulate(SP.begin(),
                                  SP.end(),
                                  (long)0,
@@ -413,7 +488,7 @@ typename Grid<NodeT>::VectorEdgeP Grid<NodeT>::twoLevelPath(VectorNodeP vN)
         if (length < minLength)
         {
             minLength = length;
-            minSP = SP;
+            minSP = std::move(SP);
         }
     }
 
@@ -426,69 +501,47 @@ typename Grid<NodeT>::VectorEdgeP Grid<NodeT>::findShortestPath(NodeP node1, Nod
 {
     assert(node1 != node2);
 
-    // Dijkstra (lots of computation which could be optimised)
-    // initialization
-    std::map<NodeP, double> dist;
-    std::map<NodeP, NodeP> prev;
+    prepareSearches();
+    const uint nodeCount = (uint)pNodesList.size();
+    const uint source = nodeIndices.at(node1);
+    const uint target = nodeIndices.at(node2);
 
-    // decorate to avoid warnings at compile
-    [[maybe_unused]] bool checkNode1(false), checkNode2(false);
-    VectorNodeP nodes = pNodesList;
+    std::vector<double> dist(nodeCount, inf);
+    std::vector<NodeP> prev(nodeCount, nullptr);
+    std::vector<bool> visited(nodeCount, false);
 
-    for (auto i = nodes.begin(); i != nodes.end(); i++)
+    // Nodes are visited by increasing distance, then by their position in pNodesList
+    // when at the same distance, so that the path does not depend on the container
+    using Candidate = std::pair<double, uint>;
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+
+    dist[source] = 0;
+    queue.push({0., source});
+    while (!queue.empty())
     {
-        dist[(*i)] = inf;
-        prev[(*i)] = 0;
-        if ((*i) == node1)
+        auto [d, u] = queue.top();
+        queue.pop();
+        if (visited[u] || d != dist[u])
         {
-            checkNode1 = true;
+            continue;
         }
-        else if ((*i) == node2)
+        if (u == target)
         {
-            checkNode2 = true;
-        }
-    }
-    assert(checkNode1 && checkNode2);
-    dist[node1] = 0;
-    // search for shortest path
-    bool targetFound(0);
-    while (!targetFound)
-    {
-        // look for closest element u belonging in nodes
-        std::pair<Grid::NodeP, double> u(nullptr, inf - 1);
-        typename Grid::VectorNodeP::iterator ui;
-        for (auto i = nodes.begin(); i != nodes.end(); i++)
-        {
-            if (dist[(*i)] < u.second)
-            {
-                u.first = (*i);
-                u.second = dist[(*i)];
-                ui = i;
-            }
-        }
-
-        // see if destination node has been f
-        if (u.first == node2)
-        {
-            targetFound = true;
             break;
         }
-
-        // remove u from the list of nodes
-        nodes.erase(ui);
+        visited[u] = true;
 
         // update the neighoubours of u
-        for (auto i = adjency.at(u.first).begin(); i != adjency.at(u.first).end(); i++)
+        NodeP uNode = pNodesList[u];
+        for (auto& [v, edge]: searchAdjency[u])
         {
-            if (i->second == nullptr)
-            {
-                assert(0);
-            }
+            assert(edge != nullptr);
 
-            if ((u.second + i->second->getWeight()) < dist[i->first])
+            if ((d + edge->getWeight()) < dist[v])
             {
-                dist[i->first] = u.second + i->second->getWeight();
-                prev[i->first] = u.first;
+                dist[v] = d + edge->getWeight();
+                prev[v] = uNode;
+                queue.push({dist[v], v});
             }
         }
     }
@@ -497,10 +550,11 @@ typename Grid<NodeT>::VectorEdgeP Grid<NodeT>::findShortestPath(NodeP node1, Nod
     Grid::VectorEdgeP path;
     Grid::NodeP currentNode = node2;
 
-    while (prev[currentNode] != nullptr)
+    while (prev[nodeIndices.at(currentNode)] != nullptr)
     {
-        path.push_back(adjency.at(currentNode).at(prev[currentNode]));
-        currentNode = prev[currentNode];
+        NodeP previous = prev[nodeIndices.at(currentNode)];
+        path.push_back(adjency.at(currentNode).at(previous));
+        currentNode = previous;
     }
 
     return path;
@@ -251,7 +251,7 @@ inline void HydroManagement::prepareDailyOptimalGenerations(
 
     const auto& dailyNbHoursAtGenPmax = area.hydro.dailyNbHoursAtGenPmax;
 
-    const auto& maxP = meanMaxDailyGenPower[tsIndex];
+    const auto& maxP = meanMaxDailyGenPower.timeSeries[tsIndex];
     const auto& maxE = dailyNbHoursAtGenPmax[0];
 
     auto& ventilationResults = ventilationResults_[area.index];
@@ -20,7 +20,7 @@
  */
 #include "antares/solver/infeasible-problem-analysis/constraint-slack-analysis.h"
 
-#include <regex>
+#include <algorithm>
 
 #include <antares/logs/logs.h>
 #include "antares/solver/infeasible-problem-analysis/report.h"
@@ -73,11 +73,10 @@ void ConstraintSlackAnalysis::run(MPSolver* problem)
 
 void ConstraintSlackAnalysis::selectConstraintsToWatch(MPSolver* problem)
 {
-    ConstraintsFactory factory;
-    std::regex rgx = factory.constraintsFilter();
+    const ConstraintsFactory factory;
     std::ranges::copy_if(problem->constraints(),
                          std::back_inserter(constraintsToWatch_),
-                         [&rgx](auto* c) { return std::regex_search(c->name(), rgx); });
+                         [&factory](auto* c) { return factory.isWatched(c->name()); });
 }
 
 void ConstraintSlackAnalysis::addSlackVariablesToConstraints(MPSolver* problem)
@@ -123,7 +122,12 @@ void ConstraintSlackAnalysis::buildObjective(MPSolver* problem) const
 
 void ConstraintSlackAnalysis::sortSlackVariablesByValue()
 {
-    std::sort(std::begin(slackVariables_), std::end(slackVariables_), ::greaterSlackSolutions);
+    // Only the largest ones are kept
+    const auto nbToSort = std::min<size_t>(nbMaxSlackVarsToKeep, slackVariables_.size());
+    std::partial_sort(std::begin(slackVariables_),
+                      std::begin(slackVariables_) + nbToSort,
+                      std::end(slackVariables_),
+                      ::greaterSlackSolutions);
 }
 
 void ConstraintSlackAnalysis::trimSlackVariables()
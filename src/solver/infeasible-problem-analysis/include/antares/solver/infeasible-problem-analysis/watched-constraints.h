@@ -4,8 +4,8 @@
 #include <functional>
 #include <map>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace Antares::Optimization
@@ -102,12 +102,17 @@ class ConstraintsFactory
 public:
     explicit ConstraintsFactory();
     std::unique_ptr<WatchedConstraint> create(const std::string&, const double) const;
-    std::regex constraintsFilter();
+    //! Whether a constraint name belongs to one of the watched types
+    bool isWatched(std::string_view name) const;
 
 private:
-    std::map<std::string,
-             std::function<std::unique_ptr<WatchedConstraint>(const std::string&, const double)>>
-      regex_to_ctypes_;
+    using Maker = std::function<std::unique_ptr<WatchedConstraint>(const std::string&,
+                                                                   const double)>;
+    const Maker* findMaker(std::string_view name) const;
+
+    // The keys are either "::tag::", found anywhere in the names, or "^Prefix::", found at their
+    // beginning. Simple string searches are much faster than regexes on large problems.
+    std::map<std::string, Maker> pattern_to_makers_;
 };
 
 } // namespace Antares::Optimization
@@ -158,7 +158,7 @@ std::string HydroProduction::infeasibilityCause()
 // --- Constraints factory ---
 ConstraintsFactory::ConstraintsFactory()
 {
-    regex_to_ctypes_ = {
+    pattern_to_makers_ = {
       {"::hourly::", std::make_unique<HourlyBC, const std::string&, const double>},
       {"::daily::", std::make_unique<DailyBC, const std::string&, const double>},
       {"::weekly::", std::make_unique<WeeklyBC, const std::string&, const double>},
@@ -168,24 +168,34 @@ ConstraintsFactory::ConstraintsFactory()
       {"^HydroPower::", std::make_unique<HydroProduction, const std::string&, const double>}};
 }
 
+const ConstraintsFactory::Maker* ConstraintsFactory::findMaker(std::string_view name) const
+{
+    auto it = std::ranges::find_if(pattern_to_makers_,
+                                   [name](auto& pair)
+                                   {
+                                       std::string_view key = pair.first;
+                                       if (key.front() == '^')
+                                       {
+                                           return name.starts_with(key.substr(1));
+                                       }
+                                       return name.find(key) != std::string_view::npos;
+                                   });
+    return it != pattern_to_makers_.end() ? &it->second : nullptr;
+}
+
 std::unique_ptr<WatchedConstraint> ConstraintsFactory::create(const std::string& name,
                                                               const double value) const
 {
-    auto it = std::ranges::find_if(regex_to_ctypes_,
-                                   [&name](auto& pair)
-                                   { return std::regex_search(name, std::regex(pair.first)); });
-    if (it != regex_to_ctypes_.end())
+    if (const Maker* maker = findMaker(name))
     {
-        return it->second(name, value);
+        return (*maker)(name, value);
     }
     return nullptr;
 }
 
-std::regex ConstraintsFactory::constraintsFilter()
+bool ConstraintsFactory::isWatched(std::string_view name) const
 {
-    auto keyView = std::views::keys(regex_to_ctypes_);
-    std::vector<std::string> regex_ids = {keyView.begin(), keyView.end()};
-    return std::regex(boost::algorithm::join(regex_ids, "|"));
+    return findMaker(name) != nullptr;
 }
 
 } // namespace Antares::Optimization
@@ -22,6 +22,8 @@
 #define __SOLVER_MISC_GETOPT_H__
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <yuni/yuni.h>
 #include <yuni/core/getopt.h>
@@ -61,6 +63,19 @@ public:
     bool noOutput = false;
     //! Progression
     bool displayProgression = false;
+    //! Keep the study loaded and run the simulations requested on the standard input
+    bool serviceMode = false;
+
+    //! Shard of the MC years to perform, as given in command line ("i/n")
+    Yuni::String shard;
+    //! Zero-based index of the shard
+    uint shardIndex = 0;
+    //! Number of shards, 0 when the simulation is not sharded
+    uint shardCount = 0;
+    //! Output folders of the shards to merge, as given in command line (comma-separated)
+    Yuni::String mergeShards;
+    //! Output folders of the shards to merge
+    std::vector<std::string> shardsToMerge;
 
     Yuni::String PID;
     bool forceZipOutput = false;
@@ -75,5 +90,12 @@ std::unique_ptr<Yuni::GetOpt::Parser> CreateParser(Settings& settings,
 
 void checkAndCorrectSettingsAndOptions(Settings& settings, Data::StudyLoadOptions& options);
 
+/*!
+** \brief Parse the --shard and --merge-shards options
+**
+** \throw Error::InvalidShardOptions
+*/
+void checkShardOptions(Settings& settings);
+
 void checkOrtoolsSolver(const Antares::Solver::Optimization::OptimizationOptions& optOptions);
 #endif /* __SOLVER_MISC_GETOPT_H__ */
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <charconv>
 #include <fstream>
 #include <limits>
 #include <string.h>
@@ -100,6 +101,27 @@ std::unique_ptr<Yuni::GetOpt::Parser> CreateParser(Settings& settings, StudyLoad
       "--solver-parameters=\"param1 value1 param2 value2\". The syntax of parameters is solver "
       "specfic, examples are given in Antares-Simulator online documentation.");
 
+    //--solver-racing
+    parser->add(options.optOptions.racingSolver,
+                ' ',
+                "solver-racing",
+                "Race this ortools solver against the main one on the slowest weeks, and keep the "
+                "first optimal solution (only available with use-ortools option)");
+
+    //--aggregate-thermal-clusters
+    parser->addFlag(options.optOptions.aggregateThermalClusters,
+                    ' ',
+                    "aggregate-thermal-clusters",
+                    "Optimize the thermal clusters of an area sharing the same parameters as a "
+                    "single cluster (reduced model for screening runs)");
+
+    //--presolve
+    parser->addFlag(options.optOptions.presolve,
+                    ' ',
+                    "presolve",
+                    "Remove the fixed variables and the constraints left empty from the weekly "
+                    "problems before calling the solver");
+
     parser->addParagraph("\nParameters");
     // --name
     parser->add(settings.simulationName,
@@ -133,6 +155,11 @@ std::unique_ptr<Yuni::GetOpt::Parser> CreateParser(Settings& settings, StudyLoad
                     "Force the writing the result output for each year (economy only)");
     // --derated
     parser->addFlag(options.forceDerated, ' ', "derated", "Force the derated mode");
+    // --playlist-series-only
+    parser->addFlag(options.playlistSeriesOnly,
+                    ' ',
+                    "playlist-series-only",
+                    "Only load the time-series used by the MC years of the playlist");
 
     // --output-force-zip
     parser->addFlag(settings.forceZipOutput,
@@ -174,6 +201,28 @@ std::unique_ptr<Yuni::GetOpt::Parser> CreateParser(Settings& settings, StudyLoad
     parser->addFlag(options.optOptions.solverLogs, ' ', "solver-logs", "Print solver logs.");
 
     parser->addParagraph("\nMisc.");
+    // --service
+    parser->addFlag(settings.serviceMode,
+                    ' ',
+                    "service",
+                    "Keep the study loaded and run the simulations requested on the standard "
+                    "input, one per line ('run [name=..] [playlist=1,3-5] [rules=..] "
+                    "[year-by-year=true|false]' or 'quit')");
+
+    // --shard
+    parser->add(settings.shard,
+                ' ',
+                "shard",
+                "Only perform the shard i/n of the MC years of the playlist and save its partial "
+                "results, to be merged with --merge-shards (the synthesis is not written)");
+
+    // --merge-shards
+    parser->add(settings.mergeShards,
+                ' ',
+                "merge-shards",
+                "Merge the outputs of all the shards of a simulation (comma-separated folders) "
+                "and write the synthesis, as a single simulation would");
+
     // --progress
     parser->addFlag(settings.displayProgression,
                     ' ',
@@ -262,6 +311,58 @@ void checkAndCorrectSettingsAndOptions(Settings& settings, Data::StudyLoadOption
     {
         throw Error::IncompatibleOutputOptions("no-output and zip-output options are incompatible");
     }
+
+    // The other playlists requested in service mode may need any time-series
+    if (options.playlistSeriesOnly && settings.serviceMode)
+    {
+        throw Error::IncompatibleServiceOptions(
+          "playlist-series-only and service options are incompatible");
+    }
+
+    checkShardOptions(settings);
+}
+
+void checkShardOptions(Settings& settings)
+{
+    if (!settings.shard.empty())
+    {
+        const std::string shard = settings.shard.to<std::string>();
+        uint index = 0;
+        uint count = 0;
+        const char* end = shard.data() + shard.size();
+        auto [separator, ec] = std::from_chars(shard.data(), end, index);
+        bool valid = ec == std::errc() && separator != end && *separator == '/';
+        if (valid)
+        {
+            auto [last, ec2] = std::from_chars(separator + 1, end, count);
+            valid = ec2 == std::errc() && last == end && 1 <= index && index <= count;
+        }
+        if (!valid)
+        {
+            throw Error::InvalidShardOptions(
+              "Invalid command line value for --shard ('i/n' expected, with 1 <= i <= n)");
+        }
+        settings.shardIndex = index - 1;
+        settings.shardCount = count;
+    }
+
+    if (!settings.mergeShards.empty())
+    {
+        settings.mergeShards.split(settings.shardsToMerge, ",");
+    }
+
+    const bool merging = !settings.shardsToMerge.empty();
+    if (settings.shardCount && merging)
+    {
+        throw Error::InvalidShardOptions("shard and merge-shards options are incompatible");
+    }
+    if ((settings.shardCount || merging)
+        && (settings.noOutput || settings.serviceMode || settings.tsGeneratorsOnly))
+    {
+        throw Error::InvalidShardOptions(
+          "shard and merge-shards options are incompatible with no-output, service and "
+          "generators-only options");
+    }
 }
 
 void checkOrtoolsSolver(const Antares::Solver::Optimization::OptimizationOptions& optOptions)
@@ -279,6 +380,33 @@ void checkOrtoolsSolver(const Antares::Solver::Optimization::OptimizationOptions
             throw Error::InvalidSolver(optOptions.ortoolsSolver, availableOrToolsSolversString());
         }
     }
+
+    if (!optOptions.racingSolver.empty())
+    {
+        // The main resolution must be interruptible, hence run through ortools
+        if (!optOptions.ortoolsUsed)
+        {
+            throw Error::InvalidSolverRacing("solver-racing requires the use-ortools option");
+        }
+        const std::list<std::string> availableSolverList = getAvailableOrtoolsSolverName();
+        if (std::find(availableSolverList.begin(),
+                      availableSolverList.end(),
+                      optOptions.racingSolver)
+            == availableSolverList.end())
+        {
+            throw Error::InvalidSolver(optOptions.racingSolver, availableOrToolsSolversString());
+        }
+        // The loser of a race is interrupted
+        for (const auto& solverName: {optOptions.ortoolsSolver, optOptions.racingSolver})
+        {
+            if (!ortoolsSolverSupportsInterruption(solverName))
+            {
+                throw Error::InvalidSolverRacing("solver-racing requires solvers which can be "
+                                                 "interrupted, which is not the case of "
+                                                 + solverName);
+            }
+        }
+    }
 }
 
 void Settings::checkAndSetStudyFolder(const std::string& folder)
@@ -312,6 +440,12 @@ void Settings::reset()
     tsGeneratorsOnly = false;
     noOutput = false;
     displayProgression = false;
+    serviceMode = false;
+    shard.clear();
+    shardIndex = 0;
+    shardCount = 0;
+    mergeShards.clear();
+    shardsToMerge.clear();
     ignoreConstraints = false;
     forceZipOutput = false;
 }
@@ -0,0 +1,351 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+#include "antares/solver/optimisation/LinearProblemPresolve.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
+
+#include "spx_constantes_externes.h"
+
+namespace
+{
+constexpr double feasibilityTolerance = 1e-6;
+
+bool isFixed(const PROBLEME_ANTARES_A_RESOUDRE& problem, int var)
+{
+    const int type = problem.TypeDeVariable[var];
+    return (type == VARIABLE_FIXE || type == VARIABLE_BORNEE_DES_DEUX_COTES)
+           && problem.Xmin[var] == problem.Xmax[var] && std::isfinite(problem.Xmin[var]);
+}
+
+bool hasLowerBound(int type)
+{
+    return type == VARIABLE_FIXE || type == VARIABLE_BORNEE_DES_DEUX_COTES
+           || type == VARIABLE_BORNEE_INFERIEUREMENT;
+}
+
+bool hasUpperBound(int type)
+{
+    return type == VARIABLE_FIXE || type == VARIABLE_BORNEE_DES_DEUX_COTES
+           || type == VARIABLE_BORNEE_SUPERIEUREMENT;
+}
+
+// An inequality which the bounds of its variables are enough to satisfy
+bool isRedundant(const PROBLEME_ANTARES_A_RESOUDRE& problem, int cnt)
+{
+    const char sense = problem.Sens[cnt];
+    if (sense != '<' && sense != '>')
+    {
+        return false;
+    }
+
+    // Highest value of the left-hand side for '<', lowest for '>'
+    double bound = 0.;
+    const int first = problem.IndicesDebutDeLigne[cnt];
+    const int last = first + problem.NombreDeTermesDesLignes[cnt];
+    for (int term = first; term < last; ++term)
+    {
+        const int var = problem.IndicesColonnes[term];
+        const double coefficient = problem.CoefficientsDeLaMatriceDesContraintes[term];
+        const int type = problem.TypeDeVariable[var];
+        const bool upper = (coefficient > 0.) == (sense == '<');
+        if (upper ? !hasUpperBound(type) : !hasLowerBound(type))
+        {
+            return false;
+        }
+        bound += coefficient * (upper ? problem.Xmax[var] : problem.Xmin[var]);
+    }
+    if (!std::isfinite(bound))
+    {
+        return false;
+    }
+    return sense == '<' ? bound <= problem.SecondMembre[cnt] : bound >= problem.SecondMembre[cnt];
+}
+
+bool isSatisfied(char sense, double lhs, double rhs)
+{
+    const double tolerance = feasibilityTolerance * std::max(1., std::abs(rhs));
+    switch (sense)
+    {
+    case '<':
+        return lhs <= rhs + tolerance;
+    case '>':
+        return lhs >= rhs - tolerance;
+    default:
+        return std::abs(lhs - rhs) <= tolerance;
+    }
+}
+} // namespace
+
+namespace Antares::Optimization
+{
+LinearProblemPresolve::LinearProblemPresolve() = default;
+LinearProblemPresolve::~LinearProblemPresolve() = default;
+
+bool LinearProblemPresolve::matches(const PROBLEME_ANTARES_A_RESOUDRE& problem) const
+{
+    if (!reduced_ || problem.NombreDeVariables != (int)newIndexOfVariable_.size()
+        || problem.NombreDeContraintes
+             != (int)(keptConstraints_.size() + removedConstraints_.size()
+                      + redundantConstraints_.size()))
+    {
+        return false;
+    }
+    for (int var = 0; var < problem.NombreDeVariables; ++var)
+    {
+        if (newIndexOfVariable_[var] < 0 && !isFixed(problem, var))
+        {
+            return false;
+        }
+    }
+    return std::all_of(redundantConstraints_.begin(),
+                       redundantConstraints_.end(),
+                       [&problem](int cnt) { return isRedundant(problem, cnt); });
+}
+
+void LinearProblemPresolve::build(const PROBLEME_ANTARES_A_RESOUDRE& problem)
+{
+    const int nbVariables = problem.NombreDeVariables;
+    const int nbConstraints = problem.NombreDeContraintes;
+
+    newIndexOfVariable_.assign(nbVariables, -1);
+    keptVariables_.clear();
+    for (int var = 0; var < nbVariables; ++var)
+    {
+        if (!isFixed(problem, var))
+        {
+            newIndexOfVariable_[var] = (int)keptVariables_.size();
+            keptVariables_.push_back(var);
+        }
+    }
+
+    reduced_ = std::make_unique<PROBLEME_ANTARES_A_RESOUDRE>();
+    auto& reduced = *reduced_;
+    keptConstraints_.clear();
+    removedConstraints_.clear();
+    redundantConstraints_.clear();
+    for (int cnt = 0; cnt < nbConstraints; ++cnt)
+    {
+        if (isRedundant(problem, cnt))
+        {
+            redundantConstraints_.push_back(cnt);
+            continue;
+        }
+
+        const int first = problem.IndicesDebutDeLigne[cnt];
+        const int last = first + problem.NombreDeTermesDesLignes[cnt];
+        const int start = (int)reduced.IndicesColonnes.size();
+        for (int term = first; term < last; ++term)
+        {
+            const int var = newIndexOfVariable_[problem.IndicesColonnes[term]];
+            if (var >= 0)
+            {
+                reduced.IndicesColonnes.push_back(var);
+                reduced.CoefficientsDeLaMatriceDesContraintes.push_back(
+                  problem.CoefficientsDeLaMatriceDesContraintes[term]);
+            }
+        }
+
+        const int nbTerms = (int)reduced.IndicesColonnes.size() - start;
+        if (nbTerms == 0)
+        {
+            removedConstraints_.push_back(cnt);
+            continue;
+        }
+        keptConstraints_.push_back(cnt);
+        reduced.IndicesDebutDeLigne.push_back(start);
+        reduced.NombreDeTermesDesLignes.push_back(nbTerms);
+    }
+
+    const int nbKeptVariables = (int)keptVariables_.size();
+    const int nbKeptConstraints = (int)keptConstraints_.size();
+    reduced.NombreDeVariables = nbKeptVariables;
+    reduced.NombreDeContraintes = nbKeptConstraints;
+    reduced.NombreDeTermesDansLaMatriceDesContraintes = (int)reduced.IndicesColonnes.size();
+    reduced.NombreDeTermesAllouesDansLaMatriceDesContraintes = reduced
+                                                                 .NombreDeTermesDansLaMatriceDesContraintes;
+    reduced.IncrementDAllocationMatriceDesContraintes = 0;
+
+    reduced.CoutLineaire.resize(nbKeptVariables);
+    reduced.TypeDeVariable.resize(nbKeptVariables);
+    reduced.Xmin.resize(nbKeptVariables);
+    reduced.Xmax.resize(nbKeptVariables);
+    reduced.X.resize(nbKeptVariables);
+    reduced.CoutsReduits.resize(nbKeptVariables);
+    reduced.PositionDeLaVariable.resize(nbKeptVariables);
+    reduced.NomDesVariables.resize(nbKeptVariables);
+    reduced.VariablesEntieres.resize(nbKeptVariables);
+    for (int var = 0; var < nbKeptVariables; ++var)
+    {
+        reduced.NomDesVariables[var] = problem.NomDesVariables[keptVariables_[var]];
+        reduced.VariablesEntieres[var] = problem.VariablesEntieres[keptVariables_[var]];
+    }
+
+    reduced.Sens.resize(nbKeptConstraints);
+    reduced.SecondMembre.resize(nbKeptConstraints);
+    reduced.CoutsMarginauxDesContraintes.resize(nbKeptConstraints);
+    reduced.ComplementDeLaBase.resize(nbKeptConstraints);
+    reduced.NomDesContraintes.resize(nbKeptConstraints);
+    for (int cnt = 0; cnt < nbKeptConstraints; ++cnt)
+    {
+        reduced.NomDesContraintes[cnt] = problem.NomDesContraintes[keptConstraints_[cnt]];
+    }
+}
+
+void LinearProblemPresolve::clear()
+{
+    reduced_.reset();
+    newIndexOfVariable_.clear();
+    keptVariables_.clear();
+    keptConstraints_.clear();
+    removedConstraints_.clear();
+    redundantConstraints_.clear();
+}
+
+bool LinearProblemPresolve::update(const PROBLEME_ANTARES_A_RESOUDRE& problem)
+{
+    auto& reduced = *reduced_;
+
+    for (int var = 0; var < reduced.NombreDeVariables; ++var)
+    {
+        const int old = keptVariables_[var];
+        reduced.CoutLineaire[var] = problem.CoutLineaire[old];
+        reduced.TypeDeVariable[var] = problem.TypeDeVariable[old];
+        reduced.Xmin[var] = problem.Xmin[old];
+        reduced.Xmax[var] = problem.Xmax[old];
+    }
+
+    // Contribution of the fixed variables to a constraint
+    auto fixedPart = [&problem, this](int cnt)
+    {
+        double value = 0.;
+        const int first = problem.IndicesDebutDeLigne[cnt];
+        const int last = first + problem.NombreDeTermesDesLignes[cnt];
+        for (int term = first; term < last; ++term)
+        {
+            const int var = problem.IndicesColonnes[term];
+            if (newIndexOfVariable_[var] < 0)
+            {
+                value += problem.CoefficientsDeLaMatriceDesContraintes[term] * problem.Xmin[var];
+            }
+        }
+        return value;
+    };
+
+    for (int cnt = 0; cnt < reduced.NombreDeContraintes; ++cnt)
+    {
+        const int old = keptConstraints_[cnt];
+        reduced.Sens[cnt] = problem.Sens[old];
+        reduced.SecondMembre[cnt] = problem.SecondMembre[old] - fixedPart(old);
+    }
+
+    return std::all_of(removedConstraints_.begin(),
+                       removedConstraints_.end(),
+                       [&problem, &fixedPart](int cnt) {
+                           return isSatisfied(problem.Sens[cnt],
+                                              fixedPart(cnt),
+                                              problem.SecondMembre[cnt]);
+                       });
+}
+
+void LinearProblemPresolve::postsolve(PROBLEME_ANTARES_A_RESOUDRE& problem) const
+{
+    const auto& reduced = *reduced_;
+    problem.ExistenceDUneSolution = reduced.ExistenceDUneSolution;
+
+    const bool isMIP = std::any_of(reduced.VariablesEntieres.begin(),
+                                   reduced.VariablesEntieres.end(),
+                                   [](bool integer) { return integer; });
+
+    for (int var = 0; var < problem.NombreDeVariables; ++var)
+    {
+        const int index = newIndexOfVariable_[var];
+        if (index >= 0)
+        {
+            problem.X[var] = reduced.X[index];
+            problem.CoutsReduits[var] = reduced.CoutsReduits[index];
+            problem.PositionDeLaVariable[var] = reduced.PositionDeLaVariable[index];
+        }
+        else
+        {
+            problem.X[var] = problem.Xmin[var];
+            // No marginal cost is given by the solver for a MIP
+            problem.CoutsReduits[var] = isMIP ? 0. : problem.CoutLineaire[var];
+        }
+    }
+
+    for (const auto* removed: {&removedConstraints_, &redundantConstraints_})
+    {
+        for (int cnt: *removed)
+        {
+            problem.CoutsMarginauxDesContraintes[cnt] = 0.;
+        }
+    }
+    for (int cnt = 0; cnt < reduced.NombreDeContraintes; ++cnt)
+    {
+        const int old = keptConstraints_[cnt];
+        const double dual = reduced.CoutsMarginauxDesContraintes[cnt];
+        problem.CoutsMarginauxDesContraintes[old] = dual;
+        problem.ComplementDeLaBase[old] = reduced.ComplementDeLaBase[cnt];
+        if (isMIP || dual == 0.)
+        {
+            continue;
+        }
+
+        // Reduced cost of a removed variable: its cost minus the marginal costs of its terms
+        const int first = problem.IndicesDebutDeLigne[old];
+        const int last = first + problem.NombreDeTermesDesLignes[old];
+        for (int term = first; term < last; ++term)
+        {
+            const int var = problem.IndicesColonnes[term];
+            if (newIndexOfVariable_[var] < 0)
+            {
+                problem.CoutsReduits[var] -= problem.CoefficientsDeLaMatriceDesContraintes[term]
+                                             * dual;
+            }
+        }
+    }
+
+    // A removed variable is out of the basis, at the bound its reduced cost pushes it to
+    for (int var = 0; var < problem.NombreDeVariables; ++var)
+    {
+        if (newIndexOfVariable_[var] < 0)
+        {
+            problem.PositionDeLaVariable[var] = problem.CoutsReduits[var] < 0.
+                                                  ? HORS_BASE_SUR_BORNE_SUP
+                                                  : HORS_BASE_SUR_BORNE_INF;
+        }
+    }
+}
+
+int LinearProblemPresolve::removedVariables() const
+{
+    return (int)(newIndexOfVariable_.size() - keptVariables_.size());
+}
+
+int LinearProblemPresolve::removedConstraints() const
+{
+    return (int)(removedConstraints_.size() + redundantConstraints_.size());
+}
+} // namespace Antares::Optimization
@@ -79,7 +79,7 @@ void CsrAreaBalance::add()
 
         data.numberOfConstraintCsrAreaBalance[Area] = builder.data.nombreDeContraintes;
 
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateTimeStep(data.hour);
         namer.UpdateArea(builder.data.NomsDesPays[Area]);
         namer.CsrAreaBalance(builder.data.nombreDeContraintes);
@@ -52,7 +52,7 @@ void CsrBindingConstraintHour::add(int CntCouplante)
     {
         data.numberOfConstraintCsrHourlyBinding[CntCouplante] = builder.data.nombreDeContraintes;
 
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateTimeStep(data.hour);
         namer.CsrBindingConstraintHour(
           builder.data.nombreDeContraintes,
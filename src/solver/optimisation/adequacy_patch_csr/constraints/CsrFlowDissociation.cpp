@@ -25,7 +25,7 @@ void CsrFlowDissociation::add()
 {
     builder.updateHourWithinWeek(data.hour);
 
-    ConstraintNamer namer(builder.data.NomDesContraintes);
+    ConstraintNamer namer(builder.data.DescriptionDesContraintes);
     namer.UpdateTimeStep(data.hour);
     // constraint: Flow = Flow_direct - Flow_indirect (+ loop flow) for links between nodes
     // of type 2.
@@ -38,6 +38,7 @@ extern "C"
 #include "pi_fonctions.h"
 }
 
+#include <antares/logs/async_logs.h>
 #include <antares/logs/logs.h>
 
 using namespace Antares;
@@ -124,9 +125,9 @@ void storeOrDisregardInteriorPointResults(const PROBLEME_ANTARES_A_RESOUDRE& Pro
 
     if (checkCost)
     {
-        logs.info() << "[adq-patch] costPriorToCsr: " << costPriorToCsr
-                    << ", costAfterCsr: " << costAfterCsr
-                    << ", deltaCost: " << costAfterCsr - costPriorToCsr;
+        AsyncLogs::info() << "[adq-patch] costPriorToCsr: " << costPriorToCsr
+                          << ", costAfterCsr: " << costAfterCsr
+                          << ", deltaCost: " << costAfterCsr - costPriorToCsr;
     }
 
     if (!checkCost || (checkCost && deltaCost < 0.0))
@@ -135,7 +136,7 @@ void storeOrDisregardInteriorPointResults(const PROBLEME_ANTARES_A_RESOUDRE& Pro
     }
     else if (checkCost && deltaCost >= 0.0)
     {
-        logs.warning()
+        AsyncLogs::warning()
           << "[adq-patch] CSR optimization is providing solution with greater costs, optimum "
              "solution is set as LMR . year: "
           << yearNb + 1 << ". hour: " << weekNb * hoursInWeek + hourlyCsrProblem.triggeredHour + 1;
@@ -37,7 +37,7 @@ void AreaBalance::add(int pdt, int pays)
     data.CorrespondanceCntNativesCntOptim[pdt].NumeroDeContrainteDesBilansPays[pays]
       = builder.data.nombreDeContraintes;
 
-    ConstraintNamer namer(builder.data.NomDesContraintes);
+    ConstraintNamer namer(builder.data.DescriptionDesContraintes);
     namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
     namer.UpdateArea(builder.data.NomsDesPays[pays]);
     namer.AreaBalance(builder.data.nombreDeContraintes);
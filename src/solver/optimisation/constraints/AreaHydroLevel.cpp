@@ -32,7 +32,7 @@ void AreaHydroLevel::add(int pays, int pdt)
         {
             builder.updateHourWithinWeek(pdt - 1).HydroLevel(pays, -1.0);
         }
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
 
         namer.UpdateArea(builder.data.NomsDesPays[pays]);
         namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
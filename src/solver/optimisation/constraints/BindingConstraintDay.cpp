@@ -81,7 +81,7 @@ void BindingConstraintDay::add(int cntCouplante)
 
         builder.SetOperator(MatriceDesContraintesCouplantes.SensDeLaContrainteCouplante);
         {
-            ConstraintNamer namer(builder.data.NomDesContraintes);
+            ConstraintNamer namer(builder.data.DescriptionDesContraintes);
             namer.UpdateTimeStep(jour);
             namer.BindingConstraintDay(builder.data.nombreDeContraintes,
                                        MatriceDesContraintesCouplantes.NomDeLaContrainteCouplante);
@@ -70,7 +70,7 @@ void BindingConstraintHour::add(int pdt, int cntCouplante)
 
     builder.SetOperator(MatriceDesContraintesCouplantes.SensDeLaContrainteCouplante);
     {
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
         namer.BindingConstraintHour(builder.data.nombreDeContraintes,
                                     MatriceDesContraintesCouplantes.NomDeLaContrainteCouplante);
@@ -71,7 +71,7 @@ void BindingConstraintWeek::add(int cntCouplante)
     data.NumeroDeContrainteDesContraintesCouplantes[cntCouplante] = builder.data
                                                                       .nombreDeContraintes;
 
-    ConstraintNamer namer(builder.data.NomDesContraintes);
+    ConstraintNamer namer(builder.data.DescriptionDesContraintes);
     namer.UpdateTimeStep(semaine);
     namer.BindingConstraintWeek(builder.data.nombreDeContraintes,
                                 MatriceDesContraintesCouplantes.NomDeLaContrainteCouplante);
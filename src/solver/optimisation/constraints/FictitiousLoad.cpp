@@ -26,7 +26,7 @@ void FictitiousLoad::add(int pdt, int pays)
     data.CorrespondanceCntNativesCntOptim[pdt].NumeroDeContraintePourEviterLesChargesFictives[pays]
       = builder.data.nombreDeContraintes;
 
-    ConstraintNamer namer(builder.data.NomDesContraintes);
+    ConstraintNamer namer(builder.data.DescriptionDesContraintes);
 
     namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
     namer.UpdateArea(builder.data.NomsDesPays[pays]);
@@ -29,7 +29,7 @@ void FinalStockEquivalent::add(int pays)
     { /*  equivalence constraint : StockFinal- Niveau[T]= 0*/
 
         data.NumeroDeContrainteEquivalenceStockFinal[pays] = builder.data.nombreDeContraintes;
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
 
         namer.UpdateArea(builder.data.NomsDesPays[pays]);
         namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
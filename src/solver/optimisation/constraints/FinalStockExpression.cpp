@@ -35,7 +35,7 @@ void FinalStockExpression::add(int pays)
         }
         data.NumeroDeContrainteExpressionStockFinal[pays] = builder.data.nombreDeContraintes;
 
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
 
         namer.UpdateArea(builder.data.NomsDesPays[pays]);
         namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
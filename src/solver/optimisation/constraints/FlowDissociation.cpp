@@ -31,7 +31,7 @@ void FlowDissociation::add(int pdt, int interco)
         const auto origin = builder.data.NomsDesPays[data.PaysOrigineDeLInterconnexion[interco]];
         const auto destination = builder.data
                                    .NomsDesPays[data.PaysExtremiteDeLInterconnexion[interco]];
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
         namer.FlowDissociation(builder.data.nombreDeContraintes, origin, destination);
 
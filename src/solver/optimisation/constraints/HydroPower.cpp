@@ -52,7 +52,7 @@ void HydroPower::add(int pays)
         data.NumeroDeContrainteEnergieHydraulique[pays] = builder.data.nombreDeContraintes;
 
         builder.equalTo();
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateArea(builder.data.NomsDesPays[pays]);
         namer.UpdateTimeStep(builder.data.weekInTheYear);
         namer.HydroPower(builder.data.nombreDeContraintes);
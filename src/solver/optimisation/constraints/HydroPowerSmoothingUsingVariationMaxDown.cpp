@@ -23,7 +23,7 @@
 
 void HydroPowerSmoothingUsingVariationMaxDown::add(int pays, int pdt)
 {
-    ConstraintNamer namer(builder.data.NomDesContraintes);
+    ConstraintNamer namer(builder.data.DescriptionDesContraintes);
     namer.UpdateArea(builder.data.NomsDesPays[pays]);
     namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
     namer.HydroPowerSmoothingUsingVariationMaxDown(builder.data.nombreDeContraintes);
@@ -23,7 +23,7 @@
 
 void HydroPowerSmoothingUsingVariationMaxUp::add(int pays, int pdt)
 {
-    ConstraintNamer namer(builder.data.NomDesContraintes);
+    ConstraintNamer namer(builder.data.DescriptionDesContraintes);
     namer.UpdateArea(builder.data.NomsDesPays[pays]);
     namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
     namer.HydroPowerSmoothingUsingVariationMaxUp(builder.data.nombreDeContraintes);
@@ -31,7 +31,7 @@ void HydroPowerSmoothingUsingVariationSum::add(int pays,
         {
             pdt1 = 0;
         }
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateArea(builder.data.NomsDesPays[pays]);
         namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
         namer.HydroPowerSmoothingUsingVariationSum(builder.data.nombreDeContraintes);
@@ -36,7 +36,7 @@ void MaxHydroPower::add(int pays)
         }
         data.NumeroDeContrainteMaxEnergieHydraulique[pays] = builder.data.nombreDeContraintes;
 
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateArea(builder.data.NomsDesPays[pays]);
         namer.UpdateTimeStep(builder.data.weekInTheYear);
         namer.MaxHydroPower(builder.data.nombreDeContraintes);
@@ -33,7 +33,7 @@ void MaxPumping::add(int pays)
             builder.Pumping(pays, 1.0);
         }
         data.NumeroDeContrainteMaxPompage[pays] = builder.data.nombreDeContraintes;
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateArea(builder.data.NomsDesPays[pays]);
         namer.UpdateTimeStep(builder.data.weekInTheYear);
         namer.MaxPumping(builder.data.nombreDeContraintes);
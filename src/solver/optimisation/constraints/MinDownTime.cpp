@@ -54,7 +54,7 @@ void MinDownTime::add(int pays, int index, int pdt)
             data.CorrespondanceCntNativesCntOptim[pdt]
               .NumeroDeContrainteDesContraintesDeDureeMinDArret[cluster]
               = builder.data.nombreDeContraintes;
-            ConstraintNamer namer(builder.data.NomDesContraintes);
+            ConstraintNamer namer(builder.data.DescriptionDesContraintes);
             namer.UpdateArea(builder.data.NomsDesPays[pays]);
 
             namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
@@ -29,7 +29,7 @@ void MinHydroPower::add(int pays)
     {
         data.NumeroDeContrainteMinEnergieHydraulique[pays] = builder.data.nombreDeContraintes;
 
-        ConstraintNamer namer(builder.data.NomDesContraintes);
+        ConstraintNamer namer(builder.data.DescriptionDesContraintes);
         namer.UpdateArea(builder.data.NomsDesPays[pays]);
         namer.UpdateTimeStep(builder.data.weekInTheYear);
         namer.MinHydroPower(builder.data.nombreDeContraintes);
@@ -58,7 +58,7 @@ void NbDispUnitsMinBoundSinceMinUpTime::add(int pays, int index, int pdt)
               .NumeroDeContrainteDesContraintesDeDureeMinDeMarche[cluster]
               = builder.data.nombreDeContraintes;
 
-            ConstraintNamer namer(builder.data.NomDesContraintes);
+            ConstraintNamer namer(builder.data.DescriptionDesContraintes);
             namer.UpdateArea(builder.data.NomsDesPays[pays]);
 
             namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
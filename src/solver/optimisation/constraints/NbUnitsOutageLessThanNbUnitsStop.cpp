@@ -38,7 +38,7 @@ void NbUnitsOutageLessThanNbUnitsStop::add(int pays, int index, int pdt)
 
         if (builder.NumberOfVariables() > 0)
         {
-            ConstraintNamer namer(builder.data.NomDesContraintes);
+            ConstraintNamer namer(builder.data.DescriptionDesContraintes);
             namer.UpdateArea(builder.data.NomsDesPays[pays]);
             namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
             namer.NbUnitsOutageLessThanNbUnitsStop(
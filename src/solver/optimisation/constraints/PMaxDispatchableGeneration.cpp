@@ -35,7 +35,7 @@ void PMaxDispatchableGeneration::add(int pays, int index, int pdt)
           .lessThan();
         if (builder.NumberOfVariables() > 0)
         {
-            ConstraintNamer namer(builder.data.NomDesContraintes);
+            ConstraintNamer namer(builder.data.DescriptionDesContraintes);
 
             namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
             namer.UpdateArea(builder.data.NomsDesPays[pays]);
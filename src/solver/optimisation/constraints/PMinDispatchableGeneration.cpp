@@ -37,7 +37,7 @@ void PMinDispatchableGeneration::add(int pays, int index, int pdt)
         /*consider Adding naming constraint inside the builder*/
         if (builder.NumberOfVariables() > 0)
         {
-            ConstraintNamer namer(builder.data.NomDesContraintes);
+            ConstraintNamer namer(builder.data.DescriptionDesContraintes);
             namer.UpdateArea(builder.data.NomsDesPays[pays]);
 
             namer.UpdateTimeStep(builder.data.weekInTheYear * 168 + pdt);
@@ -23,7 +23,7 @@
 
 void ShortTermStorageLevel::add(int pdt, int pays)
 {
-    ConstraintNamer namer(builder.data.NomDesContraintes);
+    ConstraintNamer namer(builder.data.DescriptionDesContraintes);
     const int hourInTheYear = builder.data.weekInTheYear * 168 + pdt;
     namer.UpdateTimeStep(hourInTheYear);
     namer.UpdateArea(builder.data.NomsDesPays[pays]);
@@ -40,7 +40,7 @@ ConstraintBuilderData NewGetConstraintBuilderFromProblemHebdoAndProblemAResoudre
             problemeHebdo->NombreDePasDeTempsPourUneOptimisation,
             problemeHebdo->NumeroDeVariableStockFinal,
             problemeHebdo->NumeroDeVariableDeTrancheDeStock,
-            ProblemeAResoudre.NomDesContraintes,
+            ProblemeAResoudre.DescriptionDesContraintes,
             problemeHebdo->NamedProblems,
             problemeHebdo->NomsDesPays,
             problemeHebdo->weekInTheYear,
@@ -0,0 +1,108 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#pragma once
+
+#include <memory>
+#include <vector>
+
+struct PROBLEME_ANTARES_A_RESOUDRE;
+
+namespace Antares::Optimization
+{
+/*!
+** \brief Structural presolve of the weekly linear problems
+**
+** The fixed variables (e.g. the flow of a link without capacity, the generation of a cluster
+** without available power) are removed from the problem given to the solver, their contribution
+** being moved to the right-hand sides, and so are the constraints left without any term. The
+** inequalities which the bounds of their variables are enough to satisfy (e.g. a binding
+** constraint with a right-hand side above the capacities of its links) are removed as well.
+**
+** The structure of the reduced problem is kept as long as the removed variables stay fixed and
+** the removed inequalities stay redundant, so that the solver can go on reusing its problem from
+** one resolution to the next: only the costs, bounds and right-hand sides of the reduced problem
+** are updated.
+*/
+class LinearProblemPresolve final
+{
+public:
+    LinearProblemPresolve();
+    ~LinearProblemPresolve();
+
+    //! Whether a reduced problem was built
+    bool built() const
+    {
+        return reduced_ != nullptr;
+    }
+
+    /*!
+    ** \brief Whether the reduced problem can still be used
+    **
+    ** All the removed variables must be fixed, and all the removed inequalities redundant.
+    */
+    bool matches(const PROBLEME_ANTARES_A_RESOUDRE& problem) const;
+
+    //! Build the reduced problem from the variables fixed in the problem
+    void build(const PROBLEME_ANTARES_A_RESOUDRE& problem);
+
+    //! Drop the reduced problem
+    void clear();
+
+    /*!
+    ** \brief Copy the costs, bounds and right-hand sides of the problem to the reduced problem
+    **
+    ** \return False if a removed constraint is not satisfied by the values of the fixed
+    **         variables, the reduced problem must then not be used
+    */
+    bool update(const PROBLEME_ANTARES_A_RESOUDRE& problem);
+
+    /*!
+    ** \brief Give the solution of the reduced problem back to the problem
+    **
+    ** Values, marginal costs of the constraints, reduced costs and positions of the variables.
+    ** The removed constraints get a zero marginal cost, the reduced costs of the removed
+    ** variables are computed from the marginal costs of the other constraints. A removed
+    ** variable is out of the basis, on its upper bound if its reduced cost is negative, on its
+    ** lower bound otherwise.
+    */
+    void postsolve(PROBLEME_ANTARES_A_RESOUDRE& problem) const;
+
+    PROBLEME_ANTARES_A_RESOUDRE& reducedProblem()
+    {
+        return *reduced_;
+    }
+
+    int removedVariables() const;
+    int removedConstraints() const;
+
+private:
+    std::unique_ptr<PROBLEME_ANTARES_A_RESOUDRE> reduced_;
+    //! Index of each variable in the reduced problem, -1 if removed
+    std::vector<int> newIndexOfVariable_;
+    //! Index in the problem of the variables and constraints of the reduced problem
+    std::vector<int> keptVariables_;
+    std::vector<int> keptConstraints_;
+    //! Constraints without any term once the fixed variables removed
+    std::vector<int> removedConstraints_;
+    //! Inequalities satisfied whatever the values of their variables within their bounds
+    std::vector<int> redundantConstraints_;
+};
+} // namespace Antares::Optimization
@@ -49,7 +49,7 @@ public:
     const int32_t& NombreDePasDeTempsPourUneOptimisation;
     std::vector<int>& NumeroDeVariableStockFinal;
     std::vector<std::vector<int>>& NumeroDeVariableDeTrancheDeStock;
-    std::vector<std::string>& NomDesContraintes;
+    std::vector<ElementName>& DescriptionDesContraintes;
     const bool& NamedProblems;
     const std::vector<const char*>& NomsDesPays;
     const uint32_t& weekInTheYear;
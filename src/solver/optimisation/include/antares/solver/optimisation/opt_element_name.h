@@ -0,0 +1,69 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __SOLVER_OPTIMISATION_ELEMENT_NAME_H__
+#define __SOLVER_OPTIMISATION_ELEMENT_NAME_H__
+
+#include <string>
+
+/*!
+** \brief Description of the name of a variable or of a constraint of the weekly problem
+**
+** The names are only read when the problem is exported with its names, given to an observer of
+** the simulation, or analyzed after a failed resolution. The namers therefore record this
+** description, and the names are only built when one of these needs them (see `BuildNames()`).
+**
+** The strings it refers to (names of the areas, clusters, storages and binding constraints) are
+** owned by the study and by the weekly problem, which outlive the descriptions.
+*/
+struct ElementName
+{
+    enum class Location : unsigned char
+    {
+        area,
+        link,
+        layer,
+        thermalCluster,
+        shortTermStorage,
+        bindingConstraint
+    };
+
+    enum class TimeStep : unsigned char
+    {
+        hour,
+        day,
+        week
+    };
+
+    //! Type of the element ("NODU", "AreaBalance"...), or name of the binding constraint
+    const char* type = nullptr;
+    //! Area of the element, or origin of the link
+    const char* area = nullptr;
+    //! Destination of the link, or name of the cluster or of the storage
+    const char* element = nullptr;
+    unsigned int timeStep = 0;
+    int layer = 0;
+    Location location = Location::area;
+    TimeStep timeStepType = TimeStep::hour;
+
+    std::string str() const;
+};
+
+#endif // __SOLVER_OPTIMISATION_ELEMENT_NAME_H__
@@ -118,6 +118,11 @@ void OPT_InitialiserLeSecondMembreDuProblemeLineaireCoutsDeDemarrage(PROBLEME_HE
 void OPT_DecompteDesVariablesEtDesContraintesCoutsDeDemarrage(PROBLEME_HEBDO*);
 void OPT_InitialiserNombreMinEtMaxDeGroupesCoutsDeDemarrage(PROBLEME_HEBDO*);
 void OPT_AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(PROBLEME_HEBDO*);
+void OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(PROBLEME_HEBDO*,
+                                                                           std::vector<int>&,
+                                                                           int,
+                                                                           int,
+                                                                           bool = false);
 double OPT_SommeDesPminThermiques(const PROBLEME_HEBDO*, int, uint);
 
 #endif /* __SOLVER_OPTIMISATION_FUNCTIONS_H__ */
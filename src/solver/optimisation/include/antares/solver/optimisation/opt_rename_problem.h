@@ -21,33 +21,20 @@
 #pragma once
 #include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
 
+#include "opt_element_name.h"
 #include "opt_export_structure.h"
 
-const std::string SEPARATOR = "::";
-const std::string AREA_SEP = "$$";
-
-class TargetVectorUpdater
-{
-public:
-    explicit TargetVectorUpdater(std::vector<std::string>& target):
-        target_(target)
-    {
-    }
-
-    void UpdateTargetAtIndex(const std::string& full_name, unsigned int index)
-    {
-        target_[index] = full_name;
-    }
-
-private:
-    std::vector<std::string>& target_;
-};
-
+/*!
+** \brief Record the description of the names of the elements of the weekly problem
+**
+** The names given to the namers (areas, clusters, storages, binding constraints) must outlive
+** the problem, see `ElementName`.
+*/
 class Namer
 {
 public:
-    explicit Namer(std::vector<std::string>& target):
-        targetUpdater_(target)
+    explicit Namer(std::vector<ElementName>& target):
+        target_(target)
     {
     }
 
@@ -56,26 +43,35 @@ public:
         timeStep_ = timeStep;
     }
 
-    void UpdateArea(const std::string& area)
+    void UpdateArea(const char* area)
     {
         area_ = area;
     }
 
-    void SetLinkElementName(unsigned int variable, const std::string& variableType);
-    void SetAreaElementNameHour(unsigned int variable, const std::string& variableType);
-    void SetAreaElementNameWeek(unsigned int variable, const std::string& variableType);
-    void SetAreaElementName(unsigned int variable,
-                            const std::string& variableType,
-                            const std::string& timeStepType);
-    void SetThermalClusterElementName(unsigned int variable,
-                                      const std::string& variableType,
+    void SetLinkElementName(unsigned int element,
+                            const char* elementType,
+                            const char* origin,
+                            const char* destination);
+    void SetAreaElementNameHour(unsigned int element, const char* elementType);
+    void SetAreaElementNameWeek(unsigned int element, const char* elementType);
+    void SetAreaElementName(unsigned int element,
+                            const char* elementType,
+                            ElementName::TimeStep timeStepType);
+    void SetThermalClusterElementName(unsigned int element,
+                                      const char* elementType,
                                       const std::string& clusterName);
 
+protected:
+    void set(unsigned int element, const ElementName& name)
+    {
+        target_[element] = name;
+    }
+
     unsigned int timeStep_ = 0;
-    std::string origin_;
-    std::string destination_;
-    std::string area_;
-    TargetVectorUpdater targetUpdater_;
+    const char* area_ = nullptr;
+
+private:
+    std::vector<ElementName>& target_;
 };
 
 class VariableNamer: public Namer
@@ -87,15 +83,9 @@ public:
     void NumberStoppingDispatchableUnits(unsigned int variable, const std::string& clusterName);
     void NumberStartingDispatchableUnits(unsigned int variable, const std::string& clusterName);
     void NumberBreakingDownDispatchableUnits(unsigned int variable, const std::string& clusterName);
-    void NTCDirect(unsigned int variable,
-                   const std::string& origin,
-                   const std::string& destination);
-    void IntercoDirectCost(unsigned int variable,
-                           const std::string& origin,
-                           const std::string& destination);
-    void IntercoIndirectCost(unsigned int variable,
-                             const std::string& origin,
-                             const std::string& destination);
+    void NTCDirect(unsigned int variable, const char* origin, const char* destination);
+    void IntercoDirectCost(unsigned int variable, const char* origin, const char* destination);
+    void IntercoIndirectCost(unsigned int variable, const char* origin, const char* destination);
     void ShortTermStorageInjection(unsigned int variable, const std::string& shortTermStorageName);
     void ShortTermStorageWithdrawal(unsigned int variable, const std::string& shortTermStorageName);
     void ShortTermStorageLevel(unsigned int variable, const std::string& shortTermStorageName);
@@ -112,11 +102,8 @@ public:
     void AreaBalance(unsigned int variable);
 
 private:
-    void SetAreaVariableName(unsigned int variable,
-                             const std::string& variableType,
-                             int layerIndex);
     void SetShortTermStorageVariableName(unsigned int variable,
-                                         const std::string& variableType,
+                                         const char* variableType,
                                          const std::string& shortTermStorageName);
 };
 
@@ -125,9 +112,7 @@ class ConstraintNamer: public Namer
 public:
     using Namer::Namer;
 
-    void FlowDissociation(unsigned int constraint,
-                          const std::string& origin,
-                          const std::string& destination);
+    void FlowDissociation(unsigned int constraint, const char* origin, const char* destination);
 
     void AreaBalance(unsigned int constraint);
     void FictiveLoads(unsigned int constraint);
@@ -148,28 +133,19 @@ public:
     void PMinDispatchableGeneration(unsigned int constraint, const std::string& clusterName);
     void ConsistenceNODU(unsigned int constraint, const std::string& clusterName);
     void ShortTermStorageLevel(unsigned int constraint, const std::string& name);
-    void BindingConstraintHour(unsigned int constraint, const std::string& name);
-    void BindingConstraintDay(unsigned int constraint, const std::string& name);
-    void BindingConstraintWeek(unsigned int constraint, const std::string& name);
-    void CsrFlowDissociation(unsigned int constraint,
-                             const std::string& origin,
-                             const std::string& destination);
+    void BindingConstraintHour(unsigned int constraint, const char* name);
+    void BindingConstraintDay(unsigned int constraint, const char* name);
+    void BindingConstraintWeek(unsigned int constraint, const char* name);
+    void CsrFlowDissociation(unsigned int constraint, const char* origin, const char* destination);
 
     void CsrAreaBalance(unsigned int constraint);
-    void CsrBindingConstraintHour(unsigned int constraint, const std::string& name);
+    void CsrBindingConstraintHour(unsigned int constraint, const char* name);
 
 private:
     void nameWithTimeGranularity(unsigned int constraint,
-                                 const std::string& name,
-                                 const std::string& type);
+                                 const char* name,
+                                 ElementName::TimeStep type);
 };
 
-inline std::string TimeIdentifier(unsigned int timeStep, const std::string& timeStepType)
-{
-    return timeStepType + "<" + std::to_string(timeStep) + ">";
-}
-
-inline std::string LocationIdentifier(const std::string& location, const std::string& locationType)
-{
-    return locationType + "<" + location + ">";
-}
+//! Build the names of the variables and of the constraints of the problem from their descriptions
+void BuildNames(PROBLEME_ANTARES_A_RESOUDRE& problem);
@@ -28,6 +28,12 @@
 #include <antares/solver/utils/basis_status.h>
 
 #include "opt_constants.h"
+#include "opt_element_name.h"
+
+namespace Antares::Optimization
+{
+class LinearProblemPresolve;
+}
 
 /*--------------------------------------------------------------------------------------*/
 
@@ -91,6 +97,8 @@ struct PROBLEME_ANTARES_A_RESOUDRE
                                 */
 
     std::vector<void*> ProblemesSpx;
+    //! Presolve of each optimization interval, parallel to ProblemesSpx (null if not used)
+    std::vector<std::shared_ptr<Antares::Optimization::LinearProblemPresolve>> presolves;
 
     std::vector<int>
       PositionDeLaVariable; /* Vecteur a passer au Simplexe pour recuperer la base optimale */
@@ -102,6 +110,9 @@ struct PROBLEME_ANTARES_A_RESOUDRE
     std::vector<int> Colonne;
 
     /* Nommage des variables & contraintes */
+    // The names are only built from the descriptions when they are needed, see ElementName
+    std::vector<ElementName> DescriptionDesVariables;
+    std::vector<ElementName> DescriptionDesContraintes;
     std::vector<std::string> NomDesVariables;
     std::vector<std::string> NomDesContraintes;
 
@@ -71,6 +71,8 @@ void OPT_AllocateFromNumberOfVariableConstraints(PROBLEME_ANTARES_A_RESOUDRE* Pr
     ProblemeAResoudre->Colonne.assign(nbVariables, 0);
 
     // Names
+    ProblemeAResoudre->DescriptionDesVariables.resize(nbVariables);
+    ProblemeAResoudre->DescriptionDesContraintes.resize(nbConstraints);
     ProblemeAResoudre->NomDesVariables.resize(nbVariables);
     ProblemeAResoudre->NomDesContraintes.resize(nbConstraints);
     // Integer variables ? (MILP)
@@ -137,6 +139,7 @@ static void optimisationAllocateProblem(PROBLEME_HEBDO* problemeHebdo, const int
     int NbIntervalles = problemeHebdo->NombreDePasDeTemps / NombreDePasDeTempsPourUneOptimisation;
 
     ProblemeAResoudre->ProblemesSpx.assign(NbIntervalles, nullptr);
+    ProblemeAResoudre->presolves.assign(NbIntervalles, nullptr);
 
     logs.info();
     logs.info() << " Status of Preliminary Allocations for Generic Problem Resolution : Successful";
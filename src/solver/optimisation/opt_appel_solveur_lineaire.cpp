@@ -21,7 +21,9 @@
 
 #include <yuni/yuni.h>
 
+#include "antares/solver/optimisation/LinearProblemPresolve.h"
 #include "antares/solver/optimisation/opt_fonctions.h"
+#include "antares/solver/optimisation/opt_rename_problem.h"
 #include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
 #include "antares/solver/simulation/sim_structure_probleme_economique.h"
 #include "antares/solver/simulation/simulation.h"
@@ -35,12 +37,15 @@ extern "C"
 }
 
 #include <chrono>
+#include <optional>
 
 #include <antares/antares/fatal-error.h>
+#include <antares/logs/async_logs.h>
 #include <antares/logs/logs.h>
 #include "antares/solver/infeasible-problem-analysis/unfeasible-pb-analyzer.h"
 #include "antares/solver/utils/filename.h"
 #include "antares/solver/utils/mps_utils.h"
+#include "antares/solver/utils/ortools_utils.h"
 
 using namespace operations_research;
 
@@ -89,6 +94,7 @@ struct SimplexResult
 
 static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
                                           PROBLEME_HEBDO* problemeHebdo,
+                                          PROBLEME_ANTARES_A_RESOUDRE& solvedProblem,
                                           Optimization::PROBLEME_SIMPLEXE_NOMME& Probleme,
                                           const int NumIntervalle,
                                           const int optimizationNumber,
@@ -143,27 +149,27 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
             if (options.ortoolsUsed)
             {
                 ORTOOLS_ModifierLeVecteurCouts(solver,
-                                               ProblemeAResoudre->CoutLineaire.data(),
-                                               ProblemeAResoudre->NombreDeVariables);
+                                               solvedProblem.CoutLineaire.data(),
+                                               solvedProblem.NombreDeVariables);
                 ORTOOLS_ModifierLeVecteurSecondMembre(solver,
-                                                      ProblemeAResoudre->SecondMembre.data(),
-                                                      ProblemeAResoudre->Sens.data(),
-                                                      ProblemeAResoudre->NombreDeContraintes);
+                                                      solvedProblem.SecondMembre.data(),
+                                                      solvedProblem.Sens.data(),
+                                                      solvedProblem.NombreDeContraintes);
                 ORTOOLS_CorrigerLesBornes(solver,
-                                          ProblemeAResoudre->Xmin.data(),
-                                          ProblemeAResoudre->Xmax.data(),
-                                          ProblemeAResoudre->TypeDeVariable.data(),
-                                          ProblemeAResoudre->NombreDeVariables);
+                                          solvedProblem.Xmin.data(),
+                                          solvedProblem.Xmax.data(),
+                                          solvedProblem.TypeDeVariable.data(),
+                                          solvedProblem.NombreDeVariables);
             }
             else
             {
                 SPX_ModifierLeVecteurCouts(ProbSpx,
-                                           ProblemeAResoudre->CoutLineaire.data(),
-                                           ProblemeAResoudre->NombreDeVariables);
+                                           solvedProblem.CoutLineaire.data(),
+                                           solvedProblem.NombreDeVariables);
                 SPX_ModifierLeVecteurSecondMembre(ProbSpx,
-                                                  ProblemeAResoudre->SecondMembre.data(),
-                                                  ProblemeAResoudre->Sens.data(),
-                                                  ProblemeAResoudre->NombreDeContraintes);
+                                                  solvedProblem.SecondMembre.data(),
+                                                  solvedProblem.Sens.data(),
+                                                  solvedProblem.NombreDeContraintes);
             }
             updateMeasure.tick();
             timeMeasure.updateTime = updateMeasure.duration_ms();
@@ -174,22 +180,22 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
     Probleme.NombreMaxDIterations = -1;
     Probleme.DureeMaxDuCalcul = -1.;
 
-    Probleme.CoutLineaire = ProblemeAResoudre->CoutLineaire.data();
-    Probleme.X = ProblemeAResoudre->X.data();
-    Probleme.Xmin = ProblemeAResoudre->Xmin.data();
-    Probleme.Xmax = ProblemeAResoudre->Xmax.data();
-    Probleme.NombreDeVariables = ProblemeAResoudre->NombreDeVariables;
-    Probleme.TypeDeVariable = ProblemeAResoudre->TypeDeVariable.data();
-
-    Probleme.NombreDeContraintes = ProblemeAResoudre->NombreDeContraintes;
-    Probleme.IndicesDebutDeLigne = ProblemeAResoudre->IndicesDebutDeLigne.data();
-    Probleme.NombreDeTermesDesLignes = ProblemeAResoudre->NombreDeTermesDesLignes.data();
-    Probleme.IndicesColonnes = ProblemeAResoudre->IndicesColonnes.data();
-    Probleme.CoefficientsDeLaMatriceDesContraintes = ProblemeAResoudre
-                                                       ->CoefficientsDeLaMatriceDesContraintes
+    Probleme.CoutLineaire = solvedProblem.CoutLineaire.data();
+    Probleme.X = solvedProblem.X.data();
+    Probleme.Xmin = solvedProblem.Xmin.data();
+    Probleme.Xmax = solvedProblem.Xmax.data();
+    Probleme.NombreDeVariables = solvedProblem.NombreDeVariables;
+    Probleme.TypeDeVariable = solvedProblem.TypeDeVariable.data();
+
+    Probleme.NombreDeContraintes = solvedProblem.NombreDeContraintes;
+    Probleme.IndicesDebutDeLigne = solvedProblem.IndicesDebutDeLigne.data();
+    Probleme.NombreDeTermesDesLignes = solvedProblem.NombreDeTermesDesLignes.data();
+    Probleme.IndicesColonnes = solvedProblem.IndicesColonnes.data();
+    Probleme.CoefficientsDeLaMatriceDesContraintes = solvedProblem
+                                                       .CoefficientsDeLaMatriceDesContraintes
                                                        .data();
-    Probleme.Sens = ProblemeAResoudre->Sens.data();
-    Probleme.SecondMembre = ProblemeAResoudre->SecondMembre.data();
+    Probleme.Sens = solvedProblem.Sens.data();
+    Probleme.SecondMembre = solvedProblem.SecondMembre.data();
 
     Probleme.ChoixDeLAlgorithme = SPX_DUAL;
 
@@ -199,17 +205,17 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
 
     Probleme.StrategieAntiDegenerescence = AGRESSIF;
 
-    Probleme.PositionDeLaVariable = ProblemeAResoudre->PositionDeLaVariable.data();
+    Probleme.PositionDeLaVariable = solvedProblem.PositionDeLaVariable.data();
     Probleme.NbVarDeBaseComplementaires = 0;
-    Probleme.ComplementDeLaBase = ProblemeAResoudre->ComplementDeLaBase.data();
+    Probleme.ComplementDeLaBase = solvedProblem.ComplementDeLaBase.data();
 
     Probleme.LibererMemoireALaFin = NON_SPX;
 
     Probleme.UtiliserCoutMax = NON_SPX;
     Probleme.CoutMax = 0.0;
 
-    Probleme.CoutsMarginauxDesContraintes = ProblemeAResoudre->CoutsMarginauxDesContraintes.data();
-    Probleme.CoutsReduits = ProblemeAResoudre->CoutsReduits.data();
+    Probleme.CoutsMarginauxDesContraintes = solvedProblem.CoutsMarginauxDesContraintes.data();
+    Probleme.CoutsReduits = solvedProblem.CoutsReduits.data();
 
     Probleme.NombreDeContraintesCoupes = 0;
 
@@ -229,15 +235,39 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
     auto mps_writer = mps_writer_factory.create();
     mps_writer->runIfNeeded(writer, filename);
 
+    const unsigned week = problemeHebdo->weekInTheYear;
     TimeMeasurement measure;
     if (options.ortoolsUsed)
     {
+        // The weeks which were slow in the previous years are raced against another solver
+        std::optional<Optimization::SolverRace> race;
+        if (PremierPassage && problemeHebdo->racingQueue
+            && optimizationStatistics.wasSlow(week, NumIntervalle))
+        {
+            race.emplace(options.racingSolver, Probleme, options);
+            race->start(solver, *problemeHebdo->racingQueue);
+        }
+
         const bool keepBasis = (optimizationNumber == PREMIERE_OPTIMISATION);
-        solver = ORTOOLS_Simplexe(&Probleme, solver, keepBasis, options);
+        solver = ORTOOLS_Simplexe(&Probleme,
+                                  solver,
+                                  keepBasis,
+                                  options,
+                                  race ? &*race : nullptr);
         if (solver != nullptr)
         {
             ProblemeAResoudre->ProblemesSpx[NumIntervalle] = (void*)solver;
         }
+
+        if (race)
+        {
+            const bool challengerWon = race->finish(Probleme);
+            timeMeasure.racingWinner = challengerWon ? "challenger" : "main";
+            AsyncLogs::info() << " Solver racing: week " << week + 1 << " solved by "
+                              << (challengerWon ? options.racingSolver : options.ortoolsSolver)
+                              << (challengerWon ? " (challenger)" : " (main solver)")
+                              << (race->challengerStarted() ? "" : ", challenger not started");
+        }
     }
     else
     {
@@ -249,12 +279,12 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
     }
     measure.tick();
     timeMeasure.solveTime = measure.duration_ms();
-    optimizationStatistics.addSolveTime(timeMeasure.solveTime);
+    optimizationStatistics.addSolveTime(timeMeasure.solveTime, week, NumIntervalle);
 
-    ProblemeAResoudre->ExistenceDUneSolution = Probleme.ExistenceDUneSolution;
-    if (ProblemeAResoudre->ExistenceDUneSolution != OUI_SPX && PremierPassage)
+    solvedProblem.ExistenceDUneSolution = Probleme.ExistenceDUneSolution;
+    if (solvedProblem.ExistenceDUneSolution != OUI_SPX && PremierPassage)
     {
-        if (ProblemeAResoudre->ExistenceDUneSolution != SPX_ERREUR_INTERNE)
+        if (solvedProblem.ExistenceDUneSolution != SPX_ERREUR_INTERNE)
         {
             if (options.ortoolsUsed && solver)
             {
@@ -264,6 +294,7 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
             {
                 SPX_LibererProbleme(ProbSpx);
             }
+            ProblemeAResoudre->ProblemesSpx[NumIntervalle] = nullptr;
 
             logs.info() << " Solver: Standard resolution failed";
             logs.info() << " Solver: Retry in safe mode"; // second trial w/o scaling
@@ -285,6 +316,58 @@ static SimplexResult OPT_TryToCallSimplex(const OptimizationOptions& options,
     return {.success = true, .timeMeasure = timeMeasure, .mps_writer_factory = mps_writer_factory};
 }
 
+static void releaseSolver(const OptimizationOptions& options,
+                          PROBLEME_ANTARES_A_RESOUDRE& ProblemeAResoudre,
+                          int NumIntervalle)
+{
+    void* solver = ProblemeAResoudre.ProblemesSpx[NumIntervalle];
+    if (options.ortoolsUsed && solver)
+    {
+        ORTOOLS_LibererProbleme((MPSolver*)solver);
+    }
+    else if (solver)
+    {
+        SPX_LibererProbleme((PROBLEME_SPX*)solver);
+    }
+    ProblemeAResoudre.ProblemesSpx[NumIntervalle] = nullptr;
+}
+
+// Problem given to the solver: the problem reduced by the presolve if enabled
+static PROBLEME_ANTARES_A_RESOUDRE& problemToSolve(const OptimizationOptions& options,
+                                                   PROBLEME_HEBDO* problemeHebdo,
+                                                   int NumIntervalle)
+{
+    auto& ProblemeAResoudre = *problemeHebdo->ProblemeAResoudre;
+    // The MPS files are the ones of the complete problem
+    if (!options.presolve || problemeHebdo->ExportMPS != Data::mpsExportStatus::NO_EXPORT)
+    {
+        return ProblemeAResoudre;
+    }
+
+    auto& presolve = ProblemeAResoudre.presolves[NumIntervalle];
+    if (!presolve)
+    {
+        presolve = std::make_shared<Optimization::LinearProblemPresolve>();
+    }
+
+    // The solver keeps its problem from one resolution to the next, it must be rebuilt when
+    // the structure of the reduced problem changes
+    if (!presolve->matches(ProblemeAResoudre))
+    {
+        releaseSolver(options, ProblemeAResoudre, NumIntervalle);
+        presolve->build(ProblemeAResoudre);
+    }
+
+    if (!presolve->update(ProblemeAResoudre))
+    {
+        // Unfeasible: the solver reports it on the complete problem
+        releaseSolver(options, ProblemeAResoudre, NumIntervalle);
+        presolve->clear();
+        return ProblemeAResoudre;
+    }
+    return presolve->reducedProblem();
+}
+
 bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
                          PROBLEME_HEBDO* problemeHebdo,
                          int NumIntervalle,
@@ -293,18 +376,29 @@ bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
                          IResultWriter& writer)
 {
     const auto& ProblemeAResoudre = problemeHebdo->ProblemeAResoudre;
-    Optimization::PROBLEME_SIMPLEXE_NOMME Probleme(ProblemeAResoudre->NomDesVariables,
-                                                   ProblemeAResoudre->NomDesContraintes,
-                                                   ProblemeAResoudre->VariablesEntieres,
-                                                   ProblemeAResoudre->basisStatus,
-                                                   problemeHebdo->NamedProblems,
-                                                   options.solverLogs);
+    PROBLEME_ANTARES_A_RESOUDRE* solvedProblem = &problemToSolve(options,
+                                                                 problemeHebdo,
+                                                                 NumIntervalle);
+    auto& presolve = ProblemeAResoudre->presolves[NumIntervalle];
+
+    std::optional<Optimization::PROBLEME_SIMPLEXE_NOMME> Probleme;
+    auto initProbleme = [&Probleme, &problemeHebdo, &options](PROBLEME_ANTARES_A_RESOUDRE& pb)
+    {
+        Probleme.emplace(pb.NomDesVariables,
+                         pb.NomDesContraintes,
+                         pb.VariablesEntieres,
+                         pb.basisStatus,
+                         problemeHebdo->NamedProblems,
+                         options.solverLogs);
+    };
+    initProbleme(*solvedProblem);
 
     bool PremierPassage = true;
 
     SimplexResult simplexResult = OPT_TryToCallSimplex(options,
                                                        problemeHebdo,
-                                                       Probleme,
+                                                       *solvedProblem,
+                                                       *Probleme,
                                                        NumIntervalle,
                                                        optimizationNumber,
                                                        optPeriodStringGenerator,
@@ -314,9 +408,17 @@ bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
     if (!simplexResult.success)
     {
         PremierPassage = false;
+        // The safe mode, and the analysis if it fails, work on the complete problem
+        if (solvedProblem != ProblemeAResoudre.get())
+        {
+            presolve->clear();
+            solvedProblem = ProblemeAResoudre.get();
+            initProbleme(*solvedProblem);
+        }
         simplexResult = OPT_TryToCallSimplex(options,
                                              problemeHebdo,
-                                             Probleme,
+                                             *solvedProblem,
+                                             *Probleme,
                                              NumIntervalle,
                                              optimizationNumber,
                                              optPeriodStringGenerator,
@@ -324,6 +426,17 @@ bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
                                              writer);
     }
 
+    if (solvedProblem != ProblemeAResoudre.get())
+    {
+        simplexResult.timeMeasure.removedVariables = presolve->removedVariables();
+        simplexResult.timeMeasure.removedConstraints = presolve->removedConstraints();
+        if (solvedProblem->ExistenceDUneSolution == OUI_SPX)
+        {
+            presolve->postsolve(*ProblemeAResoudre);
+        }
+        ProblemeAResoudre->ExistenceDUneSolution = solvedProblem->ExistenceDUneSolution;
+    }
+
     if (ProblemeAResoudre->ExistenceDUneSolution == OUI_SPX)
     {
         if (!PremierPassage)
@@ -383,20 +496,38 @@ bool OPT_AppelDuSimplexe(const OptimizationOptions& options,
             logs.info() << " Solver: Safe resolution failed";
         }
 
-        Probleme.SetUseNamedProblems(true);
+        // Written first: the analysis may modify the model of the or-tools solver
+        auto mps_writer_on_error = simplexResult.mps_writer_factory.createOnOptimizationError();
+        const std::string filename = createMPSfilename(optPeriodStringGenerator,
+                                                       optimizationNumber);
+        mps_writer_on_error->runIfNeeded(writer, filename);
 
-        auto MPproblem = std::shared_ptr<MPSolver>(
-          ProblemSimplexeNommeConverter(options.ortoolsSolver, &Probleme).Convert());
+        // The analysis needs the names of the constraints. When the or-tools model of the failed
+        // resolution has them, it is analyzed in place: the solver then restarts from its last
+        // state instead of from scratch. It is discarded afterwards, since slack variables have
+        // been added to it.
+        auto* failedSolver = (MPSolver*)(ProblemeAResoudre->ProblemesSpx[NumIntervalle]);
+        std::unique_ptr<MPSolver> MPproblem;
+        if (options.ortoolsUsed && failedSolver && Probleme->UseNamedProblems())
+        {
+            MPproblem.reset(failedSolver);
+            ProblemeAResoudre->ProblemesSpx[NumIntervalle] = nullptr;
+        }
+        else
+        {
+            if (!Probleme->UseNamedProblems())
+            {
+                BuildNames(*ProblemeAResoudre);
+            }
+            Probleme->SetUseNamedProblems(true);
+            MPproblem.reset(
+              ProblemSimplexeNommeConverter(options.ortoolsSolver, &*Probleme).Convert());
+        }
 
         auto analyzer = makeUnfeasiblePbAnalyzer();
         analyzer->run(MPproblem.get());
         analyzer->printReport();
 
-        auto mps_writer_on_error = simplexResult.mps_writer_factory.createOnOptimizationError();
-        const std::string filename = createMPSfilename(optPeriodStringGenerator,
-                                                       optimizationNumber);
-        mps_writer_on_error->runIfNeeded(writer, filename);
-
         return false;
     }
 
@@ -41,10 +41,60 @@ using namespace Yuni;
 #define SNPRINTF snprintf
 #endif
 
-void OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(PROBLEME_HEBDO*,
-                                                                           std::vector<int>&,
-                                                                           int,
-                                                                           int);
+namespace
+{
+// Buffers of the auxiliary problem, kept by each thread from one cluster to the next
+struct ProblemeAuxiliaire
+{
+    std::vector<int> NumeroDeVariableDeM;
+    std::vector<int> NumeroDeVariableDeMMoinsMoins;
+    std::vector<int> NumeroDeVariableDeMPlus;
+    std::vector<int> NumeroDeVariableDeMMoins;
+
+    std::vector<int> PositionDeLaVariable;
+    std::vector<double> CoutLineaire;
+    std::vector<double> Xsolution;
+    std::vector<double> Xmin;
+    std::vector<double> Xmax;
+    std::vector<int> TypeDeVariable;
+
+    std::vector<int> ComplementDeLaBase;
+    std::vector<int> IndicesDebutDeLigne;
+    std::vector<int> NombreDeTermesDesLignes;
+    std::vector<char> Sens;
+    std::vector<double> SecondMembre;
+
+    std::vector<int> IndicesColonnes;
+    std::vector<double> CoefficientsDeLaMatriceDesContraintes;
+
+    void resize(int NombreDePasDeTemps,
+                int NombreDeVariables,
+                int NombreDeContraintes,
+                int NbTermesMatrice)
+    {
+        NumeroDeVariableDeM.resize(NombreDePasDeTemps);
+        NumeroDeVariableDeMMoinsMoins.resize(NombreDePasDeTemps);
+        NumeroDeVariableDeMPlus.resize(NombreDePasDeTemps);
+        NumeroDeVariableDeMMoins.resize(NombreDePasDeTemps);
+
+        PositionDeLaVariable.resize(NombreDeVariables);
+        CoutLineaire.resize(NombreDeVariables);
+        Xsolution.resize(NombreDeVariables);
+        Xmin.resize(NombreDeVariables);
+        Xmax.resize(NombreDeVariables);
+        TypeDeVariable.resize(NombreDeVariables);
+
+        ComplementDeLaBase.resize(NombreDeContraintes);
+        IndicesDebutDeLigne.resize(NombreDeContraintes);
+        NombreDeTermesDesLignes.resize(NombreDeContraintes);
+        Sens.resize(NombreDeContraintes);
+        SecondMembre.resize(NombreDeContraintes);
+
+        IndicesColonnes.resize(NbTermesMatrice);
+        CoefficientsDeLaMatriceDesContraintes.resize(NbTermesMatrice);
+    }
+};
+} // namespace
 
 void OPT_AjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(PROBLEME_HEBDO* problemeHebdo)
 {
@@ -219,7 +269,8 @@ void OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(
   PROBLEME_HEBDO* problemeHebdo,
   std::vector<int>& NbMinOptDeGroupesEnMarche,
   int Pays,
-  int index)
+  int index,
+  bool forcerLaResolution)
 {
     int NombreDePasDeTemps = problemeHebdo->NombreDePasDeTemps;
 
@@ -237,7 +288,9 @@ void OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(
                                                                         ->ResultatsHoraires[Pays]
                                                                         .ProductionThermique;
 
-    bool ResoudreLeProblemeLineaire = true;
+    // When the rounded numbers of units already satisfy the minimum up and down durations, they
+    // are the optimum of the auxiliary problem (each M is minimized and bounded below by them)
+    bool ResoudreLeProblemeLineaire = forcerLaResolution;
 
     for (int pdt = 0; pdt < NombreDePasDeTemps; pdt++)
     {
@@ -360,11 +413,6 @@ void OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(
     NombreDeVariables += NombreDePasDeTemps;
     NombreDeVariables += NombreDePasDeTemps;
 
-    std::vector<int> NumeroDeVariableDeM(NombreDePasDeTemps);
-    std::vector<int> NumeroDeVariableDeMMoinsMoins(NombreDePasDeTemps);
-    std::vector<int> NumeroDeVariableDeMPlus(NombreDePasDeTemps);
-    std::vector<int> NumeroDeVariableDeMMoins(NombreDePasDeTemps);
-
     int NombreDeContraintes = 0;
     NombreDeContraintes += NombreDePasDeTemps;
     NombreDeContraintes += NombreDePasDeTemps;
@@ -372,19 +420,6 @@ void OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(
     NombreDeContraintes += NombreDePasDeTemps;
     NombreDeContraintes += NombreDePasDeTemps;
 
-    std::vector<int> PositionDeLaVariable(NombreDeVariables);
-    std::vector<double> CoutLineaire(NombreDeVariables);
-    std::vector<double> Xsolution(NombreDeVariables);
-    std::vector<double> Xmin(NombreDeVariables);
-    std::vector<double> Xmax(NombreDeVariables);
-    std::vector<int> TypeDeVariable(NombreDeVariables);
-
-    std::vector<int> ComplementDeLaBase(NombreDeContraintes);
-    std::vector<int> IndicesDebutDeLigne(NombreDeContraintes);
-    std::vector<int> NombreDeTermesDesLignes(NombreDeContraintes);
-    std::vector<char> Sens(NombreDeContraintes);
-    std::vector<double> SecondMembre(NombreDeContraintes);
-
     int NbTermesMatrice = 0;
     NbTermesMatrice += 4 * NombreDePasDeTemps;
     NbTermesMatrice += 2 * NombreDePasDeTemps;
@@ -393,8 +428,30 @@ void OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(
                        * (1 + (2 * DureeMinimaleDeMarcheDUnGroupeDuPalierThermique));
     NbTermesMatrice += NombreDePasDeTemps * (1 + DureeMinimaleDArretDUnGroupeDuPalierThermique);
 
-    std::vector<int> IndicesColonnes(NbTermesMatrice);
-    std::vector<double> CoefficientsDeLaMatriceDesContraintes(NbTermesMatrice);
+    static thread_local ProblemeAuxiliaire pb;
+    pb.resize(NombreDePasDeTemps, NombreDeVariables, NombreDeContraintes, NbTermesMatrice);
+
+    std::vector<int>& NumeroDeVariableDeM = pb.NumeroDeVariableDeM;
+    std::vector<int>& NumeroDeVariableDeMMoinsMoins = pb.NumeroDeVariableDeMMoinsMoins;
+    std::vector<int>& NumeroDeVariableDeMPlus = pb.NumeroDeVariableDeMPlus;
+    std::vector<int>& NumeroDeVariableDeMMoins = pb.NumeroDeVariableDeMMoins;
+
+    std::vector<int>& PositionDeLaVariable = pb.PositionDeLaVariable;
+    std::vector<double>& CoutLineaire = pb.CoutLineaire;
+    std::vector<double>& Xsolution = pb.Xsolution;
+    std::vector<double>& Xmin = pb.Xmin;
+    std::vector<double>& Xmax = pb.Xmax;
+    std::vector<int>& TypeDeVariable = pb.TypeDeVariable;
+
+    std::vector<int>& ComplementDeLaBase = pb.ComplementDeLaBase;
+    std::vector<int>& IndicesDebutDeLigne = pb.IndicesDebutDeLigne;
+    std::vector<int>& NombreDeTermesDesLignes = pb.NombreDeTermesDesLignes;
+    std::vector<char>& Sens = pb.Sens;
+    std::vector<double>& SecondMembre = pb.SecondMembre;
+
+    std::vector<int>& IndicesColonnes = pb.IndicesColonnes;
+    std::vector<double>& CoefficientsDeLaMatriceDesContraintes
+      = pb.CoefficientsDeLaMatriceDesContraintes;
 
     NombreDeVariables = 0;
     for (int pdt = 0; pdt < NombreDePasDeTemps; pdt++)
@@ -19,6 +19,7 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 
+#include <antares/logs/async_logs.h>
 #include <antares/logs/logs.h>
 #include "antares/solver/lps/LpsFromAntares.h"
 #include "antares/solver/optimisation/HebdoProblemToLpsTranslator.h"
@@ -26,6 +27,7 @@
 #include "antares/solver/optimisation/constraints/constraint_builder_utils.h"
 #include "antares/solver/optimisation/opt_export_structure.h"
 #include "antares/solver/optimisation/opt_fonctions.h"
+#include "antares/solver/optimisation/opt_rename_problem.h"
 #include "antares/solver/simulation/ISimulationObserver.h"
 #include "antares/solver/simulation/sim_structure_probleme_economique.h"
 #include "antares/solver/utils/filename.h"
@@ -58,7 +60,7 @@ void OPT_EcrireResultatFonctionObjectiveAuFormatTXT(
     Yuni::Clob buffer;
     auto filename = createCriterionFilename(optPeriodStringGenerator, optimizationNumber);
 
-    logs.info() << "Solver Criterion File: `" << filename << "'";
+    AsyncLogs::info() << "Solver Criterion File: `" << filename << "'";
 
     buffer.appendFormat("* Optimal criterion value :   %11.10e\n", optimalSolutionCost);
     writer.addEntryFromBuffer(filename, buffer);
@@ -174,6 +176,7 @@ void resizeProbleme(PROBLEME_ANTARES_A_RESOUDRE* ProblemeAResoudre,
     ProblemeAResoudre->AdresseOuPlacerLaValeurDesVariablesOptimisees.resize(nombreDeVariables);
     ProblemeAResoudre->AdresseOuPlacerLaValeurDesCoutsReduits.resize(nombreDeVariables);
     ProblemeAResoudre->PositionDeLaVariable.resize(nombreDeVariables);
+    ProblemeAResoudre->DescriptionDesVariables.resize(nombreDeVariables);
     ProblemeAResoudre->NomDesVariables.resize(nombreDeVariables);
     ProblemeAResoudre->VariablesEntieres.resize(nombreDeVariables);
 
@@ -184,6 +187,7 @@ void resizeProbleme(PROBLEME_ANTARES_A_RESOUDRE* ProblemeAResoudre,
     ProblemeAResoudre->AdresseOuPlacerLaValeurDesCoutsMarginaux.resize(nombreDeContraintes);
     ProblemeAResoudre->CoutsMarginauxDesContraintes.resize(nombreDeContraintes);
     ProblemeAResoudre->ComplementDeLaBase.resize(nombreDeContraintes);
+    ProblemeAResoudre->DescriptionDesContraintes.resize(nombreDeContraintes);
     ProblemeAResoudre->NomDesContraintes.resize(nombreDeContraintes);
 }
 } // namespace
@@ -219,6 +223,10 @@ bool OPT_OptimisationLineaire(const OptimizationOptions& options,
     resizeProbleme(problemeHebdo->ProblemeAResoudre.get(),
                    problemeHebdo->ProblemeAResoudre->NombreDeVariables,
                    problemeHebdo->ProblemeAResoudre->NombreDeContraintes);
+    if (problemeHebdo->NamedProblems || simulationObserver.needsNames())
+    {
+        BuildNames(*problemeHebdo->ProblemeAResoudre);
+    }
     if (problemeHebdo->ExportStructure && problemeHebdo->firstWeekOfSimulation)
     {
         OPT_ExportStructures(problemeHebdo, writer);
@@ -21,78 +21,151 @@
 
 #include "antares/solver/optimisation/opt_rename_problem.h"
 
-#include <map>
-#include <sstream>
-
-const std::string HOUR("hour");
-const std::string DAY("day");
-const std::string WEEK("week");
-const std::map<std::string, std::string> BindingConstraintTimeGranularity = {{HOUR, "hourly"},
-                                                                             {DAY, "daily"},
-                                                                             {WEEK, "weekly"}};
-const std::string LINK("link");
-const std::string AREA("area");
-
-std::string BuildName(const std::string& name,
-                      const std::string& location,
-                      const std::string& timeIdentifier)
-{
-    std::string result = name + SEPARATOR + location + SEPARATOR + timeIdentifier;
+#include <algorithm>
+
+namespace
+{
+const std::string SEPARATOR = "::";
+const std::string AREA_SEP = "$$";
+
+const char* timeStepName(ElementName::TimeStep timeStep)
+{
+    switch (timeStep)
+    {
+    case ElementName::TimeStep::day:
+        return "day";
+    case ElementName::TimeStep::week:
+        return "week";
+    default:
+        return "hour";
+    }
+}
+
+const char* bindingConstraintTimeGranularity(ElementName::TimeStep timeStep)
+{
+    switch (timeStep)
+    {
+    case ElementName::TimeStep::day:
+        return "daily";
+    case ElementName::TimeStep::week:
+        return "weekly";
+    default:
+        return "hourly";
+    }
+}
+
+void appendLocation(std::string& name, const char* locationType, const char* location)
+{
+    name.append(locationType).append("<").append(location).append(">");
+}
+} // namespace
+
+// <type>::<location>::<time step>, e.g. NODU::area<fr>::ThermalCluster<gas>::hour<3>
+std::string ElementName::str() const
+{
+    std::string result(type);
+    result += SEPARATOR;
+    switch (location)
+    {
+    case Location::link:
+        result.append("link<").append(area).append(AREA_SEP).append(element).append(">");
+        break;
+    case Location::layer:
+        appendLocation(result, "area", area);
+        result += SEPARATOR;
+        appendLocation(result, "Layer", std::to_string(layer).c_str());
+        break;
+    case Location::thermalCluster:
+        appendLocation(result, "area", area);
+        result += SEPARATOR;
+        appendLocation(result, "ThermalCluster", element);
+        break;
+    case Location::shortTermStorage:
+        appendLocation(result, "area", area);
+        result += SEPARATOR;
+        appendLocation(result, "ShortTermStorage", element);
+        break;
+    case Location::bindingConstraint:
+        result += bindingConstraintTimeGranularity(timeStepType);
+        break;
+    default:
+        appendLocation(result, "area", area);
+        break;
+    }
+    result += SEPARATOR;
+    appendLocation(result, timeStepName(timeStepType), std::to_string(timeStep).c_str());
+
     std::replace(result.begin(), result.end(), ' ', '*');
     return result;
 }
 
-void Namer::SetLinkElementName(unsigned int element, const std::string& elementType)
+namespace
+{
+void buildNames(const std::vector<ElementName>& descriptions,
+                std::vector<std::string>& names,
+                int count)
 {
-    const auto location = origin_ + AREA_SEP + destination_;
-    targetUpdater_.UpdateTargetAtIndex(BuildName(elementType,
-                                                 LocationIdentifier(location, LINK),
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       element);
+    for (int i = 0; i < count; ++i)
+    {
+        // The elements without a namer keep an empty name
+        names[i] = descriptions[i].type ? descriptions[i].str() : std::string();
+    }
 }
+} // namespace
 
-void Namer::SetAreaElementNameHour(unsigned int element, const std::string& elementType)
+void BuildNames(PROBLEME_ANTARES_A_RESOUDRE& problem)
 {
-    SetAreaElementName(element, elementType, HOUR);
+    buildNames(problem.DescriptionDesVariables, problem.NomDesVariables, problem.NombreDeVariables);
+    buildNames(problem.DescriptionDesContraintes,
+               problem.NomDesContraintes,
+               problem.NombreDeContraintes);
 }
 
-void Namer::SetAreaElementNameWeek(unsigned int element, const std::string& elementType)
+void Namer::SetLinkElementName(unsigned int element,
+                               const char* elementType,
+                               const char* origin,
+                               const char* destination)
 {
-    SetAreaElementName(element, elementType, WEEK);
+    set(element,
+        {.type = elementType,
+         .area = origin,
+         .element = destination,
+         .timeStep = timeStep_,
+         .location = ElementName::Location::link});
 }
 
-void Namer::SetAreaElementName(unsigned int element,
-                               const std::string& elementType,
-                               const std::string& timeStepType)
+void Namer::SetAreaElementNameHour(unsigned int element, const char* elementType)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName(elementType,
-                                                 LocationIdentifier(area_, AREA),
-                                                 TimeIdentifier(timeStep_, timeStepType)),
-                                       element);
+    SetAreaElementName(element, elementType, ElementName::TimeStep::hour);
 }
 
-void VariableNamer::SetAreaVariableName(unsigned int variable,
-                                        const std::string& variableType,
-                                        int layerIndex)
+void Namer::SetAreaElementNameWeek(unsigned int element, const char* elementType)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName(variableType,
-                                                 LocationIdentifier(area_, AREA) + SEPARATOR
-                                                   + "Layer<" + std::to_string(layerIndex) + ">",
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       variable);
+    SetAreaElementName(element, elementType, ElementName::TimeStep::week);
 }
 
-void Namer::SetThermalClusterElementName(unsigned int variable,
-                                         const std::string& elementType,
-                                         const std::string& clusterName)
+void Namer::SetAreaElementName(unsigned int element,
+                               const char* elementType,
+                               ElementName::TimeStep timeStepType)
 {
-    const auto location = LocationIdentifier(area_, AREA) + SEPARATOR + "ThermalCluster" + "<"
-                          + clusterName + ">";
+    set(element,
+        {.type = elementType,
+         .area = area_,
+         .timeStep = timeStep_,
+         .location = ElementName::Location::area,
+         .timeStepType = timeStepType});
+}
 
-    targetUpdater_.UpdateTargetAtIndex(BuildName(elementType,
-                                                 location,
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       variable);
+void Namer::SetThermalClusterElementName(unsigned int element,
+                                         const char* elementType,
+                                         const std::string& clusterName)
+{
+    set(element,
+        {.type = elementType,
+         .area = area_,
+         .element = clusterName.c_str(),
+         .timeStep = timeStep_,
+         .location = ElementName::Location::thermalCluster});
 }
 
 void VariableNamer::DispatchableProduction(unsigned int variable, const std::string& clusterName)
@@ -123,45 +196,36 @@ void VariableNamer::NumberBreakingDownDispatchableUnits(unsigned int variable,
     SetThermalClusterElementName(variable, "NumberBreakingDownDispatchableUnits", clusterName);
 }
 
-void VariableNamer::NTCDirect(unsigned int variable,
-                              const std::string& origin,
-                              const std::string& destination)
+void VariableNamer::NTCDirect(unsigned int variable, const char* origin, const char* destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(variable, "NTCDirect");
+    SetLinkElementName(variable, "NTCDirect", origin, destination);
 }
 
 void VariableNamer::IntercoDirectCost(unsigned int variable,
-                                      const std::string& origin,
-                                      const std::string& destination)
+                                      const char* origin,
+                                      const char* destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(variable, "IntercoDirectCost");
+    SetLinkElementName(variable, "IntercoDirectCost", origin, destination);
 }
 
 void VariableNamer::IntercoIndirectCost(unsigned int variable,
-                                        const std::string& origin,
-                                        const std::string& destination)
+                                        const char* origin,
+                                        const char* destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(variable, "IntercoIndirectCost");
+    SetLinkElementName(variable, "IntercoIndirectCost", origin, destination);
 }
 
 void VariableNamer::SetShortTermStorageVariableName(unsigned int variable,
-                                                    const std::string& variableType,
+                                                    const char* variableType,
                                                     const std::string& shortTermStorageName)
 {
-    const auto location = LocationIdentifier(area_, AREA) + SEPARATOR + "ShortTermStorage" + "<"
-                          + shortTermStorageName + ">";
-    targetUpdater_.UpdateTargetAtIndex(BuildName(variableType,
-                                                 location,
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       variable);
+    set(variable,
+        {.type = variableType,
+         .area = area_,
+         .element = shortTermStorageName.c_str(),
+         .timeStep = timeStep_,
+         .location = ElementName::Location::shortTermStorage});
 }
-
 void VariableNamer::ShortTermStorageInjection(unsigned int variable,
                                               const std::string& shortTermStorageName)
 {
@@ -212,7 +276,12 @@ void VariableNamer::Overflow(unsigned int variable)
 
 void VariableNamer::LayerStorage(unsigned int variable, int layerIndex)
 {
-    SetAreaVariableName(variable, "LayerStorage", layerIndex);
+    set(variable,
+        {.type = "LayerStorage",
+         .area = area_,
+         .timeStep = timeStep_,
+         .layer = layerIndex,
+         .location = ElementName::Location::layer});
 }
 
 void VariableNamer::FinalStorage(unsigned int variable)
@@ -236,21 +305,17 @@ void VariableNamer::AreaBalance(unsigned int variable)
 }
 
 void ConstraintNamer::FlowDissociation(unsigned int constraint,
-                                       const std::string& origin,
-                                       const std::string& destination)
+                                       const char* origin,
+                                       const char* destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(constraint, "FlowDissociation");
+    SetLinkElementName(constraint, "FlowDissociation", origin, destination);
 }
 
 void ConstraintNamer::CsrFlowDissociation(unsigned int constraint,
-                                          const std::string& origin,
-                                          const std::string& destination)
+                                          const char* origin,
+                                          const char* destination)
 {
-    origin_ = origin;
-    destination_ = destination;
-    SetLinkElementName(constraint, "CsrFlowDissociation");
+    SetLinkElementName(constraint, "CsrFlowDissociation", origin, destination);
 }
 
 void ConstraintNamer::CsrAreaBalance(unsigned int constraint)
@@ -319,13 +384,14 @@ void ConstraintNamer::FinalStockExpression(unsigned int constraint)
 }
 
 void ConstraintNamer::nameWithTimeGranularity(unsigned int constraint,
-                                              const std::string& name,
-                                              const std::string& type)
+                                              const char* name,
+                                              ElementName::TimeStep type)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName(name,
-                                                 BindingConstraintTimeGranularity.at(type),
-                                                 TimeIdentifier(timeStep_, type)),
-                                       constraint);
+    set(constraint,
+        {.type = name,
+         .timeStep = timeStep_,
+         .location = ElementName::Location::bindingConstraint,
+         .timeStepType = type});
 }
 
 void ConstraintNamer::NbUnitsOutageLessThanNbUnitsStop(unsigned int constraint,
@@ -364,29 +430,30 @@ void ConstraintNamer::ConsistenceNODU(unsigned int constraint, const std::string
 
 void ConstraintNamer::ShortTermStorageLevel(unsigned int constraint, const std::string& name)
 {
-    targetUpdater_.UpdateTargetAtIndex(BuildName("Level",
-                                                 LocationIdentifier(area_, AREA) + SEPARATOR
-                                                   + "ShortTermStorage" + "<" + name + ">",
-                                                 TimeIdentifier(timeStep_, HOUR)),
-                                       constraint);
+    set(constraint,
+        {.type = "Level",
+         .area = area_,
+         .element = name.c_str(),
+         .timeStep = timeStep_,
+         .location = ElementName::Location::shortTermStorage});
 }
 
-void ConstraintNamer::BindingConstraintHour(unsigned int constraint, const std::string& name)
+void ConstraintNamer::BindingConstraintHour(unsigned int constraint, const char* name)
 {
-    nameWithTimeGranularity(constraint, name, HOUR);
+    nameWithTimeGranularity(constraint, name, ElementName::TimeStep::hour);
 }
 
-void ConstraintNamer::CsrBindingConstraintHour(unsigned int constraint, const std::string& name)
+void ConstraintNamer::CsrBindingConstraintHour(unsigned int constraint, const char* name)
 {
-    nameWithTimeGranularity(constraint, name, HOUR);
+    nameWithTimeGranularity(constraint, name, ElementName::TimeStep::hour);
 }
 
-void ConstraintNamer::BindingConstraintDay(unsigned int constraint, const std::string& name)
+void ConstraintNamer::BindingConstraintDay(unsigned int constraint, const char* name)
 {
-    nameWithTimeGranularity(constraint, name, DAY);
+    nameWithTimeGranularity(constraint, name, ElementName::TimeStep::day);
 }
 
-void ConstraintNamer::BindingConstraintWeek(unsigned int constraint, const std::string& name)
+void ConstraintNamer::BindingConstraintWeek(unsigned int constraint, const char* name)
 {
-    nameWithTimeGranularity(constraint, name, WEEK);
+    nameWithTimeGranularity(constraint, name, ElementName::TimeStep::week);
 }
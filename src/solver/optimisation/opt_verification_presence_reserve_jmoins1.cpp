@@ -35,8 +35,7 @@ void OPT_VerifierPresenceReserveJmoins1(PROBLEME_HEBDO* problemeHebdo)
 
     for (uint32_t pays = 0; pays < problemeHebdo->NombreDePays; pays++)
     {
-        const std::vector<double>& ReserveHoraireJMoins1 = ReserveJMoins1[pays]
-                                                             .ReserveHoraireJMoins1;
+        const auto& ReserveHoraireJMoins1 = ReserveJMoins1[pays].ReserveHoraireJMoins1;
         for (uint pdt = 0; pdt < problemeHebdo->NombreDePasDeTemps; pdt++)
         {
             if (fabs(ReserveHoraireJMoins1[pdt]) > ZERO_RESERVE_J_MOINS1)
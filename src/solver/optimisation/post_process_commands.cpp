@@ -21,6 +21,8 @@
 
 #include "antares/solver/optimisation/post_process_commands.h"
 
+#include <antares/logs/async_logs.h>
+
 #include "antares/solver/optimisation/adequacy_patch_csr/adq_patch_curtailment_sharing.h"
 #include "antares/solver/optimisation/adequacy_patch_local_matching/adequacy_patch_weekly_optimization.h"
 #include "antares/solver/simulation/adequacy_patch_runtime_data.h"
@@ -236,14 +238,14 @@ void CurtailmentSharingPostProcessCmd::execute(const optRuntimeData& opt_runtime
     unsigned int week = opt_runtime_data.week;
 
     double totalLmrViolation = calculateDensNewAndTotalLmrViolation();
-    logs.info() << "[adq-patch] Year:" << year + 1 << " Week:" << week + 1
-                << ".Total LMR violation:" << totalLmrViolation;
+    AsyncLogs::info() << "[adq-patch] Year:" << year + 1 << " Week:" << week + 1
+                      << ".Total LMR violation:" << totalLmrViolation;
     const std::set<int> hoursRequiringCurtailmentSharing = getHoursRequiringCurtailmentSharing();
     HourlyCSRProblem hourlyCsrProblem(adqPatchParams_, problemeHebdo_);
     for (int hourInWeek: hoursRequiringCurtailmentSharing)
     {
-        logs.info() << "[adq-patch] CSR triggered for Year:" << year + 1
-                    << " Hour:" << week * nbHoursInWeek + hourInWeek + 1;
+        AsyncLogs::info() << "[adq-patch] CSR triggered for Year:" << year + 1
+                          << " Hour:" << week * nbHoursInWeek + hourInWeek + 1;
         hourlyCsrProblem.setHour(hourInWeek);
         hourlyCsrProblem.run(week, year);
     }
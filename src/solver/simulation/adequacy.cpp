@@ -23,6 +23,7 @@
 
 #include <antares/exception/AssertionError.hpp>
 #include <antares/exception/UnfeasibleProblemError.hpp>
+#include "antares/solver/simulation/thermal_cluster_aggregation.h"
 
 using namespace Yuni;
 using Antares::Constants::nbHoursInAWeek;
@@ -31,8 +32,10 @@ namespace Antares::Solver::Simulation
 {
 Adequacy::Adequacy(Data::Study& study,
                    IResultWriter& resultWriter,
-                   Simulation::ISimulationObserver& simulationObserver):
+                   Simulation::ISimulationObserver& simulationObserver,
+                   std::vector<PROBLEME_HEBDO>* residentProblems):
     study(study),
+    pProblemesHebdo(residentProblems ? *residentProblems : ownProblemesHebdo_),
     resultWriter(resultWriter),
     simulationObserver_(simulationObserver)
 {
@@ -67,19 +70,27 @@ bool Adequacy::simulationBegin()
 {
     if (!preproOnly)
     {
-        pProblemesHebdo.resize(pNbMaxPerformedYearsInParallel);
-        for (uint numSpace = 0; numSpace < pNbMaxPerformedYearsInParallel; numSpace++)
+        // Same as Economy::simulationBegin(), for the resident weekly problems
+        if (pProblemesHebdo.size() != pNbMaxPerformedYearsInParallel)
         {
-            SIM_InitialisationProblemeHebdo(study,
-                                            pProblemesHebdo[numSpace],
-                                            nbHoursInAWeek,
-                                            numSpace);
+            pProblemesHebdo.clear();
+            pProblemesHebdo.resize(pNbMaxPerformedYearsInParallel);
+            for (uint numSpace = 0; numSpace < pNbMaxPerformedYearsInParallel; numSpace++)
+            {
+                SIM_InitialisationProblemeHebdo(study,
+                                                pProblemesHebdo[numSpace],
+                                                nbHoursInAWeek,
+                                                numSpace);
+            }
         }
     }
 
     for (auto& pb: pProblemesHebdo)
     {
         pb.TypeDOptimisation = OPTIMISATION_LINEAIRE;
+        // The binding constraints or their time-series numbers may have changed since a
+        // previous simulation of the resident problems
+        pb.SecondsMembresDesContraintesCouplantes = {};
     }
 
     pStartTime = study.calendar.days[study.parameters.simulationDays.first].hours.first;
@@ -215,6 +226,13 @@ bool Adequacy::year(Progression::Task& progression,
                                              resultWriter,
                                              simulationObserver_.get());
 
+                if (currentProblem.thermalClusterAggregation)
+                {
+                    currentProblem.thermalClusterAggregation->disaggregate(currentProblem,
+                                                                           state.year,
+                                                                           hourInTheYear);
+                }
+
                 computingHydroLevels(study.areas, currentProblem, false);
 
                 RemixHydroForAllAreas(study.areas,
@@ -402,7 +420,7 @@ void Adequacy::simulationEnd()
     if (!preproOnly && study.runtime.interconnectionsCount() > 0)
     {
         auto balance = retrieveBalance(study, variables);
-        ComputeFlowQuad(study, pProblemesHebdo[0], balance, pNbWeeks);
+        ComputeFlowQuad(study, pProblemesHebdo, balance, pNbWeeks);
     }
 }
 
@@ -31,11 +31,17 @@ void runSimulationInAdequacyMode(Antares::Data::Study& study,
                                  Benchmarking::DurationCollector& durationCollector,
                                  IResultWriter& resultWriter,
                                  Benchmarking::OptimizationInfo& info,
-                                 Simulation::ISimulationObserver& simulationObserver)
+                                 Simulation::ISimulationObserver& simulationObserver,
+                                 std::vector<PROBLEME_HEBDO>* residentProblems)
 {
     // Type of the simulation
     typedef Solver::Simulation::ISimulation<Solver::Simulation::Adequacy> SimulationType;
-    SimulationType simulation(study, settings, durationCollector, resultWriter, simulationObserver);
+    SimulationType simulation(study,
+                              settings,
+                              durationCollector,
+                              resultWriter,
+                              simulationObserver,
+                              residentProblems);
     simulation.checkWriter();
     simulation.run();
 
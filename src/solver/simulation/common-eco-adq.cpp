@@ -21,20 +21,60 @@
 
 #include "antares/solver/simulation/common-eco-adq.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <map>
 
+#include <antares/concurrency/concurrency.h>
 #include <antares/exception/UnfeasibleProblemError.hpp>
 #include <antares/logs/logs.h>
 #include <antares/study/study.h>
+#include "antares/solver/simulation/thermal_cluster_aggregation.h"
 #include "antares/study/simulation.h"
 
 namespace Antares::Solver::Simulation
 {
-static void RecalculDesEchangesMoyens(Data::Study& study,
+namespace
+{
+//! Average capacities of a link over the MC years, hour by hour
+struct AverageNTC
+{
+    std::vector<double> direct;
+    std::vector<double> indirect;
+    bool valid = false;
+};
+
+// The averages do not depend on the week, they are computed once for all the weeks
+std::vector<AverageNTC> retrieveAverageNTCOfAllLinks(const Data::Study& study)
+{
+    std::vector<AverageNTC> averages(study.runtime.interconnectionsCount());
+    for (uint j = 0; j < study.runtime.interconnectionsCount(); ++j)
+    {
+        auto* link = study.runtime.areaLink[j];
+        auto& average = averages[j];
+        int ret = retrieveAverageNTC(study,
+                                     link->directCapacities.timeSeries,
+                                     link->timeseriesNumbers,
+                                     average.direct);
+
+        ret = retrieveAverageNTC(study,
+                                 link->indirectCapacities.timeSeries,
+                                 link->timeseriesNumbers,
+                                 average.indirect)
+              && ret;
+        average.valid = !ret;
+        assert(average.valid && "invalid NTC");
+    }
+    return averages;
+}
+} // namespace
+
+// Return false if the quadratic optimization of the week has failed
+static bool RecalculDesEchangesMoyens(Data::Study& study,
                                       PROBLEME_HEBDO& problem,
                                       const std::vector<AvgExchangeResults*>& balance,
+                                      const std::vector<AverageNTC>& averageNTC,
                                       int PasDeTempsDebut)
 {
     for (uint i = 0; i < (uint)problem.NombreDePasDeTemps; i++)
@@ -58,29 +98,13 @@ static void RecalculDesEchangesMoyens(Data::Study& study,
             }
         }
 
-        std::vector<double> avgDirect;
-        std::vector<double> avgIndirect;
         for (uint j = 0; j < study.runtime.interconnectionsCount(); ++j)
         {
             auto* link = study.runtime.areaLink[j];
-            int ret = retrieveAverageNTC(study,
-                                         link->directCapacities.timeSeries,
-                                         link->timeseriesNumbers,
-                                         avgDirect);
-
-            ret = retrieveAverageNTC(study,
-                                     link->indirectCapacities.timeSeries,
-                                     link->timeseriesNumbers,
-                                     avgIndirect)
-                  && ret;
-            if (!ret)
+            if (const auto& average = averageNTC[j]; average.valid)
             {
-                ntcValues.ValeurDeNTCOrigineVersExtremite[j] = avgDirect[decalPasDeTemps];
-                ntcValues.ValeurDeNTCExtremiteVersOrigine[j] = avgIndirect[decalPasDeTemps];
-            }
-            else
-            {
-                assert(false && "invalid NTC");
+                ntcValues.ValeurDeNTCOrigineVersExtremite[j] = average.direct[decalPasDeTemps];
+                ntcValues.ValeurDeNTCExtremiteVersOrigine[j] = average.indirect[decalPasDeTemps];
             }
 
             auto& mtxParamaters = link->parameters;
@@ -88,6 +112,7 @@ static void RecalculDesEchangesMoyens(Data::Study& study,
         }
     }
 
+    bool succeeded = true;
     try
     {
         NullResultWriter resultWriter;
@@ -100,7 +125,7 @@ static void RecalculDesEchangesMoyens(Data::Study& study,
     }
     catch (Data::UnfeasibleProblemError&)
     {
-        study.runtime.quadraticOptimizationHasFailed = true;
+        succeeded = false;
     }
 
     for (uint i = 0; i < (uint)problem.NombreDePasDeTemps; ++i)
@@ -113,6 +138,7 @@ static void RecalculDesEchangesMoyens(Data::Study& study,
             transitMoyenInterconnexionsRecalculQuadratique[j][indx] = ntcValues.ValeurDuFlux[j];
         }
     }
+    return succeeded;
 }
 
 bool ShouldUseQuadraticOptimisation(const Data::Study& study)
@@ -140,22 +166,81 @@ bool ShouldUseQuadraticOptimisation(const Data::Study& study)
 }
 
 void ComputeFlowQuad(Data::Study& study,
-                     PROBLEME_HEBDO& problem,
+                     std::vector<PROBLEME_HEBDO>& problems,
                      const std::vector<AvgExchangeResults*>& balance,
                      uint nbWeeks)
 {
     uint startTime = study.calendar.days[study.parameters.simulationDays.first].hours.first;
+    const int nbHoursInWeek = problems[0].NombreDePasDeTemps;
 
     if (ShouldUseQuadraticOptimisation(study))
     {
         logs.info() << "Post-processing... (quadratic optimisation)";
 
-        problem.TypeDOptimisation = OPTIMISATION_QUADRATIQUE;
-        problem.LeProblemeADejaEteInstancie = false;
-        for (uint w = 0; w != nbWeeks; ++w)
+        const auto averageNTC = retrieveAverageNTCOfAllLinks(study);
+
+        // The weeks are independent. They are dispatched by ranges on the (idle) threads of the
+        // MC years, each with the weekly problem of a space, where the structure of the
+        // quadratic problem is built once and reused for all its weeks.
+        // A space where no year was computed has no allocated problem.
+        std::vector<PROBLEME_HEBDO*> workers;
+        for (auto& problem: problems)
         {
-            int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
-            RecalculDesEchangesMoyens(study, problem, balance, PasDeTempsDebut);
+            if (problem.ProblemeAResoudre || workers.empty())
+            {
+                workers.push_back(&problem);
+            }
+        }
+        auto* queueService = study.pQueueService.get();
+        uint nbTasks = queueService ? std::min({queueService->maximumThreadCount(),
+                                                (uint)workers.size(),
+                                                std::max(nbWeeks, 1u)})
+                                    : 1;
+
+        // One flag per task, the study is only updated once all the weeks are done
+        std::vector<char> failed(nbTasks, false);
+        auto computeWeeks = [&](uint task)
+        {
+            PROBLEME_HEBDO& problem = *workers[task];
+            problem.TypeDOptimisation = OPTIMISATION_QUADRATIQUE;
+            problem.LeProblemeADejaEteInstancie = false;
+            uint first = task * nbWeeks / nbTasks;
+            uint last = (task + 1) * nbWeeks / nbTasks;
+            for (uint w = first; w != last; ++w)
+            {
+                int PasDeTempsDebut = startTime + (w * nbHoursInWeek);
+                if (!RecalculDesEchangesMoyens(study,
+                                               problem,
+                                               balance,
+                                               averageNTC,
+                                               PasDeTempsDebut))
+                {
+                    failed[task] = true;
+                }
+            }
+        };
+
+        if (nbTasks <= 1)
+        {
+            computeWeeks(0);
+        }
+        else
+        {
+            Concurrency::FutureSet results;
+            for (uint t = 0; t != nbTasks; ++t)
+            {
+                results.add(
+                  Concurrency::AddTask(*queueService, [&computeWeeks, t]() { computeWeeks(t); }));
+            }
+            queueService->start();
+            queueService->wait(Yuni::qseIdle);
+            queueService->stop();
+            results.join();
+        }
+
+        if (std::ranges::any_of(failed, [](char f) { return f; }))
+        {
+            study.runtime.quadraticOptimizationHasFailed = true;
         }
     }
     else
@@ -166,8 +251,8 @@ void ComputeFlowQuad(Data::Study& study,
         {
             for (uint w = 0; w != nbWeeks; ++w)
             {
-                int PasDeTempsDebut = startTime + (w * problem.NombreDePasDeTemps);
-                for (uint i = 0; i < (uint)problem.NombreDePasDeTemps; ++i)
+                int PasDeTempsDebut = startTime + (w * nbHoursInWeek);
+                for (int i = 0; i < nbHoursInWeek; ++i)
                 {
                     const uint indx = i + PasDeTempsDebut;
                     transitMoyenInterconnexionsRecalculQuadratique[j][indx] = 0;
@@ -357,6 +442,36 @@ void SetInitialHydroLevel(Data::Study& study,
       });
 }
 
+static void buildAggregatedThermalClusters(PALIERS_THERMIQUES& paliers,
+                                           const ThermalClusterAggregation& aggregation,
+                                           uint areaIdx,
+                                           uint hourInWeek,
+                                           uint hourInYear,
+                                           const std::vector<double>& thermalNoises,
+                                           uint year)
+{
+    for (int g = 0; g < paliers.NombreDePaliersThermiques; ++g)
+    {
+        const auto& clusters = aggregation.clustersOf(areaIdx, g);
+        const auto& first = *clusters.front();
+        auto& Pt = paliers.PuissanceDisponibleEtCout[g];
+
+        Pt.CoutHoraireDeProductionDuPalierThermique[hourInWeek]
+          = first.getMarketBidCost(hourInYear, year) + thermalNoises[first.areaWideIndex];
+
+        double availablePower = 0.;
+        double minPower = 0.;
+        for (const auto* cluster: clusters)
+        {
+            const double available = cluster->series.getCoefficient(year, hourInYear);
+            availablePower += available;
+            minPower += std::min(available, cluster->PthetaInf[hourInYear]);
+        }
+        Pt.PuissanceDisponibleDuPalierThermique[hourInWeek] = availablePower;
+        Pt.PuissanceMinDuPalierThermique[hourInWeek] = minPower;
+    }
+}
+
 void BuildThermalPartOfWeeklyProblem(Data::Study& study,
                                      PROBLEME_HEBDO& problem,
                                      const int PasDeTempsDebut,
@@ -365,12 +480,24 @@ void BuildThermalPartOfWeeklyProblem(Data::Study& study,
 {
     int hourInYear = PasDeTempsDebut;
     const uint nbPays = study.areas.size();
+    const auto* aggregation = problem.thermalClusterAggregation.get();
     for (unsigned hourInWeek = 0; hourInWeek < problem.NombreDePasDeTemps;
          ++hourInWeek, ++hourInYear)
     {
         for (uint areaIdx = 0; areaIdx < nbPays; ++areaIdx)
         {
             auto& area = *study.areas.byIndex[areaIdx];
+            if (aggregation)
+            {
+                buildAggregatedThermalClusters(problem.PaliersThermiquesDuPays[areaIdx],
+                                               *aggregation,
+                                               areaIdx,
+                                               hourInWeek,
+                                               hourInYear,
+                                               thermalNoises[areaIdx],
+                                               year);
+                continue;
+            }
             for (auto& cluster: area.thermal.list.each_enabled_and_not_mustrun())
             {
                 auto& Pt = problem.PaliersThermiquesDuPays[areaIdx]
@@ -395,9 +522,8 @@ void BuildThermalPartOfWeeklyProblem(Data::Study& study,
 
     for (uint k = 0; k < nbPays; ++k)
     {
-        auto& area = *study.areas.byIndex[k];
-
-        for (uint l = 0; l != area.thermal.list.enabledAndNotMustRunCount(); ++l)
+        const int nbPaliers = problem.PaliersThermiquesDuPays[k].NombreDePaliersThermiques;
+        for (int l = 0; l != nbPaliers; ++l)
         {
             problem.PaliersThermiquesDuPays[k]
               .PuissanceDisponibleEtCout[l]
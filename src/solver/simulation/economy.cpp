@@ -27,6 +27,7 @@
 #include "antares/solver/optimisation/opt_fonctions.h"
 #include "antares/solver/simulation/common-eco-adq.h"
 #include "antares/solver/simulation/simulation.h"
+#include "antares/solver/simulation/thermal_cluster_aggregation.h"
 
 using namespace Yuni;
 using Antares::Constants::nbHoursInAWeek;
@@ -35,9 +36,11 @@ namespace Antares::Solver::Simulation
 {
 Economy::Economy(Data::Study& study,
                  IResultWriter& resultWriter,
-                 Simulation::ISimulationObserver& simulationObserver):
+                 Simulation::ISimulationObserver& simulationObserver,
+                 std::vector<PROBLEME_HEBDO>* residentProblems):
     study(study),
     preproOnly(false),
+    pProblemesHebdo(residentProblems ? *residentProblems : ownProblemesHebdo_),
     resultWriter(resultWriter),
     simulationObserver_(simulationObserver)
 {
@@ -70,16 +73,26 @@ bool Economy::simulationBegin()
 {
     if (!preproOnly)
     {
-        pProblemesHebdo.resize(pNbMaxPerformedYearsInParallel);
+        // Weekly problems kept from a previous simulation of the study are reused as they are,
+        // like from one MC year to the next
+        const bool resident = pProblemesHebdo.size() == pNbMaxPerformedYearsInParallel;
+        if (!resident)
+        {
+            pProblemesHebdo.clear();
+            pProblemesHebdo.resize(pNbMaxPerformedYearsInParallel);
+        }
         weeklyOptProblems_.resize(pNbMaxPerformedYearsInParallel);
         postProcessesList_.resize(pNbMaxPerformedYearsInParallel);
 
         for (uint numSpace = 0; numSpace < pNbMaxPerformedYearsInParallel; numSpace++)
         {
-            SIM_InitialisationProblemeHebdo(study,
-                                            pProblemesHebdo[numSpace],
-                                            nbHoursInAWeek,
-                                            numSpace);
+            if (!resident)
+            {
+                SIM_InitialisationProblemeHebdo(study,
+                                                pProblemesHebdo[numSpace],
+                                                nbHoursInAWeek,
+                                                numSpace);
+            }
 
             auto options = createOptimizationOptions(study);
             weeklyOptProblems_[numSpace] = Antares::Solver::Optimization::WeeklyOptimization::
@@ -104,6 +117,9 @@ bool Economy::simulationBegin()
     for (auto& pb: pProblemesHebdo)
     {
         pb.TypeDOptimisation = OPTIMISATION_LINEAIRE;
+        // The binding constraints or their time-series numbers may have changed since a
+        // previous simulation of the resident problems
+        pb.SecondsMembresDesContraintesCouplantes = {};
     }
 
     pStartTime = study.calendar.days[study.parameters.simulationDays.first].hours.first;
@@ -165,6 +181,13 @@ bool Economy::year(Progression::Task& progression,
         {
             weeklyOptProblems_[numSpace]->solve();
 
+            if (currentProblem.thermalClusterAggregation)
+            {
+                currentProblem.thermalClusterAggregation->disaggregate(currentProblem,
+                                                                       state.year,
+                                                                       hourInTheYear);
+            }
+
             // Runs all the post processes in the list of post-process commands
             optRuntimeData opt_runtime_data(state.year, w, hourInTheYear);
             postProcessesList_[numSpace]->runAll(opt_runtime_data);
@@ -266,7 +289,7 @@ void Economy::simulationEnd()
     if (!preproOnly && study.runtime.interconnectionsCount() > 0)
     {
         auto balance = retrieveBalance(study, variables);
-        ComputeFlowQuad(study, pProblemesHebdo[0], balance, pNbWeeks);
+        ComputeFlowQuad(study, pProblemesHebdo, balance, pNbWeeks);
     }
 }
 
@@ -46,6 +46,15 @@ public:
                                     int optimizationNumber,
                                     std::string_view name)
       = 0;
+
+    /**
+     * @brief Whether the names of the variables and constraints of the notified problems are read.
+     * @details The names are only built when they are needed.
+     */
+    virtual bool needsNames() const
+    {
+        return true;
+    }
 };
 
 /**
@@ -62,5 +71,10 @@ public:
     {
         // null object pattern
     }
+
+    bool needsNames() const override
+    {
+        return false;
+    }
 };
 } // namespace Antares::Solver::Simulation
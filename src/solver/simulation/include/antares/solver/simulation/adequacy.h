@@ -47,10 +47,12 @@ public:
     ** \brief Constructor
     **
     ** \param study The current study
+    ** \param residentProblems Weekly problems kept between the simulations (may be null)
     */
     Adequacy(Data::Study& study,
              IResultWriter& resultWriter,
-             Simulation::ISimulationObserver& simulationObserver);
+             Simulation::ISimulationObserver& simulationObserver,
+             std::vector<PROBLEME_HEBDO>* residentProblems = nullptr);
     //! Destructor
     ~Adequacy() = default;
     //@}
@@ -98,7 +100,10 @@ private:
     uint pNbWeeks;
     uint pStartTime;
     uint pNbMaxPerformedYearsInParallel;
-    std::vector<PROBLEME_HEBDO> pProblemesHebdo;
+    //! Weekly problems of this simulation, when they are not kept by the caller
+    std::vector<PROBLEME_HEBDO> ownProblemesHebdo_;
+    //! One weekly problem per space
+    std::vector<PROBLEME_HEBDO>& pProblemesHebdo;
     Matrix<> pRES;
     IResultWriter& resultWriter;
 
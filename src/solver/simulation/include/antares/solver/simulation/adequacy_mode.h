@@ -22,17 +22,23 @@
 
 #pragma once
 
+#include <vector>
+
 #include "antares/infoCollection/StudyInfoCollector.h"
 #include "antares/solver/misc/options.h"
 #include "antares/solver/simulation/ISimulationObserver.h"
 #include "antares/writer/i_writer.h"
 
+struct PROBLEME_HEBDO;
+
 namespace Antares::Solver
 {
+//! Same as runSimulationInEconomicMode(), for the adequacy mode
 void runSimulationInAdequacyMode(Antares::Data::Study& study,
                                  const Settings& settings,
                                  Benchmarking::DurationCollector& durationCollector,
                                  IResultWriter& resultWriter,
                                  Benchmarking::OptimizationInfo& info,
-                                 Simulation::ISimulationObserver& simulationObserver);
+                                 Simulation::ISimulationObserver& simulationObserver,
+                                 std::vector<PROBLEME_HEBDO>* residentProblems = nullptr);
 }
@@ -78,9 +78,11 @@ bool ShouldUseQuadraticOptimisation(const Data::Study& study);
 
 /*!
 ** \brief Perform the quadratic optimization (links) (eco+adq)
+**
+** The weeks are optimized in parallel, with the weekly problems of the spaces
 */
 void ComputeFlowQuad(Data::Study& study,
-                     PROBLEME_HEBDO& problem,
+                     std::vector<PROBLEME_HEBDO>& problems,
                      const std::vector<AvgExchangeResults*>& balance,
                      unsigned int nbWeeks);
 
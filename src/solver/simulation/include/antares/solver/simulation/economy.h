@@ -49,10 +49,12 @@ public:
     ** \brief Constructor
     **
     ** \param study The current study
+    ** \param residentProblems Weekly problems kept between the simulations (may be null)
     */
     Economy(Data::Study& study,
             IResultWriter& resultWriter,
-            Simulation::ISimulationObserver& simulationObserver);
+            Simulation::ISimulationObserver& simulationObserver,
+            std::vector<PROBLEME_HEBDO>* residentProblems = nullptr);
     //! Destructor
     ~Economy() = default;
     //@}
@@ -97,7 +99,10 @@ private:
     uint pNbWeeks;
     uint pStartTime;
     uint pNbMaxPerformedYearsInParallel;
-    std::vector<PROBLEME_HEBDO> pProblemesHebdo;
+    //! Weekly problems of this simulation, when they are not kept by the caller
+    std::vector<PROBLEME_HEBDO> ownProblemesHebdo_;
+    //! One weekly problem per space
+    std::vector<PROBLEME_HEBDO>& pProblemesHebdo;
     std::vector<std::unique_ptr<Antares::Solver::Optimization::WeeklyOptimization>>
       weeklyOptProblems_;
     std::vector<std::unique_ptr<interfacePostProcessList>> postProcessesList_;
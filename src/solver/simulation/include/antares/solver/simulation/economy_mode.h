@@ -22,17 +22,29 @@
 
 #pragma once
 
+#include <vector>
+
 #include "antares/infoCollection/StudyInfoCollector.h"
 #include "antares/solver/misc/options.h"
 #include "antares/solver/simulation/ISimulationObserver.h"
 #include "antares/writer/i_writer.h"
 
+struct PROBLEME_HEBDO;
+
 namespace Antares::Solver
 {
+/*!
+** \brief Run a simulation of the study
+**
+** \param residentProblems Weekly problems to reuse from a previous simulation of the same study,
+**   and to keep for the next one (see SimulationSession). Allocated for this simulation only
+**   if null.
+*/
 void runSimulationInEconomicMode(Antares::Data::Study& study,
                                  const Settings& settings,
                                  Benchmarking::DurationCollector& durationCollector,
                                  IResultWriter& resultWriter,
                                  Benchmarking::OptimizationInfo& info,
-                                 Simulation::ISimulationObserver& simulationObserver);
+                                 Simulation::ISimulationObserver& simulationObserver,
+                                 std::vector<PROBLEME_HEBDO>* residentProblems = nullptr);
 }
@@ -30,12 +30,19 @@ class OptimizationStatisticsWriter
 {
 public:
     void addTime(uint week, const TIME_MEASURES& timeMeasure);
-    OptimizationStatisticsWriter(Antares::Solver::IResultWriter& writer, uint year);
+    OptimizationStatisticsWriter(Antares::Solver::IResultWriter& writer,
+                                 uint year,
+                                 bool solverRacing = false,
+                                 bool presolve = false);
     void finalize();
 
 private:
     void printHeader();
     std::ostringstream pBuffer;
     uint pYear;
+    //! Add the winners of the raced resolutions
+    bool pSolverRacing;
+    //! Add the number of variables and constraints removed by the presolve
+    bool pPresolve;
     Antares::Solver::IResultWriter& pWriter;
 };
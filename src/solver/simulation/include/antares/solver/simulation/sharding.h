@@ -0,0 +1,139 @@
+
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <yuni/yuni.h>
+
+#include "antares/solver/variable/storage/minmax-data.h"
+
+namespace Antares::Solver::Simulation
+{
+//! Path, relative to the output folder, of the partial results saved by a shard
+constexpr const char* shardAccumulatorsFilename = "shard-accumulators.bin";
+
+/*!
+** \brief Restrict the playlist to the MC years of a shard
+**
+** The performed years are split into `count` contiguous blocks of (almost) equal size, the shard
+** `index` (zero-based) keeping the block of the same rank. Contiguous blocks allow to merge the
+** shards in the order of the MC years, as a single simulation would.
+*/
+std::vector<bool> shardYearsFilter(const std::vector<bool>& yearsFilter, uint index, uint count);
+
+//! Header of the accumulators saved by a shard, to check they match the merging study
+struct ShardHeader
+{
+    uint32_t index;
+    uint32_t count;
+    uint32_t nbYears;
+    uint32_t nbPerformedYears;
+};
+
+/*!
+** \brief Visitor serializing the accumulators of the variables and of the annual costs
+*/
+class AccumulatorsWriter final
+{
+public:
+    explicit AccumulatorsWriter(const ShardHeader& header);
+
+    void sum(const double* values, std::size_t count);
+    void minimum(const std::vector<Variable::R::AllYears::MinMaxData::Data>& values);
+    void maximum(const std::vector<Variable::R::AllYears::MinMaxData::Data>& values);
+    void minimum(double value);
+    void maximum(double value);
+
+    std::string& content()
+    {
+        return content_;
+    }
+
+private:
+    template<class T>
+    void write(const T* values, std::size_t count);
+
+    std::string content_;
+};
+
+/*!
+** \brief Visitor adding the accumulators saved by a shard to the ones of the simulation
+**
+** Sums are added, min and max are merged with the same tolerance as MinMaxData, keeping the
+** MC year of the first extremum found.
+*/
+class AccumulatorsMerger final
+{
+public:
+    /*!
+    ** \param content The content saved by AccumulatorsWriter
+    ** \param origin  Where the content comes from, for the error messages
+    ** \throw FatalError if the content is not the accumulators of a shard
+    */
+    AccumulatorsMerger(std::string content, std::string origin);
+
+    const ShardHeader& header() const
+    {
+        return header_;
+    }
+
+    const std::string& origin() const
+    {
+        return origin_;
+    }
+
+    void sum(double* values, std::size_t count);
+    void minimum(std::vector<Variable::R::AllYears::MinMaxData::Data>& values);
+    void maximum(std::vector<Variable::R::AllYears::MinMaxData::Data>& values);
+    void minimum(double& value);
+    void maximum(double& value);
+
+    //! \throw FatalError if some values were not consumed, i.e. the study has changed
+    void checkAllMerged() const;
+
+private:
+    template<class T>
+    void read(T* values, std::size_t count);
+
+    std::string content_;
+    std::string origin_;
+    std::size_t offset_ = 0;
+    ShardHeader header_;
+    std::vector<double> buffer_;
+    std::vector<Variable::R::AllYears::MinMaxData::Data> minmaxBuffer_;
+};
+
+/*!
+** \brief Load the accumulators saved in the output folders of all the shards of a simulation
+**
+** \return The accumulators, ordered by shard index
+** \throw FatalError if a shard is missing or does not match the given number of MC years
+*/
+std::vector<AccumulatorsMerger> loadShardAccumulators(const std::vector<std::string>& outputs,
+                                                      uint nbYears,
+                                                      uint nbPerformedYears);
+
+} // namespace Antares::Solver::Simulation
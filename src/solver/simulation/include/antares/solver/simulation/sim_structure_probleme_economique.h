@@ -24,6 +24,8 @@
 
 #include <memory>
 #include <optional>
+#include <span>
+#include <string>
 #include <vector>
 
 #include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
@@ -32,6 +34,7 @@
 #include "antares/study/study.h"
 
 class AdequacyPatchRuntimeData;
+class ThermalClusterAggregation;
 
 struct CORRESPONDANCES_DES_VARIABLES
 {
@@ -162,6 +165,18 @@ struct CONTRAINTES_COUPLANTES
     std::shared_ptr<Data::BindingConstraint> bindingConstraint;
 };
 
+//! RHS time-series of the active binding constraints, looked up once per year
+//! (reset at the beginning of each simulation)
+struct SECONDS_MEMBRES_DES_CONTRAINTES_COUPLANTES
+{
+    //! Group of each active constraint (nullptr if none), resolved once per simulation
+    std::vector<const Data::BindingConstraintGroup*> groups;
+    //! Year the columns were looked up for
+    std::optional<uint32_t> year;
+    //! RHS column of each active constraint for this year
+    std::vector<const double*> columns;
+};
+
 namespace ShortTermStorage
 {
 struct PROPERTIES
@@ -394,7 +409,8 @@ public:
 
 struct RESERVE_JMOINS1
 {
-    std::vector<double> ReserveHoraireJMoins1;
+    //! View on the hours of the current week in the study data
+    std::span<const double> ReserveHoraireJMoins1;
 };
 
 struct PRODUCTION_THERMIQUE_OPTIMALE
@@ -440,14 +456,20 @@ struct COUTS_DE_TRANSPORT
     std::vector<double> CoutDeTransportOrigineVersExtremite;
     std::vector<double> CoutDeTransportExtremiteVersOrigine;
 
-    std::vector<double> CoutDeTransportOrigineVersExtremiteRef;
-    std::vector<double> CoutDeTransportExtremiteVersOrigineRef;
+    //! Views on the hours of the current week in the study data
+    std::span<const double> CoutDeTransportOrigineVersExtremiteRef;
+    std::span<const double> CoutDeTransportExtremiteVersOrigineRef;
 };
 
 struct TIME_MEASURE
 {
     long solveTime = 0;
     long updateTime = 0;
+    //! Solver which found the solution of a raced resolution, empty if it was not raced
+    std::string racingWinner;
+    //! Variables and constraints removed by the presolve
+    int removedVariables = 0;
+    int removedConstraints = 0;
 };
 
 using TIME_MEASURES = std::array<TIME_MEASURE, 2>;
@@ -515,6 +537,7 @@ struct PROBLEME_HEBDO
 
     uint32_t NombreDeContraintesCouplantes = 0;
     std::vector<CONTRAINTES_COUPLANTES> MatriceDesContraintesCouplantes;
+    SECONDS_MEMBRES_DES_CONTRAINTES_COUPLANTES SecondsMembresDesContraintesCouplantes;
     std::unordered_map<std::shared_ptr<Data::BindingConstraint>, std::vector<double>>
       ResultatsContraintesCouplantes;
 
@@ -563,10 +586,15 @@ struct PROBLEME_HEBDO
     std::vector<ALL_MUST_RUN_GENERATION> AllMustRunGeneration;
 
     OptimizationStatistics optimizationStatistics[2];
+    /* Queue running the challengers of the solver racing, null if not enabled */
+    Yuni::Job::QueueService* racingQueue = nullptr;
 
     /* Adequacy Patch */
     std::shared_ptr<AdequacyPatchRuntimeData> adequacyPatchRuntimeData;
 
+    /* Thermal clusters optimized as aggregated clusters, none if not enabled */
+    std::shared_ptr<const ThermalClusterAggregation> thermalClusterAggregation;
+
     /* Hydro management */
     std::vector<double> CoefficientEcretementPMaxHydraulique;
     std::vector<double> previousSimulationFinalLevel;
@@ -51,12 +51,15 @@ public:
     //@{
     /*!
     ** \brief Constructor (with a given study)
+    **
+    ** \param residentProblems Weekly problems kept between the simulations (may be null)
     */
     ISimulation(Data::Study& study,
                 const ::Settings& settings,
                 Benchmarking::DurationCollector& duration_collector,
                 IResultWriter& resultWriter,
-                Simulation::ISimulationObserver& simulationObserver);
+                Simulation::ISimulationObserver& simulationObserver,
+                std::vector<PROBLEME_HEBDO>* residentProblems = nullptr);
     //! Destructor
     ~ISimulation();
     //@}
@@ -89,6 +92,9 @@ private:
     */
     void regenerateTimeSeries(uint year);
 
+    //! Generate the time-series of the thermal clusters, and write them if required
+    void regenerateThermalTimeSeries(uint year);
+
     /*!
     ** \brief Builds sets of parallel years
     **
@@ -137,6 +143,20 @@ private:
     */
     void loopThroughYears(uint firstYear, uint endYear, std::vector<Variable::State>& state);
 
+    /*!
+    ** \brief Save the partial results of a shard into the output folder
+    **
+    ** Must be called before the post operations, which are performed on the merged results.
+    */
+    void saveShardAccumulators();
+
+    /*!
+    ** \brief Merge the partial results of all the shards of the simulation (--merge-shards)
+    **
+    ** Replaces the loop through the MC years, the results being those of a single simulation.
+    */
+    void mergeShards();
+
     //! Some temporary to avoid performing useless complex checks
     Solver::Private::Simulation::CacheData pData;
     //!
@@ -29,12 +29,15 @@
 #include <antares/benchmarking/timer.h>
 #include <antares/date/date.h>
 #include <antares/exception/InitializationError.hpp>
+#include <antares/logs/async_logs.h>
 #include <antares/logs/logs.h>
 #include "antares/concurrency/concurrency.h"
 #include "antares/solver/hydro/management/HydroInputsChecker.h"
 #include "antares/solver/hydro/management/management.h"
 #include "antares/solver/simulation/opt_time_writer.h"
+#include "antares/solver/simulation/sharding.h"
 #include "antares/solver/simulation/timeseries-numbers.h"
+#include "antares/solver/simulation/year_by_year_exporter.h"
 #include "antares/solver/ts-generator/generator.h"
 #include "antares/solver/variable/print.h"
 
@@ -55,7 +58,8 @@ public:
             bool pPerformCalculations,
             Data::Study& pStudy,
             Variable::State& pState,
-            bool pYearByYear,
+            YearByYearExporter* pYearByYearExporter,
+            AsyncLogs& pAsyncLogs,
             Benchmarking::DurationCollector& durationCollector,
             IResultWriter& resultWriter,
             ISimulationObserver& simulationObserver):
@@ -69,7 +73,8 @@ public:
         performCalculations(pPerformCalculations),
         study(pStudy),
         state(pState),
-        yearByYear(pYearByYear),
+        yearByYearExporter(pYearByYearExporter),
+        asyncLogs(pAsyncLogs),
         pDurationCollector(durationCollector),
         pResultWriter(resultWriter),
         simulationObserver_(simulationObserver),
@@ -93,7 +98,10 @@ private:
     bool performCalculations;
     Data::Study& study;
     Variable::State& state;
-    bool yearByYear;
+    //! Null when the year-by-year results are not written
+    YearByYearExporter* yearByYearExporter;
+    //! Sink of the logs emitted while the year is computed
+    AsyncLogs& asyncLogs;
     Benchmarking::DurationCollector& pDurationCollector;
     IResultWriter& pResultWriter;
     std::reference_wrapper<ISimulationObserver> simulationObserver_;
@@ -121,15 +129,15 @@ private:
             std::string failedStr = failedWeekList.size() != 1 ? " failed at weeks "
                                                                : " failed at week ";
 
-            logs.info(); // empty line
+            AsyncLogs::info(); // empty line
 
             if (Data::stopSimulation(study.parameters.include.unfeasibleProblemBehavior))
             {
-                logs.fatal() << "Year " << y + 1 << failedStr << s << ".";
+                AsyncLogs::fatal() << "Year " << y + 1 << failedStr << s << ".";
             }
             else
             {
-                logs.warning() << "Year " << y + 1 << failedStr << s << ".";
+                AsyncLogs::warning() << "Year " << y + 1 << failedStr << s << ".";
             }
         }
     }
@@ -141,6 +149,9 @@ public:
 
         if (performCalculations)
         {
+            // The logs of the year are written in the background, in order
+            AsyncLogs::Binding logsBinding(asyncLogs, numSpace);
+
             // Index of the current year in the list of structures
             uint indexYear = randomForParallelYears.yearNumberToIndex[y];
 
@@ -164,6 +175,11 @@ public:
             state.year = y;
 
             // 5 - Resetting all variables for the output
+            // The results of the previous year computed in this space may still be exported
+            if (yearByYearExporter)
+            {
+                yearByYearExporter->waitFor(numSpace);
+            }
             simulation_->variables.yearBegin(y, numSpace);
 
             // 6 - The Solver itself
@@ -171,7 +187,11 @@ public:
                                                     && not firstSetParallelWithAPerformedYearWasRun;
             std::list<uint> failedWeekList;
 
-            OptimizationStatisticsWriter optWriter(pResultWriter, y);
+            OptimizationStatisticsWriter optWriter(pResultWriter,
+                                                   y,
+                                                   !study.parameters.optOptions.racingSolver
+                                                      .empty(),
+                                                   study.parameters.optOptions.presolve);
             yearFailed[y] = !simulation_->year(progression,
                                                state,
                                                numSpace,
@@ -198,15 +218,25 @@ public:
             simulation_->variables.yearEndSpatialAggregates(simulation_->variables, y, numSpace);
 
             // 9 - Write results for the current year
-            if (yearByYear)
+            if (yearByYearExporter)
             {
-                pDurationCollector("yby_export") << [this]
-                {
-                    // Before writing, some variable may require minor modifications
-                    simulation_->variables.beforeYearByYearExport(y, numSpace);
-                    // writing the results for the current year into the output
-                    simulation_->writeResults(false, y, numSpace); // false for synthesis
-                };
+                // Before writing, some variable may require minor modifications
+                simulation_->variables.beforeYearByYearExport(y, numSpace);
+
+                // Writing the results for the current year into the output, in the background
+                // The values of the space are not modified until the next year using it
+                yearByYearExporter->add(numSpace,
+                                        [simulation = simulation_,
+                                         &durationCollector = pDurationCollector,
+                                         year = y,
+                                         space = numSpace]
+                                        {
+                                            durationCollector("yby_export") << [&]
+                                            {
+                                                // false for synthesis
+                                                simulation->writeResults(false, year, space);
+                                            };
+                                        });
             }
         }
         else
@@ -228,8 +258,9 @@ inline ISimulation<ImplementationType>::ISimulation(
   const ::Settings& settings,
   Benchmarking::DurationCollector& duration_collector,
   IResultWriter& resultWriter,
-  Simulation::ISimulationObserver& simulationObserver):
-    ImplementationType(study, resultWriter, simulationObserver),
+  Simulation::ISimulationObserver& simulationObserver,
+  std::vector<PROBLEME_HEBDO>* residentProblems):
+    ImplementationType(study, resultWriter, simulationObserver, residentProblems),
     study(study),
     settings(settings),
     pNbYearsReallyPerformed(0),
@@ -338,14 +369,25 @@ void ISimulation<ImplementationType>::run()
         }
 
         uint finalYear = 1 + study.runtime.rangeLimits.year[Data::rangeEnd];
+        if (settings.shardsToMerge.empty())
         {
             pDurationCollector("mc_years")
               << [finalYear, &state, this] { loopThroughYears(0, finalYear, state); };
         }
+        else
+        {
+            pDurationCollector("shards_merge") << [this] { mergeShards(); };
+        }
         // Destroy the TS Generators if any
         // It will export the time-series into the output in the same time
         TSGenerator::DestroyAll(study);
 
+        if (settings.shardCount)
+        {
+            // The post operations are performed once the shards are merged
+            return;
+        }
+
         // Post operations
         pDurationCollector("post_processing") << [this] { ImplementationType::simulationEnd(); };
 
@@ -387,6 +429,11 @@ void ISimulation<ImplementationType>::writeResults(bool synthesis, uint year, ui
                 logs.info() << "The simulation synthesis is disabled.";
                 return;
             }
+            if (settings.shardCount)
+            {
+                logs.info() << "The synthesis of a shard is written when merging all the shards.";
+                return;
+            }
         }
 
         // The target folder
@@ -420,59 +467,114 @@ void ISimulation<ImplementationType>::regenerateTimeSeries(uint year)
     // * Both options "Preprocessor" and "Refresh" are checked in the interface
     //   _and_ the refresh must be done for the given year (always done for the first year).
     using namespace TSGenerator;
+
+    // The generators are independent: each one has its own random number generator
+    // (see Data::SeedIndex) and only writes the time-series it is in charge of.
+    // They are run concurrently, the results do not depend on the scheduling.
+    std::vector<std::pair<const char*, std::function<void()>>> generators;
+
     // Load
     if (pData.haveToRefreshTSLoad && (year % pData.refreshIntervalLoad == 0))
     {
-        pDurationCollector("tsgen_load")
-          << [year, this] { GenerateTimeSeries<Data::timeSeriesLoad>(study, year, pResultWriter); };
+        generators.emplace_back("tsgen_load",
+                                [year, this]
+                                {
+                                    GenerateTimeSeries<Data::timeSeriesLoad>(study,
+                                                                             year,
+                                                                             pResultWriter);
+                                });
     }
     // Solar
     if (pData.haveToRefreshTSSolar && (year % pData.refreshIntervalSolar == 0))
     {
-        pDurationCollector("tsgen_solar") << [year, this]
-        { GenerateTimeSeries<Data::timeSeriesSolar>(study, year, pResultWriter); };
+        generators.emplace_back("tsgen_solar",
+                                [year, this]
+                                {
+                                    GenerateTimeSeries<Data::timeSeriesSolar>(study,
+                                                                              year,
+                                                                              pResultWriter);
+                                });
     }
     // Wind
     if (pData.haveToRefreshTSWind && (year % pData.refreshIntervalWind == 0))
     {
-        pDurationCollector("tsgen_wind")
-          << [year, this] { GenerateTimeSeries<Data::timeSeriesWind>(study, year, pResultWriter); };
+        generators.emplace_back("tsgen_wind",
+                                [year, this]
+                                {
+                                    GenerateTimeSeries<Data::timeSeriesWind>(study,
+                                                                             year,
+                                                                             pResultWriter);
+                                });
     }
     // Hydro
     if (pData.haveToRefreshTSHydro && (year % pData.refreshIntervalHydro == 0))
     {
-        pDurationCollector("tsgen_hydro") << [year, this]
-        { GenerateTimeSeries<Data::timeSeriesHydro>(study, year, pResultWriter); };
+        generators.emplace_back("tsgen_hydro",
+                                [year, this]
+                                {
+                                    GenerateTimeSeries<Data::timeSeriesHydro>(study,
+                                                                              year,
+                                                                              pResultWriter);
+                                });
     }
 
     // Thermal
-    const bool refreshTSonCurrentYear = (year % pData.refreshIntervalThermal == 0);
+    if (year % pData.refreshIntervalThermal == 0)
+    {
+        generators.emplace_back("tsgen_thermal",
+                                [year, this] { regenerateThermalTimeSeries(year); });
+    }
+    else
+    {
+        // Nothing to generate, kept for the duration report
+        pDurationCollector("tsgen_thermal") << [] {};
+    }
 
-    pDurationCollector("tsgen_thermal") << [refreshTSonCurrentYear, year, this]
+    auto* queueService = pQueueService.get();
+    if (!queueService || queueService->maximumThreadCount() <= 1 || generators.size() <= 1)
     {
-        if (refreshTSonCurrentYear)
+        for (auto& [name, generate]: generators)
         {
-            auto clusters = getAllClustersToGen(study.areas, pData.haveToRefreshTSThermal);
-            generateThermalTimeSeries(study,
-                                      clusters,
-                                      study.runtime.random[Data::seedTsGenThermal]);
-
-            bool archive = study.parameters.timeSeriesToArchive & Data::timeSeriesThermal;
-            bool doWeWrite = archive && !study.parameters.noOutput;
-            if (doWeWrite)
-            {
-                fs::path savePath = fs::path(study.folderOutput.to<std::string>()) / "ts-generator"
-                                    / "thermal" / "mc-" / std::to_string(year);
-                writeThermalTimeSeries(clusters, savePath);
-            }
-
-            // apply the spinning if we generated some in memory clusters
-            for (auto* cluster: clusters)
-            {
-                cluster->calculationOfSpinning();
-            }
+            pDurationCollector(name) << generate;
         }
-    };
+        return;
+    }
+
+    Concurrency::FutureSet results;
+    for (auto& generator: generators)
+    {
+        results.add(Concurrency::AddTask(
+          *queueService,
+          [&generator, this] { pDurationCollector(generator.first) << generator.second; }));
+    }
+    queueService->start();
+    queueService->wait(Yuni::qseIdle);
+    queueService->stop();
+    results.join();
+}
+
+template<class ImplementationType>
+void ISimulation<ImplementationType>::regenerateThermalTimeSeries(uint year)
+{
+    auto clusters = TSGenerator::getAllClustersToGen(study.areas, pData.haveToRefreshTSThermal);
+    TSGenerator::generateThermalTimeSeries(study,
+                                           clusters,
+                                           study.runtime.random[Data::seedTsGenThermal]);
+
+    bool archive = study.parameters.timeSeriesToArchive & Data::timeSeriesThermal;
+    bool doWeWrite = archive && !study.parameters.noOutput;
+    if (doWeWrite)
+    {
+        fs::path savePath = fs::path(study.folderOutput.to<std::string>()) / "ts-generator"
+                            / "thermal" / "mc-" / std::to_string(year);
+        TSGenerator::writeThermalTimeSeries(clusters, savePath);
+    }
+
+    // apply the spinning if we generated some in memory clusters
+    for (auto* cluster: clusters)
+    {
+        cluster->calculationOfSpinning();
+    }
 }
 
 template<class ImplementationType>
@@ -481,8 +583,11 @@ uint ISimulation<ImplementationType>::buildSetsOfParallelYears(
   uint endYear,
   std::vector<setOfParallelYears>& setsOfParallelYears)
 {
-    // Filter on the years
-    const auto& yearsFilter = study.parameters.yearsFilter;
+    // Filter on the years, restricted to the shard if any
+    const auto yearsFilter = settings.shardCount ? shardYearsFilter(study.parameters.yearsFilter,
+                                                                    settings.shardIndex,
+                                                                    settings.shardCount)
+                                                 : study.parameters.yearsFilter;
 
     // number max of years (to be executed or not) in a set of parallel years
     uint maxNbYearsPerformed = 0;
@@ -951,7 +1056,21 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
                                                               endYear,
                                                               setsOfParallelYears);
     // Related to annual costs statistics (printed in output into separate files)
-    pAnnualStatistics.setNbPerformedYears(pNbYearsReallyPerformed);
+    // The statistics of a shard are averaged over all the years of the playlist, as they are
+    // added to the ones of the other shards
+    pAnnualStatistics.setNbPerformedYears(
+      settings.shardCount ? study.parameters.effectiveNbYears : pNbYearsReallyPerformed);
+
+    // Year-by-year results are exported in the background, reading the values of the spaces
+    std::unique_ptr<YearByYearExporter> yearByYearExporter;
+    if (pYearByYear)
+    {
+        yearByYearExporter = std::make_unique<YearByYearExporter>(maxNbYearsPerformedInAset);
+    }
+
+    // The logs emitted while the years are computed are written in the background, one queue
+    // per space
+    AsyncLogs asyncLogs(maxNbYearsPerformedInAset);
 
     // Container for random numbers of parallel years (to be executed or not)
     randomNumbers randomForParallelYears(maxNbYearsPerformedInAset,
@@ -960,8 +1079,10 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
     // Allocating memory to store random numbers of all parallel years
     allocateMemoryForRandomNumbers(randomForParallelYears);
 
-    // Number of threads to perform the jobs waiting in the queue
-    pQueueService->maximumThreadCount(pNbMaxPerformedYearsInParallel);
+    // Number of threads to perform the jobs waiting in the queue, plus one for the challengers of
+    // the solver racing, the years of a set never using more than the others
+    const bool racing = !study.parameters.optOptions.racingSolver.empty();
+    pQueueService->maximumThreadCount(pNbMaxPerformedYearsInParallel + (racing ? 1 : 0));
     HydroInputsChecker hydroInputsChecker(study);
 
     logs.info() << " Doing hydro validation";
@@ -1029,7 +1150,8 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
               performCalculations,
               study,
               state[numSpace],
-              pYearByYear,
+              yearByYearExporter.get(),
+              asyncLogs,
               pDurationCollector,
               pResultWriter,
               simulationObserver_.get());
@@ -1044,6 +1166,7 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
         pQueueService->stop();
         results.join();
         pResultWriter.flush();
+        asyncLogs.flush();
 
         // At this point, the first set of parallel year(s) was run with at least one year
         // performed
@@ -1063,15 +1186,19 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
                 throw FatalError(msg.str());
             }
         }
-        // Computing the summary : adding the contribution of MC years
-        // previously computed in parallel
-        ImplementationType::variables.computeSummary(batch.spaceToPerformedYear,
-                                                     batch.nbPerformedYears);
-
-        // Computing summary of spatial aggregations
-        ImplementationType::variables.computeSpatialAggregatesSummary(ImplementationType::variables,
-                                                                      batch.spaceToPerformedYear,
-                                                                      batch.nbPerformedYears);
+        pDurationCollector("mc_years_summary") << [this, &batch]
+        {
+            // Computing the summary : adding the contribution of MC years
+            // previously computed in parallel
+            ImplementationType::variables.computeSummary(batch.spaceToPerformedYear,
+                                                         batch.nbPerformedYears);
+
+            // Computing summary of spatial aggregations
+            ImplementationType::variables.computeSpatialAggregatesSummary(
+              ImplementationType::variables,
+              batch.spaceToPerformedYear,
+              batch.nbPerformedYears);
+        };
 
         // Computes statistics on annual (system and solution) costs, to be printed in output into
         // separate files
@@ -1082,6 +1209,58 @@ void ISimulation<ImplementationType>::loopThroughYears(uint firstYear,
 
     } // End loop over sets of parallel years
 
+    if (yearByYearExporter)
+    {
+        yearByYearExporter->waitAll();
+    }
+
+    if (settings.shardCount)
+    {
+        saveShardAccumulators();
+        return;
+    }
+
+    // Writing annual costs statistics
+    pAnnualStatistics.endStandardDeviations();
+    pAnnualStatistics.writeToOutput(pResultWriter);
+}
+
+template<class ImplementationType>
+void ISimulation<ImplementationType>::saveShardAccumulators()
+{
+    logs.info() << "Saving the results of the shard " << (settings.shardIndex + 1) << '/'
+                << settings.shardCount;
+
+    const auto& parameters = study.parameters;
+    AccumulatorsWriter writer({settings.shardIndex,
+                               settings.shardCount,
+                               parameters.nbYears,
+                               parameters.effectiveNbYears});
+    ImplementationType::variables.visitAccumulators(writer);
+    pAnnualStatistics.visitAccumulators(writer);
+
+    pResultWriter.addEntryFromBuffer(shardAccumulatorsFilename, writer.content());
+}
+
+template<class ImplementationType>
+void ISimulation<ImplementationType>::mergeShards()
+{
+    const auto& parameters = study.parameters;
+    auto shards = loadShardAccumulators(settings.shardsToMerge,
+                                        parameters.nbYears,
+                                        parameters.effectiveNbYears);
+
+    // The shards are merged in the order of their MC years, like the sets of parallel years
+    for (auto& shard: shards)
+    {
+        logs.info() << "Merging the shard " << (shard.header().index + 1) << '/'
+                    << shard.header().count << " (" << shard.origin() << ')';
+        ImplementationType::variables.visitAccumulators(shard);
+        pAnnualStatistics.visitAccumulators(shard);
+        shard.checkAllMerged();
+    }
+    pNbYearsReallyPerformed = parameters.effectiveNbYears;
+
     // Writing annual costs statistics
     pAnnualStatistics.endStandardDeviations();
     pAnnualStatistics.writeToOutput(pResultWriter);
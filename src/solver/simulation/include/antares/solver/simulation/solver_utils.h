@@ -79,6 +79,16 @@ public:
     void addCost(const double cost);
     void endStandardDeviation();
 
+    //! Give the accumulated values to a visitor (see Variable::IVariable::visitAccumulators)
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        visitor.sum(&costAverage, 1);
+        visitor.sum(&costStdDeviation, 1);
+        visitor.minimum(costMin);
+        visitor.maximum(costMax);
+    }
+
     // System costs statistics
     double costAverage = 0.;
     double costStdDeviation = 0.;
@@ -106,6 +116,17 @@ public:
     void endStandardDeviations();
     void writeToOutput(IResultWriter& writer);
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        systemCost.visitAccumulators(visitor);
+        criterionCost1.visitAccumulators(visitor);
+        criterionCost2.visitAccumulators(visitor);
+        optimizationTime1.visitAccumulators(visitor);
+        optimizationTime2.visitAccumulators(visitor);
+        updateTime.visitAccumulators(visitor);
+    }
+
 private:
     void writeSystemCostToOutput(IResultWriter& writer);
     void writeCriterionCostsToOutput(IResultWriter& writer) const;
@@ -0,0 +1,96 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <antares/study/binding_constraint/BindingConstraint.h>
+#include <antares/study/fwd.h>
+#include <antares/study/study.h>
+
+struct PROBLEME_HEBDO;
+
+/*!
+** \brief Reduced model merging the identical thermal clusters of an area
+**
+** The enabled and not must-run clusters of an area sharing the same techno-economic parameters
+** (unit size, min stable power, min up/down times, start-up, fixed and market bid costs) are
+** optimized as a single cluster, whose available power is the sum of theirs. The clusters
+** involved in a binding constraint are never merged.
+**
+** After each weekly optimization, the generation of an aggregated cluster is split back between
+** its clusters pro rata of their available power. The units ON of a cluster are the fewest able
+** to produce its generation (within its number of units), its starting and stopping units follow
+** from their changes, and its breaking down units are limited to its stopping ones.
+*/
+class ThermalClusterAggregation
+{
+public:
+    ThermalClusterAggregation(
+      const Antares::Data::AreaList& areas,
+      const std::vector<std::shared_ptr<Antares::Data::BindingConstraint>>& activeConstraints);
+
+    //! Number of aggregated clusters of an area, as seen by the optimization
+    uint aggregateCount(uint areaIndex) const
+    {
+        return static_cast<uint>(clustersOfAggregate_[areaIndex].size());
+    }
+
+    //! Number of aggregated clusters of all the areas
+    uint totalAggregateCount() const
+    {
+        return totalAggregateCount_;
+    }
+
+    //! Number of enabled and not must-run clusters of all the areas
+    uint totalClusterCount() const
+    {
+        return totalClusterCount_;
+    }
+
+    //! Index of the aggregated cluster of a cluster (given by its `index`)
+    uint aggregateOf(uint areaIndex, uint clusterIndex) const
+    {
+        return aggregateOfCluster_[areaIndex][clusterIndex];
+    }
+
+    //! Clusters merged into an aggregated cluster, the first one holding the parameters
+    const std::vector<const Antares::Data::ThermalCluster*>& clustersOf(uint areaIndex,
+                                                                        uint aggregate) const
+    {
+        return clustersOfAggregate_[areaIndex][aggregate];
+    }
+
+    //! Split the results of the aggregated clusters of the week back to the clusters
+    void disaggregate(PROBLEME_HEBDO& problem, uint year, uint firstHourOfTheWeek) const;
+
+private:
+    std::vector<std::vector<uint>> aggregateOfCluster_;
+    std::vector<std::vector<std::vector<const Antares::Data::ThermalCluster*>>>
+      clustersOfAggregate_;
+    //! Areas with at least an aggregated cluster made of several clusters
+    std::vector<bool> hasMergedClusters_;
+    uint totalAggregateCount_ = 0;
+    uint totalClusterCount_ = 0;
+};
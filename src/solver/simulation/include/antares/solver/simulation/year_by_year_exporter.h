@@ -0,0 +1,71 @@
+
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <yuni/yuni.h>
+#include <yuni/job/queue/service.h>
+
+#include "antares/concurrency/concurrency.h"
+
+namespace Antares::Solver::Simulation
+{
+/*!
+** \brief Export the year-by-year results while the next MC years are computed
+**
+** A year job hands the formatting and the writing of its results over to a dedicated thread,
+** and is done. The results are read from the space (numSpace) of the variables where they
+** were computed, so the spaces are the buffers of the pipeline and the memory does not grow:
+** before reusing a space for another year, a job waits for the pending export of this space.
+*/
+class YearByYearExporter final
+{
+public:
+    explicit YearByYearExporter(uint nbSpaces);
+    ~YearByYearExporter();
+
+    YearByYearExporter(const YearByYearExporter&) = delete;
+    YearByYearExporter& operator=(const YearByYearExporter&) = delete;
+
+    //! Queue the export of the results held by a space
+    void add(uint numSpace, const Concurrency::Task& task);
+
+    /*!
+    ** \brief Wait for the export of a space, before its values are reset for another year
+    **
+    ** Re-throws the exception raised by the export, if any.
+    */
+    void waitFor(uint numSpace);
+
+    //! Wait for all the pending exports
+    void waitAll();
+
+private:
+    Yuni::Job::QueueService queue_;
+    // One pending export at most per space. A space is only used by one year job at a time,
+    // hence no locking.
+    std::vector<Concurrency::TaskFuture> pending_;
+};
+
+} // namespace Antares::Solver::Simulation
@@ -23,8 +23,12 @@
 #include <filesystem>
 
 OptimizationStatisticsWriter::OptimizationStatisticsWriter(Antares::Solver::IResultWriter& writer,
-                                                           uint year):
+                                                           uint year,
+                                                           bool solverRacing,
+                                                           bool presolve):
     pYear(year),
+    pSolverRacing(solverRacing),
+    pPresolve(presolve),
     pWriter(writer)
 {
     printHeader();
@@ -32,13 +36,37 @@ OptimizationStatisticsWriter::OptimizationStatisticsWriter(Antares::Solver::IRes
 
 void OptimizationStatisticsWriter::printHeader()
 {
-    pBuffer << "# Week Optimization_1_ms Optimization_2_ms Update_ms1 Update_ms2\n";
+    pBuffer << "# Week Optimization_1_ms Optimization_2_ms Update_ms1 Update_ms2";
+    if (pSolverRacing)
+    {
+        pBuffer << " Winner_1 Winner_2";
+    }
+    if (pPresolve)
+    {
+        pBuffer << " Removed_variables_1 Removed_variables_2 Removed_constraints_1"
+                   " Removed_constraints_2";
+    }
+    pBuffer << "\n";
 }
 
 void OptimizationStatisticsWriter::addTime(uint week, const TIME_MEASURES& timeMeasure)
 {
     pBuffer << week << " " << timeMeasure[0].solveTime << " " << timeMeasure[1].solveTime << " "
-            << timeMeasure[0].updateTime << " " << timeMeasure[1].updateTime << "\n";
+            << timeMeasure[0].updateTime << " " << timeMeasure[1].updateTime;
+    if (pSolverRacing)
+    {
+        for (const auto& measure: timeMeasure)
+        {
+            pBuffer << " " << (measure.racingWinner.empty() ? "-" : measure.racingWinner);
+        }
+    }
+    if (pPresolve)
+    {
+        pBuffer << " " << timeMeasure[0].removedVariables << " "
+                << timeMeasure[1].removedVariables << " " << timeMeasure[0].removedConstraints
+                << " " << timeMeasure[1].removedConstraints;
+    }
+    pBuffer << "\n";
 }
 
 void OptimizationStatisticsWriter::finalize()
@@ -0,0 +1,227 @@
+
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "antares/solver/simulation/sharding.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <antares/antares/fatal-error.h>
+
+namespace Antares::Solver::Simulation
+{
+namespace
+{
+using MinMaxValues = std::vector<Variable::R::AllYears::MinMaxData::Data>;
+
+// The version must be increased whenever the layout of the accumulators changes
+constexpr char magic[] = "antares-shard-accumulators 1\n";
+constexpr std::size_t magicLength = sizeof(magic) - 1;
+
+// Same tolerance as the one used to merge the MC years (see MinMaxData)
+constexpr double eps = 1.e-7;
+} // namespace
+
+std::vector<bool> shardYearsFilter(const std::vector<bool>& yearsFilter, uint index, uint count)
+{
+    std::vector<uint> performedYears;
+    for (uint y = 0; y != yearsFilter.size(); ++y)
+    {
+        if (yearsFilter[y])
+        {
+            performedYears.push_back(y);
+        }
+    }
+
+    const std::size_t first = performedYears.size() * index / count;
+    const std::size_t last = performedYears.size() * (index + 1) / count;
+
+    std::vector<bool> filter(yearsFilter.size(), false);
+    for (std::size_t i = first; i != last; ++i)
+    {
+        filter[performedYears[i]] = true;
+    }
+    return filter;
+}
+
+AccumulatorsWriter::AccumulatorsWriter(const ShardHeader& header)
+{
+    content_.append(magic, magicLength);
+    write(&header, 1);
+}
+
+template<class T>
+void AccumulatorsWriter::write(const T* values, std::size_t count)
+{
+    content_.append(reinterpret_cast<const char*>(values), sizeof(T) * count);
+}
+
+void AccumulatorsWriter::sum(const double* values, std::size_t count)
+{
+    write(values, count);
+}
+
+void AccumulatorsWriter::minimum(const MinMaxValues& values)
+{
+    write(values.data(), values.size());
+}
+
+void AccumulatorsWriter::maximum(const MinMaxValues& values)
+{
+    write(values.data(), values.size());
+}
+
+void AccumulatorsWriter::minimum(double value)
+{
+    write(&value, 1);
+}
+
+void AccumulatorsWriter::maximum(double value)
+{
+    write(&value, 1);
+}
+
+AccumulatorsMerger::AccumulatorsMerger(std::string content, std::string origin):
+    content_(std::move(content)),
+    origin_(std::move(origin))
+{
+    if (content_.compare(0, magicLength, magic) != 0)
+    {
+        throw FatalError(origin_ + ": not the accumulators of a shard, or saved by another version");
+    }
+    offset_ = magicLength;
+    read(&header_, 1);
+}
+
+template<class T>
+void AccumulatorsMerger::read(T* values, std::size_t count)
+{
+    const std::size_t size = sizeof(T) * count;
+    if (content_.size() - offset_ < size)
+    {
+        throw FatalError(origin_ + ": the shard does not match the study");
+    }
+    std::memcpy(values, content_.data() + offset_, size);
+    offset_ += size;
+}
+
+void AccumulatorsMerger::sum(double* values, std::size_t count)
+{
+    buffer_.resize(count);
+    read(buffer_.data(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        values[i] += buffer_[i];
+    }
+}
+
+void AccumulatorsMerger::minimum(MinMaxValues& values)
+{
+    minmaxBuffer_.resize(values.size());
+    read(minmaxBuffer_.data(), minmaxBuffer_.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        if (minmaxBuffer_[i].value < values[i].value - eps)
+        {
+            values[i] = minmaxBuffer_[i];
+        }
+    }
+}
+
+void AccumulatorsMerger::maximum(MinMaxValues& values)
+{
+    minmaxBuffer_.resize(values.size());
+    read(minmaxBuffer_.data(), minmaxBuffer_.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        if (minmaxBuffer_[i].value > values[i].value + eps)
+        {
+            values[i] = minmaxBuffer_[i];
+        }
+    }
+}
+
+void AccumulatorsMerger::minimum(double& value)
+{
+    double shardValue;
+    read(&shardValue, 1);
+    value = std::min(value, shardValue);
+}
+
+void AccumulatorsMerger::maximum(double& value)
+{
+    double shardValue;
+    read(&shardValue, 1);
+    value = std::max(value, shardValue);
+}
+
+void AccumulatorsMerger::checkAllMerged() const
+{
+    if (offset_ != content_.size())
+    {
+        throw FatalError(origin_ + ": the shard does not match the study");
+    }
+}
+
+std::vector<AccumulatorsMerger> loadShardAccumulators(const std::vector<std::string>& outputs,
+                                                      uint nbYears,
+                                                      uint nbPerformedYears)
+{
+    std::vector<AccumulatorsMerger> shards;
+    shards.reserve(outputs.size());
+    for (const auto& output: outputs)
+    {
+        auto path = std::filesystem::path(output) / shardAccumulatorsFilename;
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            throw FatalError("Impossible to read the accumulators of the shard " + path.string());
+        }
+        std::ostringstream content;
+        content << file.rdbuf();
+        shards.emplace_back(content.str(), path.string());
+    }
+
+    std::ranges::sort(shards, {}, [](const auto& shard) { return shard.header().index; });
+
+    for (uint i = 0; i != shards.size(); ++i)
+    {
+        const auto& header = shards[i].header();
+        if (header.count != shards.size() || header.index != i)
+        {
+            throw FatalError("Expected the outputs of the shards 1/" + std::to_string(header.count)
+                             + " to " + std::to_string(header.count) + "/"
+                             + std::to_string(header.count) + ", each of them once");
+        }
+        if (header.nbYears != nbYears || header.nbPerformedYears != nbPerformedYears)
+        {
+            throw FatalError(shards[i].origin()
+                             + ": the MC years or the playlist differ from the ones of the study");
+        }
+    }
+    return shards;
+}
+
+} // namespace Antares::Solver::Simulation
@@ -228,10 +228,6 @@ void SIM_AllocationLinks(PROBLEME_HEBDO& problem, const uint linkCount, unsigned
                                                                               0.);
         problem.CoutDeTransport[k].CoutDeTransportExtremiteVersOrigine.assign(NombreDePasDeTemps,
                                                                               0.);
-        problem.CoutDeTransport[k].CoutDeTransportOrigineVersExtremiteRef.assign(NombreDePasDeTemps,
-                                                                                 0.);
-        problem.CoutDeTransport[k].CoutDeTransportExtremiteVersOrigineRef.assign(NombreDePasDeTemps,
-                                                                                 0.);
     }
 }
 
@@ -361,8 +357,6 @@ void SIM_AllocateAreas(PROBLEME_HEBDO& problem,
         problem.CaracteristiquesHydrauliques[k]
           .ContrainteDePmaxPompageHoraire.assign(NombreDePasDeTemps, 0.);
 
-        problem.ReserveJMoins1[k].ReserveHoraireJMoins1.assign(NombreDePasDeTemps, 0.);
-
         problem.ResultatsHoraires[k].ValeursHorairesDeDefaillancePositive.assign(NombreDePasDeTemps,
                                                                                  0.);
         problem.ResultatsHoraires[k].ValeursHorairesDENS.assign(NombreDePasDeTemps,
@@ -21,16 +21,19 @@
 
 #include <cmath>
 #include <sstream>
+#include <utility>
 
 #include <antares/antares/fatal-error.h>
 #include <antares/study/area/constants.h>
 #include <antares/study/area/scratchpad.h>
 #include <antares/study/study.h>
 #include <antares/utils/utils.h>
+#include "antares/solver/optimisation/opt_fonctions.h"
 #include "antares/solver/simulation/adequacy_patch_runtime_data.h"
 #include "antares/solver/simulation/sim_extern_variables_globales.h"
 #include "antares/solver/simulation/sim_structure_probleme_economique.h"
 #include "antares/solver/simulation/simulation.h"
+#include "antares/solver/simulation/thermal_cluster_aggregation.h"
 #include "antares/study/fwd.h"
 #include "antares/study/simulation.h"
 
@@ -70,13 +73,106 @@ static void importShortTermStorages(
     }
 }
 
+// The thermal clusters as seen by the optimization: the clusters themselves, or the aggregated
+// clusters when `aggregation` is given
+static void initThermalClusters(const Study& study,
+                                PROBLEME_HEBDO& problem,
+                                const ThermalClusterAggregation* aggregation)
+{
+    int NombrePaliers = 0;
+    for (uint i = 0; i < study.areas.size(); ++i)
+    {
+        const auto& area = *(study.areas.byIndex[i]);
+
+        auto& pbPalier = problem.PaliersThermiquesDuPays[i];
+        unsigned int clusterCount = aggregation ? aggregation->aggregateCount(i)
+                                                : area.thermal.list.enabledAndNotMustRunCount();
+        pbPalier.NombreDePaliersThermiques = clusterCount;
+
+        auto initPalier = [&pbPalier, &NombrePaliers](uint index, const ThermalCluster& cluster)
+        {
+            pbPalier.NumeroDuPalierDansLEnsembleDesPaliersThermiques[index] = NombrePaliers
+                                                                              + index;
+            pbPalier.TailleUnitaireDUnGroupeDuPalierThermique[index]
+              = cluster.nominalCapacityWithSpinning;
+            pbPalier.PminDuPalierThermiquePendantUneHeure[index] = cluster.minStablePower;
+            pbPalier.PminDuPalierThermiquePendantUnJour[index] = 0;
+            pbPalier.minUpDownTime[index] = cluster.minUpDownTime;
+
+            pbPalier.CoutDeDemarrageDUnGroupeDuPalierThermique[index] = cluster.startupCost;
+            pbPalier.CoutDArretDUnGroupeDuPalierThermique[index] = 0;
+            pbPalier.CoutFixeDeMarcheDUnGroupeDuPalierThermique[index] = cluster.fixedCost;
+            pbPalier.DureeMinimaleDeMarcheDUnGroupeDuPalierThermique[index] = cluster.minUpTime;
+            pbPalier.DureeMinimaleDArretDUnGroupeDuPalierThermique[index] = cluster.minDownTime;
+
+            pbPalier.PmaxDUnGroupeDuPalierThermique[index] = cluster.nominalCapacityWithSpinning;
+            pbPalier.pminDUnGroupeDuPalierThermique[index]
+              = (pbPalier.PmaxDUnGroupeDuPalierThermique[index] < cluster.minStablePower)
+                  ? pbPalier.PmaxDUnGroupeDuPalierThermique[index]
+                  : cluster.minStablePower;
+            pbPalier.NomsDesPaliersThermiques[index] = cluster.name().c_str();
+        };
+
+        if (aggregation)
+        {
+            // An aggregated cluster takes the parameters of its first cluster, all equal
+            for (uint g = 0; g != clusterCount; ++g)
+            {
+                initPalier(g, *aggregation->clustersOf(i, g).front());
+            }
+        }
+        else
+        {
+            for (const auto& cluster: area.thermal.list.each_enabled_and_not_mustrun())
+            {
+                initPalier(cluster->index, *cluster);
+            }
+        }
+
+        NombrePaliers += clusterCount;
+    }
+
+    problem.NombreDePaliersThermiques = NombrePaliers;
+}
+
+// Number of variables and constraints of the weekly problem, counted as for its allocation
+static std::pair<int, int> countVariablesAndConstraints(PROBLEME_HEBDO& problem)
+{
+    problem.NombreDePasDeTempsPourUneOptimisation = problem.OptimisationAuPasHebdomadaire
+                                                      ? problem.NombreDePasDeTemps
+                                                      : problem.NombreDePasDeTempsDUneJournee;
+    // The problem kept from a previous simulation, if any, is left untouched
+    auto kept = std::exchange(problem.ProblemeAResoudre,
+                              std::make_unique<PROBLEME_ANTARES_A_RESOUDRE>());
+    OPT_DecompteDesVariablesEtDesContraintesDuProblemeAOptimiser(&problem);
+    std::pair size(problem.ProblemeAResoudre->NombreDeVariables,
+                   problem.ProblemeAResoudre->NombreDeContraintes);
+    problem.ProblemeAResoudre = std::move(kept);
+    return size;
+}
+
+// The size of the weekly problem is counted with the clusters, then with the aggregated clusters
+static void logAggregationReduction(const Study& study,
+                                    PROBLEME_HEBDO& problem,
+                                    const ThermalClusterAggregation& aggregation)
+{
+    initThermalClusters(study, problem, nullptr);
+    auto [variablesBefore, constraintsBefore] = countVariablesAndConstraints(problem);
+    initThermalClusters(study, problem, &aggregation);
+    auto [variablesAfter, constraintsAfter] = countVariablesAndConstraints(problem);
+
+    logs.info() << "  " << aggregation.totalClusterCount() << " thermal clusters optimized as "
+                << aggregation.totalAggregateCount() << " aggregated clusters";
+    logs.info() << "  Weekly problem: " << variablesAfter << " variables instead of "
+                << variablesBefore << ", " << constraintsAfter << " constraints instead of "
+                << constraintsBefore;
+}
+
 void SIM_InitialisationProblemeHebdo(Data::Study& study,
                                      PROBLEME_HEBDO& problem,
                                      unsigned int NombreDePasDeTemps,
                                      uint numspace)
 {
-    int NombrePaliers;
-
     auto& parameters = study.parameters;
 
     problem.Expansion = (parameters.mode == Data::SimulationMode::Expansion);
@@ -108,10 +204,23 @@ void SIM_InitialisationProblemeHebdo(Data::Study& study,
     auto activeConstraints = study.bindingConstraints.activeConstraints();
     problem.NombreDeContraintesCouplantes = activeConstraints.size();
 
+    // Not compatible with the CSR of the adequacy patch, which works on the clusters
+    if (parameters.optOptions.aggregateThermalClusters && !parameters.adqPatchParams.enabled)
+    {
+        problem.thermalClusterAggregation = std::make_shared<ThermalClusterAggregation>(
+          study.areas,
+          activeConstraints);
+    }
+    const auto* aggregation = problem.thermalClusterAggregation.get();
+
     problem.ExportMPS = study.parameters.include.exportMPS;
     problem.ExportStructure = study.parameters.include.exportStructure;
     problem.NamedProblems = study.parameters.namedProblems;
     problem.exportMPSOnError = Data::exportMPS(parameters.include.unfeasibleProblemBehavior);
+    if (!parameters.optOptions.racingSolver.empty())
+    {
+        problem.racingQueue = study.pQueueService.get();
+    }
 
     problem.OptimisationAvecCoutsDeDemarrage = (study.parameters.unitCommitment.ucMode
                                                 != Antares::Data::UnitCommitmentMode::
@@ -267,6 +376,12 @@ void SIM_InitialisationProblemeHebdo(Data::Study& study,
         for (uint j = 0; j < bc->clusterCount(); ++j)
         {
             PtMat.NumeroDuPalierDispatch[j] = bindingConstraintStructures.clusterIndex[j];
+            if (aggregation)
+            {
+                PtMat.NumeroDuPalierDispatch[j] = aggregation->aggregateOf(
+                  bindingConstraintStructures.clustersAreaIndex[j],
+                  bindingConstraintStructures.clusterIndex[j]);
+            }
             PtMat.PaysDuPalierDispatch[j] = bindingConstraintStructures.clustersAreaIndex[j];
             PtMat.PoidsDuPalierDispatch[j] = bindingConstraintStructures.clusterWeight[j];
 
@@ -275,87 +390,84 @@ void SIM_InitialisationProblemeHebdo(Data::Study& study,
         }
     }
 
-    NombrePaliers = 0;
-    for (uint i = 0; i < study.areas.size(); ++i)
-    {
-        const auto& area = *(study.areas.byIndex[i]);
+    initThermalClusters(study, problem, aggregation);
 
-        auto& pbPalier = problem.PaliersThermiquesDuPays[i];
-        unsigned int clusterCount = area.thermal.list.enabledAndNotMustRunCount();
-        pbPalier.NombreDePaliersThermiques = clusterCount;
-
-        for (const auto& cluster: area.thermal.list.each_enabled_and_not_mustrun())
-        {
-            pbPalier.NumeroDuPalierDansLEnsembleDesPaliersThermiques[cluster->index] = NombrePaliers
-                                                                                       + cluster
-                                                                                           ->index;
-            pbPalier.TailleUnitaireDUnGroupeDuPalierThermique[cluster->index]
-              = cluster->nominalCapacityWithSpinning;
-            pbPalier.PminDuPalierThermiquePendantUneHeure[cluster->index] = cluster->minStablePower;
-            pbPalier.PminDuPalierThermiquePendantUnJour[cluster->index] = 0;
-            pbPalier.minUpDownTime[cluster->index] = cluster->minUpDownTime;
-
-            pbPalier.CoutDeDemarrageDUnGroupeDuPalierThermique[cluster->index] = cluster
-                                                                                   ->startupCost;
-            pbPalier.CoutDArretDUnGroupeDuPalierThermique[cluster->index] = 0;
-            pbPalier.CoutFixeDeMarcheDUnGroupeDuPalierThermique[cluster->index] = cluster
-                                                                                    ->fixedCost;
-            pbPalier.DureeMinimaleDeMarcheDUnGroupeDuPalierThermique[cluster->index]
-              = cluster->minUpTime;
-            pbPalier.DureeMinimaleDArretDUnGroupeDuPalierThermique[cluster->index]
-              = cluster->minDownTime;
-
-            pbPalier.PmaxDUnGroupeDuPalierThermique[cluster->index]
-              = cluster->nominalCapacityWithSpinning;
-            pbPalier.pminDUnGroupeDuPalierThermique[cluster->index]
-              = (pbPalier.PmaxDUnGroupeDuPalierThermique[cluster->index] < cluster->minStablePower)
-                  ? pbPalier.PmaxDUnGroupeDuPalierThermique[cluster->index]
-                  : cluster->minStablePower;
-            pbPalier.NomsDesPaliersThermiques[cluster->index] = cluster->name().c_str();
-        }
-
-        NombrePaliers += clusterCount;
+    if (aggregation && numspace == 0)
+    {
+        logAggregationReduction(study, problem, *aggregation);
     }
 
-    problem.NombreDePaliersThermiques = NombrePaliers;
-
     problem.LeProblemeADejaEteInstancie = false;
 }
 
-static void prepareBindingConstraint(PROBLEME_HEBDO& problem,
-                                     int PasDeTempsDebut,
-                                     const BindingConstraintsRepository& bindingConstraints,
-                                     const BindingConstraintGroupRepository& bcgroups,
-                                     const uint weekFirstDay,
-                                     int pasDeTemps)
+// The RHS columns only depend on the year: they are looked up once per year, and the groups
+// (searched by name) once per simulation, the table being reset when the simulation begins
+static const std::vector<const double*>& retrieveBindingConstraintsRHS(
+  PROBLEME_HEBDO& problem,
+  const BindingConstraintsRepository& bindingConstraints,
+  const BindingConstraintGroupRepository& bcgroups)
 {
-    auto activeConstraints = bindingConstraints.activeConstraints();
-    const auto constraintCount = activeConstraints.size();
+    auto& rhs = problem.SecondsMembresDesContraintesCouplantes;
+    if (rhs.year == problem.year)
+    {
+        return rhs.columns;
+    }
 
-    for (unsigned constraintIndex = 0; constraintIndex != constraintCount; ++constraintIndex)
+    const auto& activeConstraints = bindingConstraints.activeConstraints();
+    if (!rhs.year)
     {
-        auto bc = activeConstraints[constraintIndex];
+        rhs.groups.clear();
+        rhs.groups.reserve(activeConstraints.size());
+        for (const auto& bc: activeConstraints)
+        {
+            rhs.groups.push_back(bcgroups[bc->group()]);
+        }
+    }
+
+    rhs.columns.resize(activeConstraints.size());
+    for (unsigned constraintIndex = 0; constraintIndex != activeConstraints.size();
+         ++constraintIndex)
+    {
+        const auto& bc = activeConstraints[constraintIndex];
         assert(bc->RHSTimeSeries().width && "Invalid constraint data width");
 
         uint tsIndexForBc = 0;
-        auto* group = bcgroups[bc->group()];
-        if (group)
+        if (const auto* group = rhs.groups[constraintIndex]; group)
         {
             tsIndexForBc = group->timeseriesNumbers[problem.year];
         }
 
         // If there is only one TS, always select it.
         const auto ts_number = bc->RHSTimeSeries().width == 1 ? 0 : tsIndexForBc;
+        rhs.columns[constraintIndex] = bc->RHSTimeSeries()[ts_number];
+    }
+    rhs.year = problem.year;
+    return rhs.columns;
+}
+
+static void prepareBindingConstraints(PROBLEME_HEBDO& problem,
+                                      int PasDeTempsDebut,
+                                      const BindingConstraintsRepository& bindingConstraints,
+                                      const BindingConstraintGroupRepository& bcgroups,
+                                      const uint weekFirstDay)
+{
+    const auto& activeConstraints = bindingConstraints.activeConstraints();
+    const auto constraintCount = activeConstraints.size();
+    const auto& columns = retrieveBindingConstraintsRHS(problem, bindingConstraints, bcgroups);
 
-        auto& timeSeries = bc->RHSTimeSeries();
-        const double* column = timeSeries[ts_number];
+    for (unsigned constraintIndex = 0; constraintIndex != constraintCount; ++constraintIndex)
+    {
+        const auto& bc = activeConstraints[constraintIndex];
+        [[maybe_unused]] const auto& timeSeries = bc->RHSTimeSeries();
+        const double* column = columns[constraintIndex];
         switch (bc->type())
         {
         case BindingConstraint::typeHourly:
         {
-            problem.MatriceDesContraintesCouplantes[constraintIndex]
-              .SecondMembreDeLaContrainteCouplante[pasDeTemps]
-              = column[PasDeTempsDebut + pasDeTemps];
+            std::copy_n(column + PasDeTempsDebut,
+                        problem.NombreDePasDeTemps,
+                        problem.MatriceDesContraintesCouplantes[constraintIndex]
+                          .SecondMembreDeLaContrainteCouplante.begin());
             break;
         }
         case BindingConstraint::typeDaily:
@@ -437,11 +549,10 @@ void SIM_RenseignementProblemeHebdo(const Study& study,
                                                         lnk->parameters[fhlHurdlesCostIndirect]))
                                      + PasDeTempsDebut;
             memcpy(&couts.CoutDeTransportOrigineVersExtremite[0], direct, pasDeTempsSizeDouble);
-            memcpy(&couts.CoutDeTransportOrigineVersExtremiteRef[0], direct, pasDeTempsSizeDouble);
             memcpy(&couts.CoutDeTransportExtremiteVersOrigine[0], indirect, pasDeTempsSizeDouble);
-            memcpy(&couts.CoutDeTransportExtremiteVersOrigineRef[0],
-                   indirect,
-                   pasDeTempsSizeDouble);
+            // The references are never modified, they are read from the study
+            couts.CoutDeTransportOrigineVersExtremiteRef = {direct, problem.NombreDePasDeTemps};
+            couts.CoutDeTransportExtremiteVersOrigineRef = {indirect, problem.NombreDePasDeTemps};
         }
         else
         {
@@ -596,78 +707,93 @@ void SIM_RenseignementProblemeHebdo(const Study& study,
         }
     }
 
-    int hourInYear = PasDeTempsDebut;
-    for (unsigned hourInWeek = 0; hourInWeek < problem.NombreDePasDeTemps;
-         ++hourInWeek, ++hourInYear)
-    {
-        prepareBindingConstraint(problem,
-                                 PasDeTempsDebut,
-                                 study.bindingConstraints,
-                                 study.bindingConstraintsGroups,
-                                 weekFirstDay,
-                                 hourInWeek);
+    prepareBindingConstraints(problem,
+                              PasDeTempsDebut,
+                              study.bindingConstraints,
+                              study.bindingConstraintsGroups,
+                              weekFirstDay);
 
-        for (uint k = 0; k < nbPays; ++k)
+    // The columns of the year are looked up once per area, and read hour by hour
+    const uint nbHours = problem.NombreDePasDeTemps;
+    for (uint k = 0; k < nbPays; ++k)
+    {
+        auto& area = *(study.areas.byIndex[k]);
+        const auto& scratchpad = scratchmap.at(&area);
+        const double* load = area.load.series.getColumn(year) + PasDeTempsDebut;
+        const double* wind = area.wind.series.getColumn(year) + PasDeTempsDebut;
+        const double* solar = area.solar.series.getColumn(year) + PasDeTempsDebut;
+        const double* ror = area.hydro.series->ror.getColumn(year) + PasDeTempsDebut;
+        const double* hydroGenPower = area.hydro.series->maxHourlyGenPower.getColumn(year)
+                                      + PasDeTempsDebut;
+        const double* hydroPumpPower = area.hydro.series->maxHourlyPumpPower.getColumn(year)
+                                       + PasDeTempsDebut;
+        const double* miscGenSum = scratchpad.miscGenSum + PasDeTempsDebut;
+        const double* mustrunSum = scratchpad.mustrunSum.data() + PasDeTempsDebut;
+        auto& hydro = problem.CaracteristiquesHydrauliques[k];
+
+        for (uint hourInWeek = 0; hourInWeek < nbHours; ++hourInWeek)
         {
-            auto& area = *(study.areas.byIndex[k]);
-            const auto& scratchpad = scratchmap.at(&area);
-            const double hourlyLoad = area.load.series.getCoefficient(year, hourInYear);
-            const double hourlyWind = area.wind.series.getCoefficient(year, hourInYear);
-            const double hourlySolar = area.solar.series.getCoefficient(year, hourInYear);
-            const double hourlyROR = area.hydro.series->ror.getCoefficient(year, hourInYear);
-            const double hourlyHydroGenPower = area.hydro.series->maxHourlyGenPower
-                                                 .getCoefficient(year, hourInYear);
-            const double hourlyHydroPumpPower = area.hydro.series->maxHourlyPumpPower
-                                                  .getCoefficient(year, hourInYear);
-
             double& mustRunGen = problem.AllMustRunGeneration[hourInWeek]
                                    .AllMustRunGenerationOfArea[k];
             if (parameters.renewableGeneration.isAggregated())
             {
-                mustRunGen = hourlyWind + hourlySolar + scratchpad.miscGenSum[hourInYear]
-                             + hourlyROR + scratchpad.mustrunSum[hourInYear];
+                mustRunGen = wind[hourInWeek] + solar[hourInWeek] + miscGenSum[hourInWeek]
+                             + ror[hourInWeek] + mustrunSum[hourInWeek];
             }
 
             // Renewable
             if (parameters.renewableGeneration.isClusters())
             {
-                mustRunGen = scratchpad.miscGenSum[hourInYear] + hourlyROR
-                             + scratchpad.mustrunSum[hourInYear];
+                mustRunGen = miscGenSum[hourInWeek] + ror[hourInWeek] + mustrunSum[hourInWeek];
+            }
+        }
 
-                for (const auto& c: area.renewable.list.each_enabled())
+        // Added cluster by cluster, in the same order as before for each hour
+        if (parameters.renewableGeneration.isClusters())
+        {
+            for (const auto& c: area.renewable.list.each_enabled())
+            {
+                for (uint hourInWeek = 0; hourInWeek < nbHours; ++hourInWeek)
                 {
-                    mustRunGen += c->valueAtTimeStep(year, hourInYear);
+                    problem.AllMustRunGeneration[hourInWeek].AllMustRunGenerationOfArea[k]
+                      += c->valueAtTimeStep(year, PasDeTempsDebut + hourInWeek);
                 }
             }
+        }
 
+        for (uint hourInWeek = 0; hourInWeek < nbHours; ++hourInWeek)
+        {
             assert(
               !std::isnan(problem.AllMustRunGeneration[hourInWeek].AllMustRunGenerationOfArea[k])
               && "NaN detected for 'AllMustRunGeneration', probably from miscGenSum/mustrunSum");
 
             problem.ConsommationsAbattues[hourInWeek].ConsommationAbattueDuPays[k]
-              = +hourlyLoad
+              = +load[hourInWeek]
                 - problem.AllMustRunGeneration[hourInWeek].AllMustRunGenerationOfArea[k];
+        }
 
-            if (problem.CaracteristiquesHydrauliques[k].PresenceDHydrauliqueModulable > 0)
+        if (hydro.PresenceDHydrauliqueModulable > 0)
+        {
+            for (uint hourInWeek = 0; hourInWeek < nbHours; ++hourInWeek)
             {
-                problem.CaracteristiquesHydrauliques[k]
-                  .ContrainteDePmaxHydrauliqueHoraire[hourInWeek]
-                  = hourlyHydroGenPower
-                    * problem.CaracteristiquesHydrauliques[k].WeeklyGeneratingModulation;
+                hydro.ContrainteDePmaxHydrauliqueHoraire[hourInWeek]
+                  = hydroGenPower[hourInWeek] * hydro.WeeklyGeneratingModulation;
             }
+        }
 
-            if (problem.CaracteristiquesHydrauliques[k].PresenceDePompageModulable)
+        if (hydro.PresenceDePompageModulable)
+        {
+            for (uint hourInWeek = 0; hourInWeek < nbHours; ++hourInWeek)
             {
-                problem.CaracteristiquesHydrauliques[k].ContrainteDePmaxPompageHoraire[hourInWeek]
-                  = hourlyHydroPumpPower
-                    * problem.CaracteristiquesHydrauliques[k].WeeklyPumpingModulation;
+                hydro.ContrainteDePmaxPompageHoraire[hourInWeek]
+                  = hydroPumpPower[hourInWeek] * hydro.WeeklyPumpingModulation;
             }
-
-            problem.ReserveJMoins1[k].ReserveHoraireJMoins1[hourInWeek] = area.reserves
-                                                                            [fhrDayBefore]
-                                                                            [PasDeTempsDebut
-                                                                             + hourInWeek];
         }
+
+        // Never modified, read from the study
+        problem.ReserveJMoins1[k].ReserveHoraireJMoins1 = {area.reserves[fhrDayBefore]
+                                                             + PasDeTempsDebut,
+                                                           nbHours};
     }
 
     {
@@ -0,0 +1,254 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+
+
+#include "antares/solver/simulation/thermal_cluster_aggregation.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "antares/solver/simulation/sim_structure_probleme_economique.h"
+
+using namespace Antares::Data;
+
+namespace
+{
+bool sameMarketBidModulation(const ThermalCluster& a, const ThermalCluster& b)
+{
+    const auto& ma = a.modulation;
+    const auto& mb = b.modulation;
+    if (ma.width <= thermalModulationMarketBid || mb.width <= thermalModulationMarketBid
+        || ma.height != mb.height)
+    {
+        return false;
+    }
+    const auto& ca = ma[thermalModulationMarketBid];
+    const auto& cb = mb[thermalModulationMarketBid];
+    return std::equal(ca, ca + ma.height, cb);
+}
+
+//! Whether two clusters can be optimized as a single one
+bool canBeMerged(const ThermalCluster& a, const ThermalCluster& b)
+{
+    // Costs given as time-series may differ at any hour, only constant costs are compared
+    return a.costgeneration == setManually && b.costgeneration == setManually
+           && a.nominalCapacityWithSpinning == b.nominalCapacityWithSpinning
+           && a.minStablePower == b.minStablePower && a.minUpTime == b.minUpTime
+           && a.minDownTime == b.minDownTime && a.startupCost == b.startupCost
+           && a.fixedCost == b.fixedCost && a.marketBidCost == b.marketBidCost
+           && sameMarketBidModulation(a, b);
+}
+
+//! Fewest units of a cluster able to produce a power, within its number of units
+double roundedUpUnits(double power, double unitSize, uint unitCount)
+{
+    if (unitSize <= 0.)
+    {
+        return 0.;
+    }
+    return std::min(std::ceil(power / unitSize - 1e-6), static_cast<double>(unitCount));
+}
+} // namespace
+
+ThermalClusterAggregation::ThermalClusterAggregation(
+  const AreaList& areas,
+  const std::vector<std::shared_ptr<BindingConstraint>>& activeConstraints)
+{
+    const uint nbAreas = areas.size();
+
+    // Clusters involved in a binding constraint keep their own variables
+    std::vector<std::vector<bool>> inBindingConstraint(nbAreas);
+    for (uint i = 0; i != nbAreas; ++i)
+    {
+        inBindingConstraint[i].assign(areas.byIndex[i]->thermal.list.enabledAndNotMustRunCount(),
+                                      false);
+    }
+    for (const auto& bc: activeConstraints)
+    {
+        BindingConstraintStructures structures = bc->initLinkArrays();
+        for (uint j = 0; j < bc->clusterCount(); ++j)
+        {
+            inBindingConstraint[structures.clustersAreaIndex[j]][structures.clusterIndex[j]]
+              = true;
+        }
+    }
+
+    aggregateOfCluster_.resize(nbAreas);
+    clustersOfAggregate_.resize(nbAreas);
+    hasMergedClusters_.assign(nbAreas, false);
+
+    for (uint i = 0; i != nbAreas; ++i)
+    {
+        const auto& area = *areas.byIndex[i];
+        auto& aggregateOfCluster = aggregateOfCluster_[i];
+        auto& clustersOfAggregate = clustersOfAggregate_[i];
+        aggregateOfCluster.resize(inBindingConstraint[i].size());
+
+        for (const auto& cluster: area.thermal.list.each_enabled_and_not_mustrun())
+        {
+            uint aggregate = static_cast<uint>(clustersOfAggregate.size());
+            if (!inBindingConstraint[i][cluster->index])
+            {
+                for (uint g = 0; g != clustersOfAggregate.size(); ++g)
+                {
+                    const auto* first = clustersOfAggregate[g].front();
+                    if (!inBindingConstraint[i][first->index] && canBeMerged(*first, *cluster))
+                    {
+                        aggregate = g;
+                        break;
+                    }
+                }
+            }
+
+            if (aggregate == clustersOfAggregate.size())
+            {
+                clustersOfAggregate.emplace_back();
+            }
+            else
+            {
+                hasMergedClusters_[i] = true;
+            }
+            clustersOfAggregate[aggregate].push_back(cluster.get());
+            aggregateOfCluster[cluster->index] = aggregate;
+        }
+
+        totalAggregateCount_ += static_cast<uint>(clustersOfAggregate.size());
+        totalClusterCount_ += static_cast<uint>(aggregateOfCluster.size());
+    }
+}
+
+void ThermalClusterAggregation::disaggregate(PROBLEME_HEBDO& problem,
+                                             uint year,
+                                             uint firstHourOfTheWeek) const
+{
+    const uint nbHours = problem.NombreDePasDeTemps;
+    const uint hoursPerOptimization = problem.NombreDePasDeTempsPourUneOptimisation > 0
+                                        ? problem.NombreDePasDeTempsPourUneOptimisation
+                                        : nbHours;
+    std::vector<double> production;
+    std::vector<double> unitsOn;
+    std::vector<double> startingUnits;
+    std::vector<double> stoppingUnits;
+    std::vector<double> breakingDownUnits;
+
+    for (uint i = 0; i != clustersOfAggregate_.size(); ++i)
+    {
+        // Without merged clusters, aggregated clusters and clusters are the same
+        if (!hasMergedClusters_[i])
+        {
+            continue;
+        }
+
+        const auto& clustersOfAggregate = clustersOfAggregate_[i];
+        auto& results = problem.ResultatsHoraires[i].ProductionThermique;
+        const uint nbAggregates = aggregateCount(i);
+
+        // Production and units ON of each cluster. The results of the aggregated clusters are
+        // overwritten in place.
+        for (uint h = 0; h != nbHours; ++h)
+        {
+            auto& hourly = results[h];
+            production.assign(hourly.ProductionThermiqueDuPalier.begin(),
+                              hourly.ProductionThermiqueDuPalier.begin() + nbAggregates);
+            unitsOn.assign(hourly.NombreDeGroupesEnMarcheDuPalier.begin(),
+                           hourly.NombreDeGroupesEnMarcheDuPalier.begin() + nbAggregates);
+            startingUnits.assign(hourly.NombreDeGroupesQuiDemarrentDuPalier.begin(),
+                                 hourly.NombreDeGroupesQuiDemarrentDuPalier.begin()
+                                   + nbAggregates);
+            stoppingUnits.assign(hourly.NombreDeGroupesQuiSArretentDuPalier.begin(),
+                                 hourly.NombreDeGroupesQuiSArretentDuPalier.begin()
+                                   + nbAggregates);
+            breakingDownUnits.assign(hourly.NombreDeGroupesQuiTombentEnPanneDuPalier.begin(),
+                                     hourly.NombreDeGroupesQuiTombentEnPanneDuPalier.begin()
+                                       + nbAggregates);
+
+            for (uint g = 0; g != nbAggregates; ++g)
+            {
+                const auto& clusters = clustersOfAggregate[g];
+                if (clusters.size() == 1)
+                {
+                    const uint c = clusters.front()->index;
+                    hourly.ProductionThermiqueDuPalier[c] = production[g];
+                    hourly.NombreDeGroupesEnMarcheDuPalier[c] = unitsOn[g];
+                    hourly.NombreDeGroupesQuiDemarrentDuPalier[c] = startingUnits[g];
+                    hourly.NombreDeGroupesQuiSArretentDuPalier[c] = stoppingUnits[g];
+                    hourly.NombreDeGroupesQuiTombentEnPanneDuPalier[c] = breakingDownUnits[g];
+                    continue;
+                }
+
+                // Pro rata of the available power, the same for all the clusters if none
+                double totalAvailablePower = 0.;
+                for (const auto* cluster: clusters)
+                {
+                    totalAvailablePower += cluster->series.getCoefficient(year,
+                                                                          firstHourOfTheWeek + h);
+                }
+                const double unitSize = clusters.front()->nominalCapacityWithSpinning;
+                for (const auto* cluster: clusters)
+                {
+                    const uint c = cluster->index;
+                    const double share = totalAvailablePower > 0.
+                                           ? cluster->series.getCoefficient(year,
+                                                                            firstHourOfTheWeek
+                                                                              + h)
+                                               / totalAvailablePower
+                                           : 1. / static_cast<double>(clusters.size());
+                    hourly.ProductionThermiqueDuPalier[c] = production[g] * share;
+                    // The fewest units able to produce the share of the cluster
+                    hourly.NombreDeGroupesEnMarcheDuPalier[c] = roundedUpUnits(
+                      hourly.ProductionThermiqueDuPalier[c],
+                      unitSize,
+                      cluster->unitCount);
+                    // Limited to the stopping units below
+                    hourly.NombreDeGroupesQuiTombentEnPanneDuPalier[c] = std::ceil(
+                      breakingDownUnits[g] * share - 1e-6);
+                }
+            }
+        }
+
+        // Starting and stopping units of each cluster, from its units ON at the previous hour
+        // of the optimization (the last one for the first hour, as in the weekly problem)
+        for (uint h = 0; h != nbHours; ++h)
+        {
+            const uint previous = (h % hoursPerOptimization == 0) ? h + hoursPerOptimization - 1
+                                                                  : h - 1;
+            auto& hourly = results[h];
+            for (const auto& clusters: clustersOfAggregate)
+            {
+                if (clusters.size() == 1)
+                {
+                    continue;
+                }
+                for (const auto* cluster: clusters)
+                {
+                    const uint c = cluster->index;
+                    const double change = hourly.NombreDeGroupesEnMarcheDuPalier[c]
+                                          - results[previous].NombreDeGroupesEnMarcheDuPalier[c];
+                    hourly.NombreDeGroupesQuiDemarrentDuPalier[c] = std::max(change, 0.);
+                    hourly.NombreDeGroupesQuiSArretentDuPalier[c] = std::max(-change, 0.);
+                    hourly.NombreDeGroupesQuiTombentEnPanneDuPalier[c] = std::min(
+                      hourly.NombreDeGroupesQuiTombentEnPanneDuPalier[c],
+                      hourly.NombreDeGroupesQuiSArretentDuPalier[c]);
+                }
+            }
+        }
+    }
+}
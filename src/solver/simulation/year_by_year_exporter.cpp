@@ -0,0 +1,64 @@
+
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include "antares/solver/simulation/year_by_year_exporter.h"
+
+namespace Antares::Solver::Simulation
+{
+YearByYearExporter::YearByYearExporter(uint nbSpaces):
+    pending_(nbSpaces)
+{
+    // The exports are serialized, so that they only take a single core from the years
+    // computed in parallel
+    queue_.maximumThreadCount(1);
+    queue_.start();
+}
+
+YearByYearExporter::~YearByYearExporter()
+{
+    // Nothing is re-thrown here, the errors are reported by waitFor() and waitAll()
+    queue_.wait(Yuni::qseIdle);
+    queue_.stop();
+}
+
+void YearByYearExporter::add(uint numSpace, const Concurrency::Task& task)
+{
+    pending_[numSpace] = Concurrency::AddTask(queue_, task);
+}
+
+void YearByYearExporter::waitFor(uint numSpace)
+{
+    if (auto& export_ = pending_[numSpace]; export_.valid())
+    {
+        export_.get();
+    }
+}
+
+void YearByYearExporter::waitAll()
+{
+    for (uint numSpace = 0; numSpace != pending_.size(); ++numSpace)
+    {
+        waitFor(numSpace);
+    }
+}
+
+} // namespace Antares::Solver::Simulation
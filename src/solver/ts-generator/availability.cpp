@@ -19,8 +19,13 @@
 ** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
 */
 
+#include <algorithm>
+#include <numeric>
+#include <set>
 #include <string>
 
+#include <antares/benchmarking/timer.h>
+#include <antares/concurrency/concurrency.h>
 #include <antares/io/file.h> // For Antares::IO::fileSetContent
 #include <antares/logs/logs.h>
 #include <antares/solver/ts-generator/generator.h>
@@ -682,4 +687,202 @@ bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
 
     return true;
 }
+
+namespace
+{
+//! Number of elements whose duration is reported at the end of a parallel generation
+constexpr uint nbSlowestElementsToReport = 10;
+
+/*!
+** \brief Seed of the random number generator of an element, in a parallel generation
+**
+** The seed and the rank are mixed (splitmix64 finalizer), so that two close seeds or two
+** consecutive ranks do not give correlated streams.
+*/
+uint elementSeed(uint seed, uint rank)
+{
+    uint64_t z = (static_cast<uint64_t>(seed) << 32) + rank + 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return static_cast<uint>(z ^ (z >> 31));
+}
+
+// The directories are created once, before the files are written concurrently
+void createParentDirectories(const std::vector<fs::path>& files)
+{
+    std::set<fs::path> directories;
+    for (const auto& file: files)
+    {
+        directories.insert(file.parent_path());
+    }
+    for (const auto& directory: directories)
+    {
+        fs::create_directories(directory);
+    }
+}
+
+// The text is formatted by the thread which generated the series
+bool writeGeneratedTS(const Matrix<>& series, const fs::path& filePath)
+{
+    std::string buffer;
+    series.saveToBuffer(buffer, 0);
+    return IO::fileSetContent(filePath.string(), buffer);
+}
+
+void logDurations(const std::vector<std::string>& names, const std::vector<int64_t>& durations)
+{
+    std::vector<uint> ranks(names.size());
+    std::iota(ranks.begin(), ranks.end(), 0);
+    std::ranges::sort(ranks, [&durations](uint a, uint b) { return durations[a] > durations[b]; });
+
+    int64_t total = std::accumulate(durations.begin(), durations.end(), int64_t(0));
+    logs.info() << "  " << names.size() << " elements generated, " << total
+                << " ms of generation in total";
+    for (uint i = 0; i != std::min<size_t>(ranks.size(), nbSlowestElementsToReport); ++i)
+    {
+        logs.info() << "  " << names[ranks[i]] << ": " << durations[ranks[i]] << " ms";
+    }
+}
+
+/*!
+** \brief Run generate(rank) for all the elements, on a pool of threads
+**
+** \return False if the generation of an element has failed
+*/
+bool generateInParallel(const std::vector<std::string>& names,
+                        uint nbThreads,
+                        const std::function<bool(uint)>& generate)
+{
+    std::vector<int64_t> durations(names.size(), 0);
+    std::vector<char> succeeded(names.size(), true);
+
+    Yuni::Job::QueueService queueService;
+    queueService.maximumThreadCount(std::max(nbThreads, 1u));
+
+    Concurrency::FutureSet results;
+    for (uint rank = 0; rank != names.size(); ++rank)
+    {
+        results.add(Concurrency::AddTask(queueService,
+                                         [&generate, &durations, &succeeded, rank]
+                                         {
+                                             Benchmarking::Timer timer;
+                                             succeeded[rank] = generate(rank);
+                                             timer.stop();
+                                             durations[rank] = timer.get_duration();
+                                         }));
+    }
+    queueService.start();
+    queueService.wait(Yuni::qseIdle);
+    queueService.stop();
+    results.join();
+
+    logDurations(names, durations);
+    return std::ranges::all_of(succeeded, [](char s) { return s; });
+}
+} // namespace
+
+bool generateThermalTimeSeriesInParallel(Data::Study& study,
+                                         const std::vector<Data::ThermalCluster*>& clusters,
+                                         unsigned int seed,
+                                         unsigned int nbThreads,
+                                         const fs::path& savePath)
+{
+    logs.info();
+    logs.info() << "Generating the thermal time-series (" << nbThreads << " threads)";
+
+    std::vector<std::string> names;
+    std::vector<fs::path> files;
+    for (auto* cluster: clusters)
+    {
+        auto areaName = cluster->parentArea->id.to<std::string>();
+        names.push_back(areaName + "." + cluster->id());
+        files.push_back(savePath / areaName / cluster->id() += ".txt");
+    }
+    createParentDirectories(files);
+
+    return generateInParallel(
+      names,
+      nbThreads,
+      [&study, &clusters, &files, seed](uint rank)
+      {
+          MersenneTwister random;
+          random.reset(elementSeed(seed, rank));
+          auto generator = AvailabilityTSgenerator(study.parameters.derated,
+                                                   study.parameters.nbTimeSeriesThermal,
+                                                   random);
+          auto* cluster = clusters[rank];
+          AvailabilityTSGeneratorData tsGenerationData(cluster);
+          cluster->series.timeSeries = generator.run(tsGenerationData);
+          return writeGeneratedTS(cluster->series.timeSeries, files[rank]);
+      });
+}
+
+bool generateLinkTimeSeriesInParallel(std::vector<LinkTSgenerationParams>& links,
+                                      const StudyParamsForLinkTS& generalParams,
+                                      unsigned int nbThreads,
+                                      const fs::path& savePath)
+{
+    logs.info();
+    logs.info() << "Generation of links time-series (" << nbThreads << " threads)";
+
+    // The ranks are the ones in the list of links, whether a link is generated or not
+    std::vector<uint> ranks;
+    std::vector<std::string> names;
+    // Only needed to create the directories, both files of a link are in the same one
+    std::vector<fs::path> files;
+    bool valid = true;
+    for (uint rank = 0; rank != links.size(); ++rank)
+    {
+        const auto& link = links[rank];
+        if (!link.hasValidData)
+        {
+            logs.error() << "Missing data for link " << link.namesPair.first << "/"
+                         << link.namesPair.second;
+            valid = false;
+            continue;
+        }
+        if (link.forceNoGeneration)
+        {
+            continue; // Skipping the link
+        }
+        ranks.push_back(rank);
+        names.push_back(link.namesPair.first + "." + link.namesPair.second);
+        auto filePath = savePath / link.namesPair.first / link.namesPair.second;
+        files.push_back(filePath += "_direct.txt");
+    }
+    if (!valid)
+    {
+        return false;
+    }
+    createParentDirectories(files);
+
+    return generateInParallel(
+      names,
+      nbThreads,
+      [&links, &generalParams, &ranks, &savePath](uint i)
+      {
+          auto& link = links[ranks[i]];
+          MersenneTwister random;
+          random.reset(elementSeed(generalParams.seed, ranks[i]));
+          auto generator = AvailabilityTSgenerator(generalParams.derated,
+                                                   generalParams.nbLinkTStoGenerate,
+                                                   random);
+          auto filePath = savePath / link.namesPair.first / link.namesPair.second;
+
+          // === DIRECT =======================
+          AvailabilityTSGeneratorData tsConfigDataDirect(link,
+                                                         link.modulationCapacityDirect,
+                                                         link.namesPair.second);
+          bool written = writeGeneratedTS(generator.run(tsConfigDataDirect),
+                                          fs::path(filePath) += "_direct.txt");
+
+          // === INDIRECT =======================
+          AvailabilityTSGeneratorData tsConfigDataIndirect(link,
+                                                           link.modulationCapacityIndirect,
+                                                           link.namesPair.second);
+          return writeGeneratedTS(generator.run(tsConfigDataIndirect),
+                                  filePath += "_indirect.txt")
+                 && written;
+      });
+}
 } // namespace Antares::TSGenerator
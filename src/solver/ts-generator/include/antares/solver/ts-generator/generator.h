@@ -45,6 +45,8 @@ struct StudyParamsForLinkTS
     // gp : we will have a problem with that if seed-tsgen-links not set in
     // gp : generaldata.ini. In that case, our default value is wrong.
     MersenneTwister random;
+    //! The seed `random` was reset with, for a parallel generation
+    unsigned int seed = MersenneTwister::defaultSeed;
 };
 
 struct LinkTSgenerationParams
@@ -115,6 +117,30 @@ bool generateLinkTimeSeries(std::vector<LinkTSgenerationParams>& links,
                             StudyParamsForLinkTS&,
                             const fs::path& savePath);
 
+/*!
+** \brief Generate and write the time-series of the thermal clusters, in parallel
+**
+** Each cluster draws from its own random number generator, seeded from \p seed and the rank of
+** the cluster in the list. The series do not depend on the number of threads, but they differ
+** from the ones of generateThermalTimeSeries(), where the clusters share a single generator.
+** The duration of the generation of each cluster is reported at the end.
+*/
+bool generateThermalTimeSeriesInParallel(Data::Study& study,
+                                         const std::vector<Data::ThermalCluster*>& clusters,
+                                         unsigned int seed,
+                                         unsigned int nbThreads,
+                                         const fs::path& savePath);
+
+/*!
+** \brief Generate and write the time-series of the links, in parallel
+**
+** Same as generateThermalTimeSeriesInParallel(), the seed being the one of the links.
+*/
+bool generateLinkTimeSeriesInParallel(std::vector<LinkTSgenerationParams>& links,
+                                      const StudyParamsForLinkTS&,
+                                      unsigned int nbThreads,
+                                      const fs::path& savePath);
+
 std::vector<Data::ThermalCluster*> getAllClustersToGen(const Data::AreaList& areas,
                                                        bool globalThermalTSgeneration);
 
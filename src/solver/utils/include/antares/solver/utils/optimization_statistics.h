@@ -23,7 +23,9 @@
 
 #include <atomic>
 #include <cmath>
+#include <map>
 #include <string>
+#include <utility>
 
 class OptimizationStatistics
 {
@@ -34,7 +36,17 @@ private:
     std::atomic<long long> totalUpdateTime;
     std::atomic<unsigned int> nbUpdate;
 
+    // Solve time of the last resolution of each (week, interval), kept from one year to the
+    // next. Only used by the thread owning the weekly problem.
+    std::map<std::pair<unsigned, int>, long long> lastSolveTimes;
+    long long sumOfLastSolveTimes = 0;
+
 public:
+    //! A resolution is slow if it took this much longer than the average resolution
+    static constexpr long long slowResolutionFactor = 2;
+    //! Resolutions below this time (ms) are never considered as slow
+    static constexpr long long slowResolutionMinTime = 1000;
+
     void reset()
     {
         totalSolveTime = 0;
@@ -52,7 +64,9 @@ public:
         totalSolveTime(rhs.totalSolveTime.load()),
         nbSolve(rhs.nbSolve.load()),
         totalUpdateTime(rhs.totalUpdateTime.load()),
-        nbUpdate(rhs.nbUpdate.load())
+        nbUpdate(rhs.nbUpdate.load()),
+        lastSolveTimes(std::move(rhs.lastSolveTimes)),
+        sumOfLastSolveTimes(rhs.sumOfLastSolveTimes)
     {
     }
 
@@ -80,6 +94,28 @@ public:
         nbSolve++;
     }
 
+    void addSolveTime(long long solveTime, unsigned week, int interval)
+    {
+        addSolveTime(solveTime);
+        auto [it, inserted] = lastSolveTimes.try_emplace({week, interval}, solveTime);
+        sumOfLastSolveTimes += inserted ? solveTime : solveTime - it->second;
+        it->second = solveTime;
+    }
+
+    /*!
+    ** \brief Whether the last resolution of a (week, interval) was much slower than the others
+    */
+    bool wasSlow(unsigned week, int interval) const
+    {
+        auto it = lastSolveTimes.find({week, interval});
+        if (it == lastSolveTimes.end() || it->second < slowResolutionMinTime)
+        {
+            return false;
+        }
+        const auto count = static_cast<long long>(lastSolveTimes.size());
+        return it->second * count > slowResolutionFactor * sumOfLastSolveTimes;
+    }
+
     unsigned int getNbUpdate() const
     {
         return nbUpdate;
@@ -21,8 +21,11 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include <antares/concurrency/concurrency.h>
 #include <antares/writer/i_writer.h>
 
 // ignore unused parameters warnings from ortools
@@ -53,6 +56,12 @@ std::list<std::string> getAvailableOrtoolsSolverName();
  */
 std::string availableOrToolsSolversString();
 
+/*!
+ *  \brief Return true if the resolutions of the solver can be interrupted, both as a linear and as
+ * a mixed integer solver
+ */
+bool ortoolsSolverSupportsInterruption(const std::string& solverName);
+
 /*!
  *  \brief Create a MPSolver with correct linear or mixed variant
  *
@@ -129,5 +138,59 @@ private:
     void CopyRows(MPSolver* solver) const;
     void CopyMatrix(const MPSolver* solver) const;
 };
+
+/*!
+** \brief Race a challenger solver against the main resolution of a problem
+**
+** The challenger solves its own copy of the problem from scratch, as a task of a queue service.
+** The first one to find the optimum interrupts the other, both solvers must support it (see
+** ortoolsSolverSupportsInterruption()). The challenger is cancelled if it has not started when
+** the main resolution returns, which then can no longer be interrupted.
+*/
+class SolverRace
+{
+public:
+    SolverRace(const std::string& challengerName,
+               const PROBLEME_SIMPLEXE_NOMME& problem,
+               const Antares::Solver::Optimization::OptimizationOptions& options);
+    ~SolverRace();
+
+    SolverRace(const SolverRace&) = delete;
+    SolverRace& operator=(const SolverRace&) = delete;
+
+    //! Queue the challenger, interrupting `mainSolver` if it finds the optimum first
+    void start(MPSolver* mainSolver, Yuni::Job::QueueService& queue);
+
+    /*!
+    ** \brief Surround the resolution of the main solver
+    **
+    ** The main solver is only interrupted between both calls: it is reused for the next
+    ** resolutions, which a late interruption would abort.
+    */
+    void mainSolveBegins();
+    void mainSolveEnds();
+
+    /*!
+    ** \brief Settle the race, once the main resolution of the problem has returned
+    **
+    ** If the main resolution failed and the challenger found the optimum, the solution of
+    ** the challenger is copied into the problem.
+    ** \return True if the solution of the challenger was kept
+    */
+    bool finish(PROBLEME_SIMPLEXE_NOMME& problem);
+
+    //! True if the challenger started before the race was settled
+    bool challengerStarted() const;
+
+private:
+    //! Cancel the challenger if not started, else wait for it (interrupted if `keepMain`)
+    void settle(bool keepMain);
+
+    // Shared with the task of the challenger, which may run after the race is settled
+    struct Challenger;
+    std::shared_ptr<Challenger> challenger_;
+    Antares::Concurrency::TaskFuture task_;
+    bool settled_ = false;
+};
 } // namespace Optimization
 } // namespace Antares
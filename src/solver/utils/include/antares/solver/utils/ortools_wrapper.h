@@ -29,10 +29,17 @@
 
 using namespace operations_research;
 
+namespace Antares::Optimization
+{
+class SolverRace;
+}
+
+// If `race` is given, its challenger may only interrupt the resolution itself
 MPSolver* ORTOOLS_Simplexe(Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* Probleme,
                            MPSolver* ProbSpx,
                            bool keepBasis,
-                           const Antares::Solver::Optimization::OptimizationOptions& options);
+                           const Antares::Solver::Optimization::OptimizationOptions& options,
+                           Antares::Optimization::SolverRace* race = nullptr);
 
 MPSolver* ORTOOLS_ConvertIfNeeded(const std::string& solverName,
                                   const Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* Probleme,
@@ -20,7 +20,11 @@
 */
 #include "antares/solver/utils/ortools_utils.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
+#include <mutex>
 
 #include <antares/exception/AssertionError.hpp>
 #include <antares/exception/LoadingError.hpp>
@@ -207,66 +211,65 @@ void ProblemSimplexeNommeConverter::CopyRows(MPSolver* solver) const
 } // namespace Optimization
 } // namespace Antares
 
-static void extractSolutionValues(const std::vector<MPVariable*>& variables,
-                                  Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* problemeSimplexe)
+static void extractSolutionValues(const std::vector<MPVariable*>& variables, double* X)
 {
-    int nbVar = problemeSimplexe->NombreDeVariables;
-    for (int idxVar = 0; idxVar < nbVar; ++idxVar)
+    for (size_t idxVar = 0; idxVar < variables.size(); ++idxVar)
     {
-        const MPVariable* var = variables[idxVar];
-        problemeSimplexe->X[idxVar] = var->solution_value();
+        X[idxVar] = variables[idxVar]->solution_value();
     }
 }
 
-static void extractReducedCosts(const std::vector<MPVariable*>& variables,
-                                Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* problemeSimplexe)
+static void extractReducedCosts(const std::vector<MPVariable*>& variables, double* reducedCosts)
 {
-    int nbVar = problemeSimplexe->NombreDeVariables;
-    for (int idxVar = 0; idxVar < nbVar; ++idxVar)
+    for (size_t idxVar = 0; idxVar < variables.size(); ++idxVar)
     {
-        const MPVariable* var = variables[idxVar];
-        problemeSimplexe->CoutsReduits[idxVar] = var->reduced_cost();
+        reducedCosts[idxVar] = variables[idxVar]->reduced_cost();
     }
 }
 
-static void extractDualValues(const std::vector<MPConstraint*>& constraints,
-                              Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* problemeSimplexe)
+static void extractDualValues(const std::vector<MPConstraint*>& constraints, double* dualValues)
 {
-    int nbRows = problemeSimplexe->NombreDeContraintes;
-    for (int idxRow = 0; idxRow < nbRows; ++idxRow)
+    for (size_t idxRow = 0; idxRow < constraints.size(); ++idxRow)
     {
-        const MPConstraint* row = constraints[idxRow];
-        problemeSimplexe->CoutsMarginauxDesContraintes[idxRow] = row->dual_value();
+        dualValues[idxRow] = constraints[idxRow]->dual_value();
     }
 }
 
 static void extract_from_MPSolver(const MPSolver* solver,
-                                  Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* problemeSimplexe)
+                                  bool isMIP,
+                                  double* X,
+                                  double* reducedCosts,
+                                  double* dualValues)
 {
     assert(solver);
-    assert(problemeSimplexe);
-
-    const bool isMIP = problemeSimplexe->isMIP();
 
-    extractSolutionValues(solver->variables(), problemeSimplexe);
+    extractSolutionValues(solver->variables(), X);
 
     if (isMIP)
     {
         // TODO extract dual values & marginal costs from LP with fixed integer variables
-        const int nbVar = problemeSimplexe->NombreDeVariables;
-        std::fill(problemeSimplexe->CoutsReduits, problemeSimplexe->CoutsReduits + nbVar, 0.);
-        const int nbRows = problemeSimplexe->NombreDeContraintes;
-        std::fill(problemeSimplexe->CoutsMarginauxDesContraintes,
-                  problemeSimplexe->CoutsMarginauxDesContraintes + nbRows,
-                  0.);
+        std::fill(reducedCosts, reducedCosts + solver->NumVariables(), 0.);
+        std::fill(dualValues, dualValues + solver->NumConstraints(), 0.);
     }
     else
     {
-        extractReducedCosts(solver->variables(), problemeSimplexe);
-        extractDualValues(solver->constraints(), problemeSimplexe);
+        extractReducedCosts(solver->variables(), reducedCosts);
+        extractDualValues(solver->constraints(), dualValues);
     }
 }
 
+static void extract_from_MPSolver(const MPSolver* solver,
+                                  Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* problemeSimplexe)
+{
+    assert(problemeSimplexe);
+
+    extract_from_MPSolver(solver,
+                          problemeSimplexe->isMIP(),
+                          problemeSimplexe->X,
+                          problemeSimplexe->CoutsReduits,
+                          problemeSimplexe->CoutsMarginauxDesContraintes);
+}
+
 std::string generateTempPath(const std::string& filename)
 {
     namespace fs = std::filesystem;
@@ -347,7 +350,8 @@ MPSolver* ORTOOLS_ConvertIfNeeded(const std::string& solverName,
 MPSolver* ORTOOLS_Simplexe(Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* Probleme,
                            MPSolver* solver,
                            bool keepBasis,
-                           const OptimizationOptions& options)
+                           const OptimizationOptions& options,
+                           Antares::Optimization::SolverRace* race)
 {
     MPSolverParameters params;
     setGenericParameters(
@@ -364,7 +368,16 @@ MPSolver* ORTOOLS_Simplexe(Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* Probl
         Probleme->basisStatus.setStartingBasis(solver);
     }
 
-    if (solveAndManageStatus(solver, Probleme->ExistenceDUneSolution, params))
+    if (race)
+    {
+        race->mainSolveBegins();
+    }
+    const bool solved = solveAndManageStatus(solver, Probleme->ExistenceDUneSolution, params);
+    if (race)
+    {
+        race->mainSolveEnds();
+    }
+    if (solved)
     {
         extract_from_MPSolver(solver, Probleme);
         // Save the final simplex basis for next resolutions
@@ -474,6 +487,21 @@ std::string availableOrToolsSolversString()
     return solvers.str();
 }
 
+bool ortoolsSolverSupportsInterruption(const std::string& solverName)
+{
+    const auto& names = OrtoolsUtils::solverMap.at(solverName);
+    for (const auto& name: {names.LPSolverName, names.MIPSolverName})
+    {
+        // A solver which supports interruptions accepts them even when it is not solving
+        std::unique_ptr<MPSolver> solver(MPSolver::CreateSolver(name));
+        if (!solver || !solver->InterruptSolve())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 MPSolver* MPSolverFactory(const Antares::Optimization::PROBLEME_SIMPLEXE_NOMME* probleme,
                           const std::string& solverName)
 {
@@ -506,3 +534,210 @@ MPSolver* MPSolverFactory(const Antares::Optimization::PROBLEME_SIMPLEXE_NOMME*
 
     return solver;
 }
+
+namespace Antares::Optimization
+{
+// Interrupting a solver which is not solving yet has no effect, hence the retries
+static constexpr auto interruptionRetryDelay = std::chrono::milliseconds(10);
+
+struct SolverRace::Challenger
+{
+    enum class Winner
+    {
+        none,
+        main,
+        challenger
+    };
+
+    //! Solve the problem, unless the race was settled before
+    void run();
+    //! Interrupt `solver` until `done` is set, the mutex must be locked
+    void interruptUntil(MPSolver* solver, const bool& done, std::unique_lock<std::mutex>& lock);
+    //! Interrupt the main solver while it solves, until it returns, the mutex must be locked
+    void interruptMain(std::unique_lock<std::mutex>& lock);
+
+    std::unique_ptr<MPSolver> solver;
+    bool isMIP = false;
+    MPSolver* mainSolver = nullptr;
+
+    std::atomic<Winner> winner = Winner::none;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool started = false;
+    bool mainSolving = false;
+    bool mainDone = false;
+    bool done = false;
+
+    // The solution of the challenger, only read once it is done
+    bool succeeded = false;
+    std::vector<double> X;
+    std::vector<double> reducedCosts;
+    std::vector<double> dualValues;
+};
+
+void SolverRace::Challenger::interruptUntil(MPSolver* solver,
+                                            const bool& done,
+                                            std::unique_lock<std::mutex>& lock)
+{
+    while (!done)
+    {
+        solver->InterruptSolve();
+        cv.wait_for(lock, interruptionRetryDelay);
+    }
+}
+
+void SolverRace::Challenger::interruptMain(std::unique_lock<std::mutex>& lock)
+{
+    while (!mainDone)
+    {
+        if (mainSolving)
+        {
+            mainSolver->InterruptSolve();
+        }
+        cv.wait_for(lock, interruptionRetryDelay);
+    }
+}
+
+void SolverRace::Challenger::run()
+{
+    {
+        std::lock_guard lock(mutex);
+        if (mainDone)
+        {
+            return; // cancelled
+        }
+        started = true;
+    }
+
+    MPSolverParameters params;
+    setGenericParameters(params);
+    const auto status = solver->Solve(params);
+
+    bool won = false;
+    if (status == MPSolver::OPTIMAL || status == MPSolver::FEASIBLE)
+    {
+        X.resize(solver->NumVariables());
+        reducedCosts.resize(solver->NumVariables());
+        dualValues.resize(solver->NumConstraints());
+        extract_from_MPSolver(solver.get(),
+                              isMIP,
+                              X.data(),
+                              reducedCosts.data(),
+                              dualValues.data());
+        succeeded = true;
+
+        Winner expected = Winner::none;
+        won = winner.compare_exchange_strong(expected, Winner::challenger);
+    }
+
+    std::unique_lock lock(mutex);
+    if (won)
+    {
+        interruptMain(lock);
+    }
+    done = true;
+    cv.notify_all();
+}
+
+SolverRace::SolverRace(const std::string& challengerName,
+                       const PROBLEME_SIMPLEXE_NOMME& problem,
+                       const OptimizationOptions& options):
+    challenger_(std::make_shared<Challenger>())
+{
+    ProblemSimplexeNommeConverter converter(challengerName, &problem);
+    challenger_->solver.reset(converter.Convert());
+    challenger_->isMIP = problem.isMIP();
+    // The specific parameters of the main solver do not apply to another one
+    TuneSolverSpecificOptions(challenger_->solver.get(),
+                              challengerName,
+                              challengerName == options.ortoolsSolver ? options.solverParameters
+                                                                      : "");
+}
+
+SolverRace::~SolverRace()
+{
+    if (task_.valid() && !settled_)
+    {
+        settle(true);
+    }
+}
+
+void SolverRace::start(MPSolver* mainSolver, Yuni::Job::QueueService& queue)
+{
+    challenger_->mainSolver = mainSolver;
+    task_ = Concurrency::AddTask(queue,
+                                 [challenger = challenger_] { challenger->run(); },
+                                 Yuni::Job::priorityHigh);
+}
+
+void SolverRace::mainSolveBegins()
+{
+    std::lock_guard lock(challenger_->mutex);
+    challenger_->mainSolving = true;
+}
+
+void SolverRace::mainSolveEnds()
+{
+    auto& c = *challenger_;
+    std::lock_guard lock(c.mutex);
+    c.mainSolving = false;
+    // The challenger stops interrupting the main solver, or is cancelled if not started yet
+    c.mainDone = true;
+    c.cv.notify_all();
+}
+
+void SolverRace::settle(bool keepMain)
+{
+    settled_ = true;
+    auto& c = *challenger_;
+    Challenger::Winner expected = Challenger::Winner::none;
+    if (keepMain)
+    {
+        c.winner.compare_exchange_strong(expected, Challenger::Winner::main);
+    }
+
+    std::unique_lock lock(c.mutex);
+    c.mainDone = true;
+    c.cv.notify_all();
+    // A challenger which has not started yet never will: its thread may be the one of a
+    // resolution waiting for it
+    if (!c.started)
+    {
+        return;
+    }
+    if (c.winner == Challenger::Winner::main)
+    {
+        c.interruptUntil(c.solver.get(), c.done, lock);
+    }
+    else
+    {
+        // The main resolution failed by itself: the challenger may still rescue it
+        c.cv.wait(lock, [&c] { return c.done; });
+    }
+}
+
+bool SolverRace::finish(PROBLEME_SIMPLEXE_NOMME& problem)
+{
+    const bool mainSucceeded = problem.ExistenceDUneSolution == OUI_SPX;
+    settle(mainSucceeded);
+
+    // The solution of the main solver is already in place
+    const auto& c = *challenger_;
+    if (mainSucceeded || !c.started || !c.succeeded)
+    {
+        return false;
+    }
+
+    std::copy(c.X.begin(), c.X.end(), problem.X);
+    std::copy(c.reducedCosts.begin(), c.reducedCosts.end(), problem.CoutsReduits);
+    std::copy(c.dualValues.begin(), c.dualValues.end(), problem.CoutsMarginauxDesContraintes);
+    problem.ExistenceDUneSolution = OUI_SPX;
+    return true;
+}
+
+bool SolverRace::challengerStarted() const
+{
+    std::lock_guard lock(challenger_->mutex);
+    return challenger_->started;
+}
+} // namespace Antares::Optimization
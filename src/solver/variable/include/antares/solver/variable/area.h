@@ -165,6 +165,9 @@ public:
 
     uint64_t memoryUsage() const;
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor);
+
     template<class I>
     static void provideInformations(I& infos);
 
@@ -212,6 +215,8 @@ private:
     NextType* pAreas;
     //! The number of areas
     uint pAreaCount;
+    //! The study, to get the queue service used to compute the summary in parallel
+    Data::Study* pStudy = nullptr;
 
 }; // class Areas
 
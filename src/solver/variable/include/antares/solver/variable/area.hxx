@@ -21,6 +21,9 @@
 #ifndef __SOLVER_VARIABLE_AREA_HXX__
 #define __SOLVER_VARIABLE_AREA_HXX__
 
+#include <algorithm>
+
+#include <antares/concurrency/concurrency.h>
 #include <antares/study/filter.h>
 #include "antares/solver/variable/economy/dispatchable-generation-margin.h"
 
@@ -304,6 +307,8 @@ Areas<NextT>::~Areas()
 template<class NextT>
 void Areas<NextT>::initializeFromStudy(Data::Study& study)
 {
+    pStudy = &study;
+
     // The total number of areas
     pAreaCount = study.areas.size();
 
@@ -478,11 +483,39 @@ template<class NextT>
 void Areas<NextT>::computeSummary(std::map<unsigned int, unsigned int>& numSpaceToYear,
                                   unsigned int nbYearsForCurrentSummary)
 {
-    for (uint i = 0; i != pAreaCount; ++i)
+    auto* queueService = pStudy ? pStudy->pQueueService.get() : nullptr;
+    uint nbTasks = queueService ? std::min(queueService->maximumThreadCount(), pAreaCount) : 1;
+    if (nbTasks <= 1)
     {
-        // Broadcast to all areas
-        pAreas[i].computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        for (uint i = 0; i != pAreaCount; ++i)
+        {
+            // Broadcast to all areas
+            pAreas[i].computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+        }
+        return;
     }
+
+    // The variables of an area only merge into their own accumulators: the areas are
+    // dispatched by ranges on the (idle) threads of the MC years
+    Concurrency::FutureSet results;
+    for (uint t = 0; t != nbTasks; ++t)
+    {
+        uint first = t * pAreaCount / nbTasks;
+        uint last = (t + 1) * pAreaCount / nbTasks;
+        results.add(Concurrency::AddTask(
+          *queueService,
+          [this, first, last, numSpaceToYear, nbYearsForCurrentSummary]() mutable
+          {
+              for (uint i = first; i != last; ++i)
+              {
+                  pAreas[i].computeSummary(numSpaceToYear, nbYearsForCurrentSummary);
+              }
+          }));
+    }
+    queueService->start();
+    queueService->wait(Yuni::qseIdle);
+    queueService->stop();
+    results.join();
 }
 
 template<class NextT>
@@ -551,6 +584,16 @@ uint64_t Areas<NextT>::memoryUsage() const
     return result;
 }
 
+template<class NextT>
+template<class VisitorT>
+void Areas<NextT>::visitAccumulators(VisitorT& visitor)
+{
+    for (unsigned int i = 0; i != pAreaCount; ++i)
+    {
+        pAreas[i].visitAccumulators(visitor);
+    }
+}
+
 } // namespace Variable
 } // namespace Solver
 } // namespace Antares
@@ -154,6 +154,9 @@ public:
 
     uint64_t memoryUsage() const;
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor);
+
     template<class V>
     void yearEndSpatialAggregates(V&, uint, uint)
     {
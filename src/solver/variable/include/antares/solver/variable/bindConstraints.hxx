@@ -246,6 +246,16 @@ uint64_t BindingConstraints<NextT>::memoryUsage() const
     return result;
 }
 
+template<class NextT>
+template<class VisitorT>
+void BindingConstraints<NextT>::visitAccumulators(VisitorT& visitor)
+{
+    for (unsigned int i = 0; i != pBCcount; ++i)
+    {
+        pBindConstraints[i].visitAccumulators(visitor);
+    }
+}
+
 template<class NextT>
 void BindingConstraints<NextT>::weekForEachArea(State& state, unsigned int numSpace)
 {
@@ -332,6 +332,13 @@ public:
         return LeftType::memoryUsage() + RightType::memoryUsage();
     }
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        LeftType::visitAccumulators(visitor);
+        RightType::visitAccumulators(visitor);
+    }
+
     template<class I>
     static void provideInformations(I& infos)
     {
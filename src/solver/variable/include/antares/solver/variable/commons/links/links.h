@@ -176,6 +176,9 @@ public:
 
     uint64_t memoryUsage() const;
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor);
+
     void buildDigest(SurveyResults& results, int digestLevel, int dataLevel) const;
 
     template<class I>
@@ -360,6 +360,16 @@ inline uint64_t Links<VariablePerLink>::memoryUsage() const
     return result;
 }
 
+template<class VariablePerLink>
+template<class VisitorT>
+inline void Links<VariablePerLink>::visitAccumulators(VisitorT& visitor)
+{
+    for (uint i = 0; i != pLinkCount; ++i)
+    {
+        pLinks[i].visitAccumulators(visitor);
+    }
+}
+
 template<class VariablePerLink>
 Links<VariablePerLink>::~Links()
 {
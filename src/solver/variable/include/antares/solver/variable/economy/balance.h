@@ -144,6 +144,8 @@ public:
         pNbYearsParallel = study.maxNbYearsInParallel;
 
         InitializeResultsFromStudy(AncestorType::pResults, study);
+        // The hourly averages are used by the quadratic optimization of the flows
+        AncestorType::pResults.avgdata.allocateHourly();
 
         pValuesForTheCurrentYear = new VCardType::IntermediateValuesBaseType[pNbYearsParallel];
         for (unsigned int numSpace = 0; numSpace < pNbYearsParallel; numSpace++)
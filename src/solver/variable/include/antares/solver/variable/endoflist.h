@@ -233,6 +233,11 @@ public:
         return 0;
     }
 
+    template<class VisitorT>
+    static void visitAccumulators(VisitorT&)
+    {
+    }
+
     template<class I>
     static void provideInformations(I&)
     {
@@ -172,6 +172,15 @@ struct VariableAccessor
         return result;
     }
 
+    template<class VisitorT>
+    static void VisitAccumulators(Type& container, VisitorT& visitor)
+    {
+        for (uint i = 0; i != ColumnCountT; ++i)
+        {
+            container[i].visitAccumulators(visitor);
+        }
+    }
+
     template<class VCardT>
     static void BuildDigest(SurveyResults& results,
                             const Type& container,
@@ -394,6 +403,15 @@ struct VariableAccessor<ResultsT, Category::dynamicColumns>
         return result;
     }
 
+    template<class VisitorT>
+    static void VisitAccumulators(Type& container, VisitorT& visitor)
+    {
+        for (auto& results: container)
+        {
+            results.visitAccumulators(visitor);
+        }
+    }
+
     template<class VCardT>
     static void BuildDigest(SurveyResults& results,
                             const Type& container,
@@ -625,6 +643,12 @@ struct VariableAccessor<ResultsT, Category::singleColumn /* The default */>
         return container.memoryUsage();
     }
 
+    template<class VisitorT>
+    static void VisitAccumulators(Type& container, VisitorT& visitor)
+    {
+        container.visitAccumulators(visitor);
+    }
+
     template<class VCardT>
     static void BuildDigest(SurveyResults& results,
                             const Type& container,
@@ -751,6 +775,12 @@ struct VariableAccessor<ResultsT, Category::noColumn>
         return 0;
     }
 
+    template<class VisitorT>
+    static void VisitAccumulators(Type&, VisitorT&)
+    {
+        // Do nothing
+    }
+
     template<class VCardType>
     static void BuildSurveyReport(SurveyResults&, const Type&, int, int, int)
     {
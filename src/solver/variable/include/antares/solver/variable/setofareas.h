@@ -163,6 +163,9 @@ public:
 
     uint64_t memoryUsage() const;
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor);
+
     template<class I>
     static void provideInformations(I& infos);
 
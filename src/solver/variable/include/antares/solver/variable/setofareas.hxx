@@ -277,6 +277,16 @@ inline uint64_t SetsOfAreas<NextT>::memoryUsage() const
     return result;
 }
 
+template<class NextT>
+template<class VisitorT>
+inline void SetsOfAreas<NextT>::visitAccumulators(VisitorT& visitor)
+{
+    for (auto i = pBegin; i != pEnd; ++i)
+    {
+        (*i)->visitAccumulators(visitor);
+    }
+}
+
 template<class NextT>
 template<class I>
 inline void SetsOfAreas<NextT>::provideInformations(I& infos)
@@ -237,6 +237,19 @@ public:
     // -----------------------------------------------------------------
 }; // class State
 
+/*!
+** \brief Economically optimal number of units ON at each hour of [beginHour, endHour)
+**
+** The number of units ON is kept above ON_min for up to maxDurationON hours when it is
+** cheaper than stopping and restarting them. The hours outside of the range are left undefined.
+*/
+std::array<uint, HOURS_PER_YEAR> computeEconomicallyOptimalNbClustersON(
+  uint maxDurationON,
+  const std::array<uint, HOURS_PER_YEAR>& ON_min,
+  const std::array<uint, HOURS_PER_YEAR>& ON_max,
+  uint beginHour,
+  uint endHour);
+
 } // namespace Antares::Solver::Variable
 
 #include "state.hxx"
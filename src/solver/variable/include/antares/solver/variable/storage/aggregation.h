@@ -0,0 +1,123 @@
+/*
+** Copyright 2007-2024, RTE (https://www.rte-france.com)
+** See AUTHORS.txt
+** SPDX-License-Identifier: MPL-2.0
+** This file is part of Antares-Simulator,
+** Adequacy and Performance assessment for interconnected energy networks.
+**
+** Antares_Simulator is free software: you can redistribute it and/or modify
+** it under the terms of the Mozilla Public Licence 2.0 as published by
+** the Mozilla Foundation, either version 2 of the License, or
+** (at your option) any later version.
+**
+** Antares_Simulator is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+** Mozilla Public Licence 2.0 for more details.
+**
+** You should have received a copy of the Mozilla Public Licence 2.0
+** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+*/
+#ifndef __SOLVER_VARIABLE_STORAGE_AGGREGATION_H__
+#define __SOLVER_VARIABLE_STORAGE_AGGREGATION_H__
+
+#include <yuni/yuni.h>
+
+namespace Antares::Solver::Variable::Aggregation
+{
+/*!
+** \brief Number of blocks aggregated at the same time
+**
+** Each block has its own accumulator. The accumulators are independent, so the compiler can keep
+** them in a single SIMD register and the additions of a block no longer wait for each other.
+*/
+constexpr uint lanes = 4;
+
+/*!
+** \brief Sum of each block of `BlockSize` consecutive values (e.g. the 24 hours of a day)
+**
+** The values of a block are still added in order, starting from 0. The sums are therefore the
+** same as the ones of a plain loop, bit for bit.
+*/
+template<uint BlockSize>
+inline void sumPerBlock(const double* values, uint nbBlocks, double* sums)
+{
+    uint block = 0;
+    for (; block + lanes <= nbBlocks; block += lanes)
+    {
+        const double* first = values + block * BlockSize;
+        double acc[lanes] = {};
+        for (uint i = 0; i != BlockSize; ++i)
+        {
+            for (uint l = 0; l != lanes; ++l)
+            {
+                acc[l] += first[l * BlockSize + i];
+            }
+        }
+        for (uint l = 0; l != lanes; ++l)
+        {
+            sums[block + l] = acc[l];
+        }
+    }
+    for (; block != nbBlocks; ++block)
+    {
+        const double* first = values + block * BlockSize;
+        double acc = 0.;
+        for (uint i = 0; i != BlockSize; ++i)
+        {
+            acc += first[i];
+        }
+        sums[block] = acc;
+    }
+}
+
+/*!
+** \brief For each block of `BlockSize` consecutive values, set `value` if one of them is
+**   strictly positive, 0 otherwise
+**
+** The comparisons are accumulated without any branch.
+*/
+template<uint BlockSize>
+inline void anyPositivePerBlock(const double* values, uint nbBlocks, double value, double* out)
+{
+    for (uint block = 0; block != nbBlocks; ++block)
+    {
+        const double* first = values + block * BlockSize;
+        int any = 0;
+        for (uint i = 0; i != BlockSize; ++i)
+        {
+            any |= first[i] > 0.;
+        }
+        out[block] = any ? value : 0.;
+    }
+}
+
+/*!
+** \brief Sum of the values of [first, end) (e.g. the days of a week or of a month)
+**
+** The values are added in order, starting from 0, as in a plain loop.
+*/
+inline double sumOfRange(const double* values, uint first, uint end)
+{
+    double acc = 0.;
+    for (uint i = first; i != end; ++i)
+    {
+        acc += values[i];
+    }
+    return acc;
+}
+
+//! Whether one of the values of [first, end) is strictly positive, without any branch
+inline bool anyPositiveInRange(const double* values, uint first, uint end)
+{
+    int any = 0;
+    for (uint i = first; i != end; ++i)
+    {
+        any |= values[i] > 0.;
+    }
+    return any;
+}
+
+} // namespace Antares::Solver::Variable::Aggregation
+
+#endif // __SOLVER_VARIABLE_STORAGE_AGGREGATION_H__
@@ -166,6 +166,14 @@ protected:
         return avgdata.dynamicMemoryUsage() + NextType::memoryUsage();
     }
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        avgdata.visitAccumulators(visitor);
+        // Next
+        NextType::visitAccumulators(visitor);
+    }
+
     template<template<class, int> class DecoratorT>
     Antares::Memory::Stored<double>::ConstReturnType hourlyValuesForSpatialAggregate() const
     {
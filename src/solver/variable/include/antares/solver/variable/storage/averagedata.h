@@ -48,19 +48,36 @@ public:
 
     void initializeFromStudy(Data::Study& study);
 
+    //! Allocate the hourly values, even when no hourly synthesis is written
+    void allocateHourly();
+
     void reset();
 
     void merge(unsigned int year, const IntermediateValues& rhs);
 
     uint64_t dynamicMemoryUsage() const
     {
-        return sizeof(double) * HOURS_PER_YEAR + sizeof(double) * nbYearsCapacity;
+        return (hourly ? sizeof(double) * HOURS_PER_YEAR : 0) + sizeof(double) * nbYearsCapacity;
+    }
+
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        visitor.sum(monthly, MONTHS_PER_YEAR);
+        visitor.sum(weekly, WEEKS_PER_YEAR);
+        visitor.sum(daily, DAYS_PER_YEAR);
+        if (hourly)
+        {
+            visitor.sum(Memory::RawPointer(hourly), HOURS_PER_YEAR);
+        }
+        visitor.sum(year.data(), year.size());
     }
 
 public:
     double monthly[MONTHS_PER_YEAR];
     double weekly[WEEKS_PER_YEAR];
     double daily[DAYS_PER_YEAR];
+    //! Null when no hourly synthesis is written (see StudyRuntimeInfos::hourlySynthesis)
     Antares::Memory::Stored<double>::Type hourly;
     std::vector<double> year;
     unsigned int nbYearsCapacity;
@@ -76,6 +76,12 @@ protected:
         return 0;
     }
 
+    template<class VisitorT>
+    static void visitAccumulators(VisitorT&)
+    {
+        // Does nothing
+    }
+
     template<template<class, int> class DecoratorT>
     static Antares::Memory::Stored<double>::ConstReturnType hourlyValuesForSpatialAggregate()
     {
@@ -49,6 +49,7 @@ public:
     std::vector<Data> monthly{MONTHS_PER_YEAR};
     std::vector<Data> weekly{WEEKS_PER_YEAR};
     std::vector<Data> daily{DAYS_PER_YEAR};
+    //! Empty when no hourly synthesis is written (see StudyRuntimeInfos::hourlySynthesis)
     std::vector<Data> hourly{HOURS_PER_YEAR};
 
 }; // class MinMaxData
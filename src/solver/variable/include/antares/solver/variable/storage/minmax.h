@@ -145,7 +145,26 @@ protected:
 
     uint64_t memoryUsage() const
     {
-        return sizeof(double) * HOURS_PER_YEAR + NextType::memoryUsage();
+        return sizeof(MinMaxData::Data) * minmax.hourly.size() + NextType::memoryUsage();
+    }
+
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        for (auto* array: {&minmax.annual, &minmax.monthly, &minmax.weekly, &minmax.daily,
+                           &minmax.hourly})
+        {
+            if (OpInferior)
+            {
+                visitor.minimum(*array);
+            }
+            else
+            {
+                visitor.maximum(*array);
+            }
+        }
+        // Next
+        NextType::visitAccumulators(visitor);
     }
 
     template<template<class> class DecoratorT>
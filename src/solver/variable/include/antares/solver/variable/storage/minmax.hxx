@@ -36,6 +36,11 @@ namespace AllYears
 template<bool OpInferior, class NextT>
 inline void MinMaxBase<OpInferior, NextT>::initializeFromStudy(Data::Study& study)
 {
+    if (!study.runtime.hourlySynthesis)
+    {
+        // Nothing is merged into an empty array
+        std::vector<MinMaxData::Data>().swap(minmax.hourly);
+    }
     // Next
     NextType::initializeFromStudy(study);
 }
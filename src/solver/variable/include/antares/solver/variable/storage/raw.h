@@ -164,6 +164,14 @@ protected:
         return +sizeof(double) * HOURS_PER_YEAR + NextType::memoryUsage();
     }
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        rawdata.visitAccumulators(visitor);
+        // Next
+        NextType::visitAccumulators(visitor);
+    }
+
     template<template<class, int> class DecoratorT>
     Antares::Memory::Stored<double>::ConstReturnType hourlyValuesForSpatialAggregate() const
     {
@@ -55,10 +55,24 @@ public:
     void reset();
     void merge(unsigned int year, const IntermediateValues& rhs);
 
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        visitor.sum(monthly, MONTHS_PER_YEAR);
+        visitor.sum(weekly, WEEKS_PER_YEAR);
+        visitor.sum(daily, DAYS_PER_YEAR);
+        if (hourly)
+        {
+            visitor.sum(Memory::RawPointer(hourly), HOURS_PER_YEAR);
+        }
+        visitor.sum(year.data(), year.size());
+    }
+
 public:
     double monthly[MONTHS_PER_YEAR];
     double weekly[WEEKS_PER_YEAR];
     double daily[DAYS_PER_YEAR];
+    //! Null when no hourly synthesis is written (see StudyRuntimeInfos::hourlySynthesis)
     Antares::Memory::Stored<double>::Type hourly;
     std::vector<double> year;
     mutable double allYears;
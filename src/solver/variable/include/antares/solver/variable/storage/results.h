@@ -96,6 +96,18 @@ public:
         return DecoratorType::memoryUsage();
     }
 
+    /*!
+    ** \brief Give all the values accumulated over the MC years to a visitor
+    **
+    ** The visitor receives each array along with the way it has been accumulated
+    ** (`sum`, `minimum` or `maximum`), always in the same order.
+    */
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        DecoratorType::visitAccumulators(visitor);
+    }
+
     Antares::Memory::Stored<double>::ConstReturnType hourlyValuesForSpatialAggregate() const
     {
         return DecoratorType::template hourlyValuesForSpatialAggregate<
@@ -77,7 +77,10 @@ public:
 protected:
     void initializeFromStudy(Antares::Data::Study& study)
     {
-        Antares::Memory::Allocate<double>(stdDeviationHourly, HOURS_PER_YEAR);
+        if (study.runtime.hourlySynthesis)
+        {
+            Antares::Memory::Allocate<double>(stdDeviationHourly, HOURS_PER_YEAR);
+        }
         // Next
         NextType::initializeFromStudy(study);
 
@@ -91,7 +94,10 @@ protected:
         (void)::memset(stdDeviationMonthly, 0, sizeof(double) * MONTHS_PER_YEAR);
         (void)::memset(stdDeviationWeekly, 0, sizeof(double) * WEEKS_PER_YEAR);
         (void)::memset(stdDeviationDaily, 0, sizeof(double) * DAYS_PER_YEAR);
-        Antares::Memory::Zero(HOURS_PER_YEAR, stdDeviationHourly);
+        if (stdDeviationHourly)
+        {
+            Antares::Memory::Zero(HOURS_PER_YEAR, stdDeviationHourly);
+        }
         stdDeviationYear = 0.;
         // Next
         NextType::reset();
@@ -104,9 +110,12 @@ protected:
 
         unsigned int i;
         // StdDeviation value for each hour throughout all years
-        for (i = 0; i != HOURS_PER_YEAR; ++i)
+        if (stdDeviationHourly)
         {
-            stdDeviationHourly[i] += rhs.hour[i] * rhs.hour[i] * pRatio;
+            for (i = 0; i != HOURS_PER_YEAR; ++i)
+            {
+                stdDeviationHourly[i] += rhs.hour[i] * rhs.hour[i] * pRatio;
+            }
         }
         // StdDeviation value for each day throughout all years
         for (i = 0; i != DAYS_PER_YEAR; ++i)
@@ -181,7 +190,23 @@ protected:
 
     uint64_t memoryUsage() const
     {
-        return sizeof(double) * HOURS_PER_YEAR + NextType::memoryUsage();
+        return (stdDeviationHourly ? sizeof(double) * HOURS_PER_YEAR : 0)
+               + NextType::memoryUsage();
+    }
+
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor)
+    {
+        visitor.sum(stdDeviationMonthly, MONTHS_PER_YEAR);
+        visitor.sum(stdDeviationWeekly, WEEKS_PER_YEAR);
+        visitor.sum(stdDeviationDaily, DAYS_PER_YEAR);
+        if (stdDeviationHourly)
+        {
+            visitor.sum(Memory::RawPointer(stdDeviationHourly), HOURS_PER_YEAR);
+        }
+        visitor.sum(&stdDeviationYear, 1);
+        // Next
+        NextType::visitAccumulators(visitor);
     }
 
     template<template<class, int> class DecoratorT>
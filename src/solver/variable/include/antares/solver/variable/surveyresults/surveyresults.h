@@ -26,6 +26,7 @@
 
 #include <antares/study/study.h>
 #include <antares/study/variable-print-info.h>
+#include <antares/utils/number_format.h>
 #include <antares/writer/i_writer.h>
 #include "antares/antares/constants.h"
 
@@ -136,12 +137,11 @@ public:
     IResultWriter& pResultWriter;
 
 private:
-    template<class StringT, class ConvertT, class PrecisionT>
     void AppendDoubleValue(uint& error,
                            const double v,
-                           StringT& buffer,
-                           ConvertT& conversionBuffer,
-                           const PrecisionT& precision,
+                           Antares::Utils::NumberWriter<Yuni::Clob>& writer,
+                           int decimals,
+                           const PrecisionType& format,
                            const bool isNotApplicable);
 
     void writeDateToFileDescriptor(uint row, int precisionLevel);
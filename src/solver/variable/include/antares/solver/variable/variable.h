@@ -280,6 +280,14 @@ public:
     */
     uint64_t memoryUsage() const;
 
+    /*!
+    ** \brief Give the values accumulated over the MC years of the static list to a visitor
+    **
+    ** Used to save and merge the partial results of a sharded simulation.
+    */
+    template<class VisitorT>
+    void visitAccumulators(VisitorT& visitor);
+
     /*!
     ** \brief "Print" informations about the variable tree
     */
@@ -375,6 +375,15 @@ inline uint64_t IVariable<ChildT, NextT, VCardT>::memoryUsage() const
     return r;
 }
 
+template<class ChildT, class NextT, class VCardT>
+template<class VisitorT>
+inline void IVariable<ChildT, NextT, VCardT>::visitAccumulators(VisitorT& visitor)
+{
+    VariableAccessorType::VisitAccumulators(pResults, visitor);
+    // Next
+    NextType::visitAccumulators(visitor);
+}
+
 template<class ChildT, class NextT, class VCardT>
 template<class I>
 inline void IVariable<ChildT, NextT, VCardT>::provideInformations(I& infos)
@@ -21,9 +21,11 @@
 
 #include "antares/solver/variable/state.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <antares/study/study.h>
+#include "antares/solver/simulation/thermal_cluster_aggregation.h"
 
 namespace Antares::Solver::Variable
 {
@@ -101,14 +103,29 @@ void State::initFromThermalClusterIndex(const uint clusterAreaWideIndex)
 
         if (simulationMode != Data::SimulationMode::Adequacy) // Economy
         {
+            // The clusters may have been optimized as aggregated clusters
+            const auto* aggregation = problemeHebdo->thermalClusterAggregation.get();
+            const uint palier = aggregation ? aggregation->aggregateOf(area->index,
+                                                                       thermalCluster->index)
+                                            : thermalCluster->index;
             thermalClusterPMinOfAGroup = problemeHebdo->PaliersThermiquesDuPays[area->index]
-                                           .pminDUnGroupeDuPalierThermique
-                                             [thermalCluster->index]; // one by cluster
-            thermal[area->index].PMinOfClusters[clusterAreaWideIndex]
-              = problemeHebdo->PaliersThermiquesDuPays[area->index]
-                  .PuissanceDisponibleEtCout[thermalCluster->index]
-                  .PuissanceMinDuPalierThermique[hourInTheWeek]; // one per hour for one
-            // cluster
+                                           .pminDUnGroupeDuPalierThermique[palier]; // one by
+                                                                                    // cluster
+            if (aggregation)
+            {
+                // Minimum generation of the cluster itself, as if it had not been aggregated
+                thermal[area->index].PMinOfClusters[clusterAreaWideIndex] = std::min(
+                  thermalCluster->series.getCoefficient(this->year, hourInTheYear),
+                  thermalCluster->PthetaInf[hourInTheYear]);
+            }
+            else
+            {
+                thermal[area->index].PMinOfClusters[clusterAreaWideIndex]
+                  = problemeHebdo->PaliersThermiquesDuPays[area->index]
+                      .PuissanceDisponibleEtCout[palier]
+                      .PuissanceMinDuPalierThermique[hourInTheWeek]; // one per hour for one
+                // cluster
+            }
         }
         else
         {
@@ -430,13 +447,40 @@ std::array<uint, HOURS_PER_YEAR> State::computeEconomicallyOptimalNbClustersONfo
     uint startHourForCurrentYear = study.runtime.rangeLimits.hour[Data::rangeBegin];
     uint endHourForCurrentYear = startHourForCurrentYear
                                  + study.runtime.rangeLimits.hour[Data::rangeCount];
+    return computeEconomicallyOptimalNbClustersON(maxDurationON,
+                                                  ON_min,
+                                                  ON_max,
+                                                  startHourForCurrentYear,
+                                                  endHourForCurrentYear);
+}
 
+std::array<uint, HOURS_PER_YEAR> computeEconomicallyOptimalNbClustersON(
+  uint maxDurationON,
+  const std::array<uint, HOURS_PER_YEAR>& ON_min,
+  const std::array<uint, HOURS_PER_YEAR>& ON_max,
+  uint startHourForCurrentYear,
+  uint endHourForCurrentYear)
+{
     // Nombre de groupes économiquement optimal en fonctionnement à l'heure h
     std::array<uint, HOURS_PER_YEAR> ON_opt;
 
     uint nivmax; // valeur maximale de ON_opt[h] , progressivement réactualisée à la baisse
     uint nivmin; // valeur minimale de ON_opt[h] , progressivement réactualisée à la hausse
 
+    // Min of ON_max and max of ON_min by blocks of hours, so that the look-ahead can skip
+    // whole blocks where nothing can happen instead of scanning up to maxDurationON hours
+    constexpr uint blockSize = 64;
+    constexpr uint blockCount = (HOURS_PER_YEAR + blockSize - 1) / blockSize;
+    std::array<uint, blockCount> blockMinOfONmax;
+    std::array<uint, blockCount> blockMaxOfONmin;
+    for (uint b = startHourForCurrentYear / blockSize; b * blockSize < endHourForCurrentYear; ++b)
+    {
+        uint first = std::max(b * blockSize, startHourForCurrentYear);
+        uint last = std::min((b + 1) * blockSize, endHourForCurrentYear);
+        blockMinOfONmax[b] = *std::min_element(ON_max.begin() + first, ON_max.begin() + last);
+        blockMaxOfONmin[b] = *std::max_element(ON_min.begin() + first, ON_min.begin() + last);
+    }
+
     ON_opt[startHourForCurrentYear] = ON_min[startHourForCurrentYear];
 
     uint h = startHourForCurrentYear + 1;
@@ -464,6 +508,19 @@ std::array<uint, HOURS_PER_YEAR> State::computeEconomicallyOptimalNbClustersONfo
                     {
                         break; // fin de l'année dépassée
                     }
+                    // Skip a whole block if none of its hours can lower nivmax, raise nivmin or
+                    // extend portee
+                    if ((h + k) % blockSize == 0 && k + blockSize - 1 <= maxDurationON
+                        && h + k + blockSize <= endHourForCurrentYear)
+                    {
+                        uint b = (h + k) / blockSize;
+                        if (blockMinOfONmax[b] >= nivmax
+                            && blockMaxOfONmin[b] < std::max(nivmin, ON_min[h] + 1))
+                        {
+                            k += blockSize - 1;
+                            continue;
+                        }
+                    }
                     if (ON_max[h + k] <= ON_min[h])
                     {
                         nivmax = ON_min[h];
@@ -43,7 +43,10 @@ AverageData::~AverageData()
 
 void AverageData::reset()
 {
-    Antares::Memory::Zero(HOURS_PER_YEAR, hourly);
+    if (hourly)
+    {
+        Antares::Memory::Zero(HOURS_PER_YEAR, hourly);
+    }
     (void)::memset(monthly, 0, sizeof(double) * MONTHS_PER_YEAR);
     (void)::memset(weekly, 0, sizeof(double) * WEEKS_PER_YEAR);
     (void)::memset(daily, 0, sizeof(double) * DAYS_PER_YEAR);
@@ -52,7 +55,10 @@ void AverageData::reset()
 
 void AverageData::initializeFromStudy(Data::Study& study)
 {
-    Antares::Memory::Allocate<double>(hourly, HOURS_PER_YEAR);
+    if (study.runtime.hourlySynthesis)
+    {
+        Antares::Memory::Allocate<double>(hourly, HOURS_PER_YEAR);
+    }
     nbYearsCapacity = study.runtime.rangeLimits.year[Data::rangeEnd] + 1;
     year.resize(nbYearsCapacity);
 
@@ -60,6 +66,15 @@ void AverageData::initializeFromStudy(Data::Study& study)
     yearsWeightSum = study.parameters.getYearsWeightSum();
 }
 
+void AverageData::allocateHourly()
+{
+    if (!hourly)
+    {
+        Antares::Memory::Allocate<double>(hourly, HOURS_PER_YEAR);
+        Antares::Memory::Zero(HOURS_PER_YEAR, hourly);
+    }
+}
+
 void AverageData::merge(unsigned int y, const IntermediateValues& rhs)
 {
     unsigned int i;
@@ -68,9 +83,12 @@ void AverageData::merge(unsigned int y, const IntermediateValues& rhs)
     double ratio = (double)yearsWeight[y] / (double)yearsWeightSum;
 
     // Average value for each hour throughout all years
-    for (i = 0; i != HOURS_PER_YEAR; ++i)
+    if (hourly)
     {
-        hourly[i] += rhs.hour[i] * ratio;
+        for (i = 0; i != HOURS_PER_YEAR; ++i)
+        {
+            hourly[i] += rhs.hour[i] * ratio;
+        }
     }
     // Average value for each day throughout all years
     for (i = 0; i != DAYS_PER_YEAR; ++i)
@@ -25,11 +25,49 @@
 #include <yuni/core/math.h>
 
 #include <antares/study/study.h>
+#include "antares/solver/variable/storage/aggregation.h"
 
 using namespace Yuni;
 
 namespace Antares::Solver::Variable
 {
+namespace
+{
+inline uint nbDaysOfTheRange(const Data::StudyRangeLimits& range)
+{
+    return range.day[Data::rangeEnd] - range.day[Data::rangeBegin] + 1;
+}
+
+// The days of the range are made of consecutive hours, starting from the first hour of the range
+inline const double* firstHourOfTheRange(const double* hour, const Data::StudyRangeLimits& range)
+{
+    assert(range.hour[Data::rangeBegin] + HOURS_PER_DAY * nbDaysOfTheRange(range)
+           <= HOURS_PER_YEAR);
+    return hour + range.hour[Data::rangeBegin];
+}
+
+// Calls f(week, firstDay, endDay) for each week of the range, restricted to the days of the range.
+// The days of a week are consecutive.
+template<class F>
+inline void forEachWeekOfTheRange(const Date::Calendar& calendar,
+                                  const Data::StudyRangeLimits& range,
+                                  F&& f)
+{
+    const uint end = range.day[Data::rangeEnd] + 1;
+    for (uint first = range.day[Data::rangeBegin]; first != end;)
+    {
+        uint week = calendar.days[first].week;
+        uint last = first + 1;
+        while (last != end && calendar.days[last].week == week)
+        {
+            ++last;
+        }
+        f(week, first, last);
+        first = last;
+    }
+}
+} // namespace
+
 IntermediateValues::IntermediateValues():
     pRange(nullptr),
     calendar(nullptr),
@@ -70,7 +108,6 @@ void IntermediateValues::computeStatisticsAdequacyForTheCurrentYear()
 void IntermediateValues::computeStatisticsForTheCurrentYear()
 {
     uint i;
-    uint j;
 
     year = 0.;
 
@@ -81,20 +118,12 @@ void IntermediateValues::computeStatisticsForTheCurrentYear()
 
     // x(d)
     // For each day in the year
-    uint indx = pRange->hour[Data::rangeBegin];
-
+    Aggregation::sumPerBlock<HOURS_PER_DAY>(firstHourOfTheRange(hour, *pRange),
+                                            nbDaysOfTheRange(*pRange),
+                                            day + pRange->day[Data::rangeBegin]);
     for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
     {
-        double d = 0.;
-        // One day
-        for (j = 0; j != HOURS_PER_DAY; ++j)
-        {
-            assert(indx < HOURS_PER_YEAR);
-            d += hour[indx];
-            ++indx;
-        }
-        day[i] = d;
-        year += d;
+        year += day[i];
     }
 
     // weeks
@@ -102,31 +131,25 @@ void IntermediateValues::computeStatisticsForTheCurrentYear()
     {
         week[i] = 0.;
     }
-    for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
-    {
-        week[calendar->days[i].week] += day[i];
-    }
+    forEachWeekOfTheRange(*calendar,
+                          *pRange,
+                          [this](uint w, uint first, uint end)
+                          { week[w] = Aggregation::sumOfRange(day, first, end); });
 
     // x(m)
-    indx = calendar->months[pRange->month[Data::rangeBegin]].daysYear.first;
+    uint indx = calendar->months[pRange->month[Data::rangeBegin]].daysYear.first;
     for (i = pRange->month[Data::rangeBegin]; i <= pRange->month[Data::rangeEnd]; ++i)
     {
-        double d = 0.;
         uint daysInMonth = calendar->months[i].days;
-        for (j = 0; j != daysInMonth; ++j)
-        {
-            assert(indx < 7 * 53 + 1);
-            d += day[indx];
-            ++indx;
-        }
-        month[i] = d;
+        assert(indx + daysInMonth <= 7 * 53 + 1);
+        month[i] = Aggregation::sumOfRange(day, indx, indx + daysInMonth);
+        indx += daysInMonth;
     }
 }
 
 void IntermediateValues::computeStatisticsOrForTheCurrentYear()
 {
     uint i;
-    uint j;
 
     year = 0.;
 
@@ -136,51 +159,36 @@ void IntermediateValues::computeStatisticsOrForTheCurrentYear()
 
     // x(d)
     // For each day in the year
-    uint indx = pRange->hour[Data::rangeBegin];
-
-    for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
-    {
-        day[i] = 0.;
-        // One day
-        for (j = 0; j != HOURS_PER_DAY; ++j)
-        {
-            assert(indx < HOURS_PER_YEAR);
-            if (hour[indx] > 0.)
-            {
-                day[i] = 100.;
-            }
-            ++indx;
-        }
-    }
+    Aggregation::anyPositivePerBlock<HOURS_PER_DAY>(firstHourOfTheRange(hour, *pRange),
+                                                    nbDaysOfTheRange(*pRange),
+                                                    100.,
+                                                    day + pRange->day[Data::rangeBegin]);
 
     // weeks
     for (i = 0; i != WEEKS_PER_YEAR; ++i)
     {
         week[i] = 0.;
     }
-    for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
-    {
-        if (day[i] > 0)
-        {
-            week[calendar->days[i].week] = 100.;
-        }
-    }
+    forEachWeekOfTheRange(*calendar,
+                          *pRange,
+                          [this](uint w, uint first, uint end)
+                          {
+                              bool any = Aggregation::anyPositiveInRange(day, first, end);
+                              week[w] = any ? 100. : 0.;
+                          });
 
     // x(m)
-    indx = calendar->months[pRange->month[Data::rangeBegin]].daysYear.first;
+    uint indx = calendar->months[pRange->month[Data::rangeBegin]].daysYear.first;
     for (i = pRange->month[Data::rangeBegin]; i <= pRange->month[Data::rangeEnd]; ++i)
     {
         uint daysInMonth = calendar->months[i].days;
-        for (j = 0; j != daysInMonth; ++j)
+        assert(indx + daysInMonth <= 7 * 53);
+        if (Aggregation::anyPositiveInRange(day, indx, indx + daysInMonth))
         {
-            assert(indx < 7 * 53);
-            if (day[indx] > 0.)
-            {
-                month[i] = 100;
-                year = 100.;
-            }
-            ++indx;
+            month[i] = 100;
+            year = 100.;
         }
+        indx += daysInMonth;
     }
 }
 
@@ -213,19 +221,13 @@ void IntermediateValues::computeAveragesForCurrentYearFromWeeklyResults()
 
 void IntermediateValues::computeDailyAveragesForCurrentYear()
 {
-    // Compute days average for each day of the year
-    double day_sum;
-    uint indx = pRange->hour[Data::rangeBegin];
+    // Compute days average for each day of the year, from the sums of the hourly values
+    Aggregation::sumPerBlock<HOURS_PER_DAY>(firstHourOfTheRange(hour, *pRange),
+                                            nbDaysOfTheRange(*pRange),
+                                            day + pRange->day[Data::rangeBegin]);
     for (uint d = pRange->day[Data::rangeBegin]; d <= pRange->day[Data::rangeEnd]; ++d)
     {
-        // Compute sum of hourly values on the current day of year
-        day_sum = 0.;
-        for (uint h = 0; h != HOURS_PER_DAY; ++h)
-        {
-            day_sum += hour[indx];
-            ++indx;
-        }
-        day[d] = day_sum / HOURS_PER_DAY;
+        day[d] /= HOURS_PER_DAY;
     }
 }
 
@@ -238,10 +240,10 @@ void IntermediateValues::computeWeeklyAveragesForCurrentYear()
     }
 
     // Compute weekly averages for each week in the year
-    for (uint d = pRange->day[Data::rangeBegin]; d <= pRange->day[Data::rangeEnd]; ++d)
-    {
-        week[calendar->days[d].week] += day[d];
-    }
+    forEachWeekOfTheRange(*calendar,
+                          *pRange,
+                          [this](uint w, uint first, uint end)
+                          { week[w] = Aggregation::sumOfRange(day, first, end); });
     for (uint w = pRange->week[Data::rangeBegin]; w <= pRange->week[Data::rangeEnd]; ++w)
     {
         week[w] /= pRuntimeInfo->simulationDaysPerWeek[w];
@@ -254,19 +256,14 @@ void IntermediateValues::computeMonthlyAveragesForCurrentYear()
     //    We need daily values in order to compute monthly averages.
     //    Indeed, weekly values would be suitable for this : there are not necessarily an
     //    integer number of weeks in a month.
-    double month_sum;
     uint indx = calendar->months[pRange->month[Data::rangeBegin]].daysYear.first;
     for (uint m = pRange->month[Data::rangeBegin]; m <= pRange->month[Data::rangeEnd]; ++m)
     {
-        month_sum = 0.;
         uint daysInMonth = calendar->months[m].days;
-        for (uint d = 0; d != daysInMonth; ++d)
-        {
-            assert(indx < 7 * 53 + 1);
-            month_sum += day[indx];
-            ++indx;
-        }
-        month[m] = month_sum / pRuntimeInfo->simulationDaysPerMonth[m];
+        assert(indx + daysInMonth <= 7 * 53 + 1);
+        month[m] = Aggregation::sumOfRange(day, indx, indx + daysInMonth)
+                   / pRuntimeInfo->simulationDaysPerMonth[m];
+        indx += daysInMonth;
     }
 }
 
@@ -285,8 +282,6 @@ void IntermediateValues::computeYearlyAveragesForCurrentYear()
 void IntermediateValues::computeProbabilitiesForTheCurrentYear()
 {
     uint i;
-    uint j;
-    double d;
 
     // Detecting large buffer overflow
     assert(pRange);
@@ -298,21 +293,10 @@ void IntermediateValues::computeProbabilitiesForTheCurrentYear()
 
     // x(d)
     // For each day in the year
-    uint indx = pRange->hour[Data::rangeBegin];
-    for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
-    {
-        d = 0.;
-        // One day
-        for (j = 0; j != HOURS_PER_DAY; ++j)
-        {
-            if (hour[indx] > 0.)
-            {
-                d = ratio;
-            }
-            ++indx;
-        }
-        day[i] = d;
-    }
+    Aggregation::anyPositivePerBlock<HOURS_PER_DAY>(firstHourOfTheRange(hour, *pRange),
+                                                    nbDaysOfTheRange(*pRange),
+                                                    ratio,
+                                                    day + pRange->day[Data::rangeBegin]);
 
     for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
     {
@@ -328,31 +312,22 @@ void IntermediateValues::computeProbabilitiesForTheCurrentYear()
     {
         week[i] = 0.;
     }
-    for (i = pRange->day[Data::rangeBegin]; i <= pRange->day[Data::rangeEnd]; ++i)
-    {
-        if (day[i] > 0.)
-        {
-            uint weekindex = calendar->days[i].week;
-            week[weekindex] = ratio; //+= ratio / calendar->weeks[weekindex].days;
-        }
-    }
+    forEachWeekOfTheRange(*calendar,
+                          *pRange,
+                          [this, ratio](uint w, uint first, uint end)
+                          {
+                              bool any = Aggregation::anyPositiveInRange(day, first, end);
+                              week[w] = any ? ratio : 0.;
+                          });
 
     // x(m)
-    indx = calendar->months[pRange->month[Data::rangeBegin]].daysYear.first;
+    uint indx = calendar->months[pRange->month[Data::rangeBegin]].daysYear.first;
     for (i = pRange->month[Data::rangeBegin]; i <= pRange->month[Data::rangeEnd]; ++i)
     {
-        d = 0.;
         uint daysInMonth = calendar->months[i].days;
-        for (j = 0; j != daysInMonth; ++j)
-        {
-            assert(indx < 7 * 53 + 1);
-            if (day[indx] > 0.)
-            {
-                d = ratio;
-            }
-            ++indx;
-        }
-        month[i] = d;
+        assert(indx + daysInMonth <= 7 * 53 + 1);
+        month[i] = Aggregation::anyPositiveInRange(day, indx, indx + daysInMonth) ? ratio : 0.;
+        indx += daysInMonth;
     }
 }
 
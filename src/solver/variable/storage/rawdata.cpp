@@ -40,7 +40,10 @@ RawData::~RawData()
 
 void RawData::initializeFromStudy(const Data::Study& study)
 {
-    Antares::Memory::Allocate<double>(hourly, HOURS_PER_YEAR);
+    if (study.runtime.hourlySynthesis)
+    {
+        Antares::Memory::Allocate<double>(hourly, HOURS_PER_YEAR);
+    }
     nbYearsCapacity = study.runtime.rangeLimits.year[Data::rangeEnd] + 1;
     year.resize(nbYearsCapacity);
 }
@@ -48,7 +51,10 @@ void RawData::initializeFromStudy(const Data::Study& study)
 void RawData::reset()
 {
     // Reset
-    Antares::Memory::Zero(HOURS_PER_YEAR, hourly);
+    if (hourly)
+    {
+        Antares::Memory::Zero(HOURS_PER_YEAR, hourly);
+    }
     (void)::memset(monthly, 0, sizeof(double) * MONTHS_PER_YEAR);
     (void)::memset(weekly, 0, sizeof(double) * WEEKS_PER_YEAR);
     (void)::memset(daily, 0, sizeof(double) * DAYS_PER_YEAR);
@@ -59,9 +65,12 @@ void RawData::merge(unsigned int y, const IntermediateValues& rhs)
 {
     unsigned int i;
     // StdDeviation value for each hour throughout all years
-    for (i = 0; i != HOURS_PER_YEAR; ++i)
+    if (hourly)
     {
-        hourly[i] += rhs.hour[i];
+        for (i = 0; i != HOURS_PER_YEAR; ++i)
+        {
+            hourly[i] += rhs.hour[i];
+        }
     }
     // StdDeviation value for each day throughout all years
     for (i = 0; i != DAYS_PER_YEAR; ++i)
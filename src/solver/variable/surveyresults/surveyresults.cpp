@@ -23,12 +23,16 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <vector>
 
 #include <yuni/yuni.h>
 
 #include <antares/logs/logs.h>
 #include <antares/solver/variable/print.h>
 #include <antares/study/study.h>
+#include <antares/utils/number_format.h>
 #include <antares/utils/utils.h>
 
 using namespace Yuni;
@@ -38,6 +42,17 @@ using namespace Antares;
 
 namespace Antares::Solver::Variable::Private
 {
+/*!
+** \brief Write `v` with a printf format, for the formats Utils::formatFixed() can not replace
+**
+** \return The end of the written text, nullptr if [first, last) is too small
+*/
+static char* formatWithPrintf(char* first, char* last, const char* format, double v)
+{
+    const int size = std::snprintf(first, static_cast<std::size_t>(last - first), format, v);
+    return (size >= 0 && size < last - first) ? first + size : nullptr;
+}
+
 void InternalExportDigestLinksMatrix(const Data::Study& study,
                                      const char* title,
                                      std::string& buffer,
@@ -52,9 +67,8 @@ void InternalExportDigestLinksMatrix(const Data::Study& study,
     }
     buffer.append("\n");
 
-    char conversionBuffer[256];
+    char conversionBuffer[Utils::numberBufferSize];
     conversionBuffer[0] = '\t';
-    int sizePrintf;
 
     uint count = study.areas.size();
     buffer.reserve(10 + count * (1 /*tab*/ + 7));
@@ -84,22 +98,13 @@ void InternalExportDigestLinksMatrix(const Data::Study& study,
                     }
                     else
                     {
-// The snprintf routine is required since we may not have the ending zero
-// with the standard printf. The conversion may require a bigger buffer.
-#ifdef YUNI_OS_MSVC
-                        sizePrintf = ::sprintf_s(conversionBuffer + 1,
-                                                 sizeof(conversionBuffer) - 2,
-                                                 "%.0f",
-                                                 v);
-#else
-                        sizePrintf = ::snprintf(conversionBuffer + 1,
-                                                sizeof(conversionBuffer) - 2,
-                                                "%.0f",
-                                                v);
-#endif
-                        if (sizePrintf >= 0)
+                        const char* end = Utils::formatFixed(conversionBuffer + 1,
+                                                             std::end(conversionBuffer),
+                                                             v,
+                                                             0);
+                        if (end)
                         {
-                            buffer.append((const char*)conversionBuffer);
+                            buffer.append(conversionBuffer, end - conversionBuffer);
                         }
                         else
                         {
@@ -337,17 +342,16 @@ inline void SurveyResults::writeDateToFileDescriptor(uint row, int precisionLeve
     }
 }
 
-template<class StringT, class ConvertT, class PrecisionT>
 inline void SurveyResults::AppendDoubleValue(uint& error,
                                              double v,
-                                             StringT& buffer,
-                                             ConvertT& conversionBuffer,
-                                             const PrecisionT& precision,
+                                             Utils::NumberWriter<Clob>& writer,
+                                             int decimals,
+                                             const PrecisionType& format,
                                              const bool isNotApplicable)
 {
     if (isNotApplicable)
     {
-        buffer.append("\tN/A", 4);
+        writer.put("\tN/A", 4);
         return;
     }
 
@@ -355,7 +359,7 @@ inline void SurveyResults::AppendDoubleValue(uint& error,
     {
         if (std::isnan(v))
         {
-            buffer.append("\tNaN", 4);
+            writer.put("\tNaN", 4);
             // We should disabled errors on NaN if the quadratic optimization has failed
             if (++error == 1 && !data.study.runtime.quadraticOptimizationHasFailed)
             {
@@ -366,7 +370,7 @@ inline void SurveyResults::AppendDoubleValue(uint& error,
         {
             if (std::isinf(v))
             {
-                buffer.append((v > 0) ? "\t+inf" : "\t-inf", 5);
+                writer.put((v > 0) ? "\t+inf" : "\t-inf", 5);
                 if (++error == 1)
                 {
                     logs.error() << "'infinite' value detected";
@@ -374,34 +378,33 @@ inline void SurveyResults::AppendDoubleValue(uint& error,
             }
             else
             {
-#ifdef YUNI_OS_MSVC
-                int sizePrintf = ::sprintf_s(conversionBuffer + 1,
-                                             sizeof(conversionBuffer) - 2,
-                                             precision.c_str(),
-                                             v);
-#else
-                int sizePrintf = ::snprintf(conversionBuffer + 1,
-                                            sizeof(conversionBuffer) - 2,
-                                            precision.c_str(),
-                                            v);
-#endif
-
-                if (sizePrintf >= 0)
+                writer.put('\t');
+                if (decimals >= 0)
                 {
-                    // +1 is related to the tab character already present in the
-                    // conversion buffer
-                    buffer.append((const char*)conversionBuffer, 1 + sizePrintf);
+                    writer.fixed(v, static_cast<uint>(decimals));
                 }
                 else
                 {
-                    buffer += "\tERR";
+                    char text[Utils::numberBufferSize];
+                    const char* end = Private::formatWithPrintf(text,
+                                                                std::end(text),
+                                                                format.c_str(),
+                                                                v);
+                    if (end)
+                    {
+                        writer.put(text, static_cast<std::size_t>(end - text));
+                    }
+                    else
+                    {
+                        writer.put("ERR", 3);
+                    }
                 }
             }
         }
     }
     else
     {
-        buffer.append("\t0", 2);
+        writer.put("\t0", 2);
     }
 }
 
@@ -626,9 +629,15 @@ void SurveyResults::exportDigestAllYears(std::string& buffer)
         buffer.append("\n");
     }
 
-    char conversionBuffer[128];
+    // Number of decimals of each column, -1 if its format goes through printf
+    std::vector<int> decimals(data.columnIndex);
+    for (uint i = 0; i != data.columnIndex; ++i)
+    {
+        decimals[i] = Utils::precisionOfPrintfFormat(precision[i].c_str());
+    }
+
+    char conversionBuffer[Utils::numberBufferSize];
     conversionBuffer[0] = '\t';
-    int sizePrintf;
 
     auto end = data.rowCaptions.end();
     uint y = 0;
@@ -657,22 +666,18 @@ void SurveyResults::exportDigestAllYears(std::string& buffer)
             }
             else
             {
-// The snprintf routine is required since we may not have the ending zero
-// with the standard printf. The conversion may require a bigger buffer.
-#ifdef YUNI_OS_MSVC
-                sizePrintf = ::sprintf_s(conversionBuffer + 1,
-                                         sizeof(conversionBuffer) - 2,
-                                         precision[i].c_str(),
-                                         values[i][y]);
-#else
-                sizePrintf = ::snprintf(conversionBuffer + 1,
-                                        sizeof(conversionBuffer) - 2,
-                                        precision[i].c_str(),
-                                        values[i][y]);
-#endif
-                if (sizePrintf >= 0)
+                const char* end = decimals[i] >= 0
+                                    ? Utils::formatFixed(conversionBuffer + 1,
+                                                         std::end(conversionBuffer),
+                                                         values[i][y],
+                                                         static_cast<uint>(decimals[i]))
+                                    : Private::formatWithPrintf(conversionBuffer + 1,
+                                                                std::end(conversionBuffer),
+                                                                precision[i].c_str(),
+                                                                values[i][y]);
+                if (end)
                 {
-                    buffer.append((const char*)conversionBuffer);
+                    buffer.append(conversionBuffer, end - conversionBuffer);
                 }
                 else
                 {
@@ -772,17 +777,15 @@ void SurveyResults::saveToFile(int dataLevel, int fileLevel, int precisionLevel)
                                             data.columnIndex);
     }
 
-    char conversionBuffer[256];
-    conversionBuffer[0] = '\t';
     uint error = 0;
 
-#ifndef NDEBUG
-    // A few preliminary checks
+    // Number of decimals of each column, -1 if its format goes through printf
+    std::vector<int> decimals(data.columnIndex);
     for (uint x = 0; x != data.columnIndex; ++x)
     {
         assert(not precision[x].empty() && "invalid precision");
+        decimals[x] = Utils::precisionOfPrintfFormat(precision[x].c_str());
     }
-#endif
 
     // Each row
     for (uint y = heightBegin; y < heightEnd; ++y)
@@ -795,18 +798,19 @@ void SurveyResults::saveToFile(int dataLevel, int fileLevel, int precisionLevel)
         // Each column
         assert(data.columnIndex <= maxVariables);
 
+        Utils::NumberWriter<Clob> writer(data.fileBuffer);
         for (uint x = 0; x != data.columnIndex; ++x)
         {
             AppendDoubleValue(error,
                               values[x][y],
-                              data.fileBuffer,
-                              conversionBuffer,
+                              writer,
+                              decimals[x],
                               precision[x],
                               nonApplicableStatus[x]);
         }
 
         // End of line
-        data.fileBuffer += '\n';
+        writer.put('\n');
     }
 
     // mc-ind & mc-all
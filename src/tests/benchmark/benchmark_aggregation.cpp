@@ -0,0 +1,102 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <antares/antares/constants.h>
+#include <antares/solver/variable/storage/aggregation.h>
+
+using namespace Antares::Solver::Variable;
+
+namespace
+{
+std::vector<double> hourlyValues()
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> distribution(-1000., 1000.);
+    std::vector<double> values(HOURS_PER_YEAR);
+    for (auto& value: values)
+    {
+        value = distribution(random);
+    }
+    return values;
+}
+} // namespace
+
+// Reference: the daily sums as computed before the aggregation kernels
+static void BM_DailySums_PlainLoop(benchmark::State& state)
+{
+    const auto hours = hourlyValues();
+    std::vector<double> days(DAYS_PER_YEAR);
+    for (auto _: state)
+    {
+        for (uint d = 0; d != DAYS_PER_YEAR; ++d)
+        {
+            double sum = 0.;
+            for (uint h = 0; h != HOURS_PER_DAY; ++h)
+            {
+                sum += hours[d * HOURS_PER_DAY + h];
+            }
+            days[d] = sum;
+        }
+        benchmark::DoNotOptimize(days.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * HOURS_PER_YEAR);
+}
+
+BENCHMARK(BM_DailySums_PlainLoop);
+
+static void BM_DailySums_Aggregation(benchmark::State& state)
+{
+    const auto hours = hourlyValues();
+    std::vector<double> days(DAYS_PER_YEAR);
+    for (auto _: state)
+    {
+        Aggregation::sumPerBlock<HOURS_PER_DAY>(hours.data(), DAYS_PER_YEAR, days.data());
+        benchmark::DoNotOptimize(days.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * HOURS_PER_YEAR);
+}
+
+BENCHMARK(BM_DailySums_Aggregation);
+
+static void BM_DailyAnyPositive_Aggregation(benchmark::State& state)
+{
+    const auto hours = hourlyValues();
+    std::vector<double> days(DAYS_PER_YEAR);
+    for (auto _: state)
+    {
+        Aggregation::anyPositivePerBlock<HOURS_PER_DAY>(hours.data(),
+                                                        DAYS_PER_YEAR,
+                                                        100.,
+                                                        days.data());
+        benchmark::DoNotOptimize(days.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * HOURS_PER_YEAR);
+}
+
+BENCHMARK(BM_DailyAnyPositive_Aggregation);
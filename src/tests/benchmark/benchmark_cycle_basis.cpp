@@ -0,0 +1,129 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <antares/logs/logs.h>
+#include <antares/solver/constraints-builder/cbuilder.h>
+
+using namespace Antares::Graph;
+
+namespace
+{
+struct Area
+{
+};
+
+struct Line
+{
+    uint origin;
+    uint destination;
+    long weight;
+};
+
+// A random spanning tree of `nodeCount` nodes, then random chords up to 1.6 lines per node
+std::vector<Line> randomMesh(uint nodeCount)
+{
+    std::mt19937 random(42);
+    std::uniform_int_distribution<long> weights(1, 4);
+    std::set<std::pair<uint, uint>> known;
+    std::vector<Line> lines;
+    for (uint n = 1; n != nodeCount; ++n)
+    {
+        uint parent = std::uniform_int_distribution<uint>(0, n - 1)(random);
+        known.insert({parent, n});
+        lines.push_back({parent, n, weights(random)});
+    }
+    std::uniform_int_distribution<uint> nodes(0, nodeCount - 1);
+    while (lines.size() < nodeCount * 8 / 5)
+    {
+        uint a = nodes(random);
+        uint b = nodes(random);
+        if (a != b && known.insert(std::minmax(a, b)).second)
+        {
+            lines.push_back({a, b, weights(random)});
+        }
+    }
+    return lines;
+}
+
+void fillGrid(Grid<Area>& grid, std::vector<Area>& areas, const std::vector<Line>& lines)
+{
+    for (uint n = 0; n != areas.size(); ++n)
+    {
+        grid.addNode(areas[n], "n" + std::to_string(n));
+    }
+    for (auto& line: lines)
+    {
+        grid.addEdge(grid.findNodeFromName("n" + std::to_string(line.origin)),
+                     grid.findNodeFromName("n" + std::to_string(line.destination)),
+                     line.weight);
+    }
+}
+} // namespace
+
+static void BM_Grid_BuildMesh(benchmark::State& state)
+{
+    logs.verbosityLevel = Yuni::Logs::Verbosity::Warning::level;
+    std::vector<Area> areas(state.range(0));
+    const auto lines = randomMesh(state.range(0));
+    for (auto _: state)
+    {
+        Grid<Area> grid;
+        fillGrid(grid, areas, lines);
+        grid.buildMesh();
+        benchmark::DoNotOptimize(grid.getMeshIndexMatrix().size());
+    }
+}
+
+BENCHMARK(BM_Grid_BuildMesh)->Arg(50)->Arg(200)->Unit(benchmark::kMillisecond);
+
+// The weight of a line crossed by the first loop has changed since the previous mesh
+static void BM_Grid_BuildMesh_OneLineChanged(benchmark::State& state)
+{
+    logs.verbosityLevel = Yuni::Logs::Verbosity::Warning::level;
+    std::vector<Area> areas(state.range(0));
+    auto lines = randomMesh(state.range(0));
+    std::vector<std::vector<EdgeDefinition>> previousMesh;
+    {
+        Grid<Area> grid;
+        fillGrid(grid, areas, lines);
+        grid.buildMesh();
+        previousMesh = grid.getMeshDefinition();
+        lines[grid.getMeshIndexMatrix().front().front()].weight += 1;
+    }
+
+    for (auto _: state)
+    {
+        Grid<Area> grid;
+        fillGrid(grid, areas, lines);
+        grid.buildMesh(nullptr, previousMesh);
+        benchmark::DoNotOptimize(grid.getMeshIndexMatrix().size());
+    }
+}
+
+BENCHMARK(BM_Grid_BuildMesh_OneLineChanged)->Arg(50)->Arg(200)->Unit(benchmark::kMillisecond);
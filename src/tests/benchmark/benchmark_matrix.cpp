@@ -0,0 +1,90 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#include <filesystem>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <antares/array/matrix.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+// A matrix of `width` hourly time-series, with random values written with 6 decimals
+Matrix<> randomTimeSeries(uint width)
+{
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> distribution(0., 10000.);
+    Matrix<> matrix(width, HOURS_PER_YEAR);
+    for (uint x = 0; x != width; ++x)
+    {
+        for (uint y = 0; y != HOURS_PER_YEAR; ++y)
+        {
+            matrix[x][y] = distribution(random);
+        }
+    }
+    return matrix;
+}
+
+fs::path temporaryFile()
+{
+    return fs::temp_directory_path() / "antares-benchmark-matrix.txt";
+}
+} // namespace
+
+static void BM_Matrix_SaveToCSVFile(benchmark::State& state)
+{
+    const auto matrix = randomTimeSeries(state.range(0));
+    const auto path = temporaryFile();
+    for (auto _: state)
+    {
+        if (!matrix.saveToCSVFile(path.string()))
+        {
+            state.SkipWithError("Impossible to write the matrix");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * fs::file_size(path));
+    fs::remove(path);
+}
+
+BENCHMARK(BM_Matrix_SaveToCSVFile)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+static void BM_Matrix_LoadFromCSVFile(benchmark::State& state)
+{
+    const auto path = temporaryFile();
+    randomTimeSeries(state.range(0)).saveToCSVFile(path.string());
+    Matrix<> matrix;
+    for (auto _: state)
+    {
+        if (!matrix.loadFromCSVFile(path.string(), 1, HOURS_PER_YEAR))
+        {
+            state.SkipWithError("Impossible to read the matrix");
+            break;
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * fs::file_size(path));
+    fs::remove(path);
+}
+
+BENCHMARK(BM_Matrix_LoadFromCSVFile)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
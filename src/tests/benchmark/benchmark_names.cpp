@@ -0,0 +1,103 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define WIN32_LEAN_AND_MEAN
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "antares/solver/optimisation/opt_rename_problem.h"
+
+namespace
+{
+// A weekly problem of `nbAreas` areas having a thermal cluster each, as described by the
+// construction of its variables
+struct DescribedProblem
+{
+    explicit DescribedProblem(unsigned int nbAreas)
+    {
+        for (unsigned int i = 0; i != nbAreas; ++i)
+        {
+            areas.push_back("area " + std::to_string(i));
+            clusters.push_back("cluster " + std::to_string(i));
+        }
+        const auto nbVariables = nbAreas * variablesPerAreaAndHour * 168;
+        problem.NombreDeVariables = nbVariables;
+        problem.DescriptionDesVariables.resize(nbVariables);
+        problem.NomDesVariables.resize(nbVariables);
+        problem.NombreDeContraintes = 0;
+    }
+
+    void describe()
+    {
+        VariableNamer namer(problem.DescriptionDesVariables);
+        unsigned int variable = 0;
+        for (unsigned int hour = 0; hour != 168; ++hour)
+        {
+            namer.UpdateTimeStep(hour);
+            for (unsigned int i = 0; i != areas.size(); ++i)
+            {
+                namer.UpdateArea(areas[i].c_str());
+                namer.DispatchableProduction(variable++, clusters[i]);
+                namer.NODU(variable++, clusters[i]);
+                namer.PositiveUnsuppliedEnergy(variable++);
+                namer.NegativeUnsuppliedEnergy(variable++);
+            }
+        }
+    }
+
+    static constexpr unsigned int variablesPerAreaAndHour = 4;
+
+    std::vector<std::string> areas;
+    std::vector<std::string> clusters;
+    PROBLEME_ANTARES_A_RESOUDRE problem;
+};
+} // namespace
+
+// What the construction of the problem pays for each week
+static void BM_ElementNames_Describe(benchmark::State& state)
+{
+    DescribedProblem described(state.range(0));
+    for (auto _: state)
+    {
+        described.describe();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * described.problem.NombreDeVariables);
+}
+
+BENCHMARK(BM_ElementNames_Describe)->Arg(10)->Arg(100);
+
+// What is paid on top of it when the names are needed
+static void BM_ElementNames_Build(benchmark::State& state)
+{
+    DescribedProblem described(state.range(0));
+    described.describe();
+    for (auto _: state)
+    {
+        BuildNames(described.problem);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * described.problem.NombreDeVariables);
+}
+
+BENCHMARK(BM_ElementNames_Build)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,308 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define WIN32_LEAN_AND_MEAN
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <antares/writer/i_writer.h>
+#include "antares/solver/optimisation/LinearProblemMatrix.h"
+#include "antares/solver/optimisation/constraints/constraint_builder_utils.h"
+#include "antares/solver/optimisation/opt_constants.h"
+#include "antares/solver/optimisation/opt_fonctions.h"
+#include "antares/solver/simulation/common-eco-adq.h"
+#include "antares/solver/simulation/simulation.h"
+#include "antares/solver/utils/filename.h"
+
+#include "in-memory-study.h"
+
+namespace
+{
+// A chain of `nbAreas` areas, each having a thermal cluster, the flow on each link being bounded
+// by an hourly binding constraint. The load of the last area is supplied by all the others.
+struct ChainOfAreas: public StudyBuilder
+{
+    explicit ChainOfAreas(unsigned int nbAreas)
+    {
+        simulationBetweenDays(0, 7);
+
+        Area* previous = nullptr;
+        for (unsigned int i = 0; i != nbAreas; ++i)
+        {
+            Area* area = addAreaToStudy("area " + std::to_string(i));
+            TimeSeriesConfigurer(area->load.series.timeSeries)
+              .setColumnCount(1)
+              .fillColumnWith(0, i + 1 == nbAreas ? 50. * nbAreas : 20.);
+
+            auto cluster = addClusterToArea(area, "cluster " + std::to_string(i));
+            ThermalClusterConfig(cluster.get())
+              .setNominalCapacity(100.)
+              .setAvailablePower(0, 100.)
+              .setCosts(10. + i)
+              .setUnitCount(1);
+
+            if (previous)
+            {
+                AreaLink* link = AreaAddLinkBetweenAreas(previous, area);
+                configureLinkCapacities(link);
+
+                auto bc = addBindingConstraints(*study,
+                                                "bc " + std::to_string(i),
+                                                "group " + std::to_string(i));
+                bc->weight(link, 1);
+                bc->enabled(true);
+                bc->setTimeGranularity(BindingConstraint::typeHourly);
+                bc->operatorType(BindingConstraint::opLess);
+                TimeSeriesConfigurer(bc->RHSTimeSeries())
+                  .setColumnCount(1)
+                  .fillColumnWith(0, 80. * i);
+            }
+            previous = area;
+        }
+        setNumberMCyears(1);
+    }
+};
+
+// A chain of areas simulated over one week. Its weekly problem is kept as it was for the
+// last resolution, along with the results of the year.
+struct SimulatedChainOfAreas: public ChainOfAreas
+{
+    explicit SimulatedChainOfAreas(unsigned int nbAreas):
+        ChainOfAreas(nbAreas)
+    {
+        simulation->useResidentProblems(weeklyProblems);
+        simulation->create();
+        simulation->run();
+    }
+
+    PROBLEME_HEBDO& weeklyProblem()
+    {
+        return weeklyProblems.front();
+    }
+
+    std::vector<PROBLEME_HEBDO> weeklyProblems;
+};
+
+// Two linked areas and `nbConstraints` binding constraints on their link, hourly, daily and
+// weekly in turn, each group gathering 100 constraints having 3 RHS time-series
+struct ManyBindingConstraints: public StudyBuilder
+{
+    explicit ManyBindingConstraints(unsigned int nbConstraints)
+    {
+        Area* origin = addAreaToStudy("origin");
+        Area* extremity = addAreaToStudy("extremity");
+        AreaLink* link = AreaAddLinkBetweenAreas(origin, extremity);
+        configureLinkCapacities(link);
+
+        const BindingConstraint::Type types[] = {BindingConstraint::typeHourly,
+                                                 BindingConstraint::typeDaily,
+                                                 BindingConstraint::typeWeekly};
+        BindingConstraintGroup* group = nullptr;
+        for (unsigned int i = 0; i != nbConstraints; ++i)
+        {
+            const std::string groupName = "group " + std::to_string(i / 100);
+            if (i % 100 == 0)
+            {
+                group = study->bindingConstraintsGroups.add(groupName);
+            }
+            auto bc = study->bindingConstraints.add("bc " + std::to_string(i));
+            bc->group(groupName);
+            group->add(bc);
+            bc->weight(link, 1);
+            bc->enabled(true);
+            bc->setTimeGranularity(types[i % 3]);
+            bc->operatorType(BindingConstraint::opLess);
+            TimeSeriesConfigurer(bc->RHSTimeSeries())
+              .setColumnCount(3, i % 3 ? DAYS_PER_YEAR : HOURS_PER_YEAR)
+              .fillColumnWith(0, 10.)
+              .fillColumnWith(1, 20.)
+              .fillColumnWith(2, 30.);
+        }
+        setNumberMCyears(1);
+        simulation->create();
+    }
+};
+} // namespace
+
+// Simulation of one week: construction of the weekly problem, resolutions and output variables.
+// The creation of the study and of the simulation is not measured.
+static void BM_Simulation_OneWeek(benchmark::State& state)
+{
+    for (auto _: state)
+    {
+        state.PauseTiming();
+        ChainOfAreas builder(state.range(0));
+        builder.simulation->create();
+        state.ResumeTiming();
+
+        builder.simulation->run();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Simulation_OneWeek)->Arg(2)->Arg(10)->Arg(50)->Unit(benchmark::kMillisecond);
+
+// Inputs of the weekly problems of the chain (net load, must-run generation, hydro bounds...) for
+// the 52 weeks of a MC year
+static void BM_Simulation_WeeklyInputs(benchmark::State& state)
+{
+    SimulatedChainOfAreas chain(state.range(0));
+    const Study& study = *chain.study;
+    PROBLEME_HEBDO& problem = chain.weeklyProblem();
+    const auto scratchmap = chain.study->areas.buildScratchMap(0);
+    HYDRO_VENTILATION_RESULTS hydroVentilationResults(study.areas.size());
+    for (auto& results: hydroVentilationResults)
+    {
+        results.HydrauliqueModulableQuotidien.assign(DAYS_PER_YEAR, 0.);
+    }
+
+    for (auto _: state)
+    {
+        for (unsigned int week = 0; week != 52; ++week)
+        {
+            SIM_RenseignementProblemeHebdo(study,
+                                           problem,
+                                           week,
+                                           week * Antares::Constants::nbHoursInAWeek,
+                                           hydroVentilationResults,
+                                           scratchmap);
+        }
+    }
+    // At least the load, run-of-river, misc generation and must-run sums of each area are read
+    const int64_t weeks = state.iterations() * state.range(0) * 52;
+    state.SetItemsProcessed(weeks);
+    state.SetBytesProcessed(weeks * 4 * Antares::Constants::nbHoursInAWeek * sizeof(double));
+}
+
+BENCHMARK(BM_Simulation_WeeklyInputs)->Arg(2)->Arg(10)->Arg(50)->Unit(benchmark::kMicrosecond);
+
+// Construction of the constraint matrix of the weekly problem
+static void BM_LinearProblemMatrix_Run(benchmark::State& state)
+{
+    SimulatedChainOfAreas chain(state.range(0));
+    PROBLEME_HEBDO& problem = chain.weeklyProblem();
+    auto builderData = NewGetConstraintBuilderFromProblemHebdo(&problem);
+    ConstraintBuilder builder(builderData);
+    LinearProblemMatrix matrix(&problem, builder);
+    for (auto _: state)
+    {
+        matrix.Run();
+    }
+    state.SetItemsProcessed(state.iterations() * problem.ProblemeAResoudre->NombreDeContraintes);
+}
+
+BENCHMARK(BM_LinearProblemMatrix_Run)->Arg(2)->Arg(10)->Arg(50)->Unit(benchmark::kMicrosecond);
+
+// Resolution from scratch of the last weekly LP of the simulation (its second optimization)
+static void BM_OPT_AppelDuSimplexe(benchmark::State& state)
+{
+    SimulatedChainOfAreas chain(state.range(0));
+    PROBLEME_HEBDO& problem = chain.weeklyProblem();
+    const auto options = createOptimizationOptions(*chain.study);
+    const auto optPeriodStringGenerator = createOptPeriodAsString(
+      problem.OptimisationAuPasHebdomadaire,
+      0,
+      problem.weekInTheYear,
+      problem.year);
+    Antares::Solver::NullResultWriter writer;
+    for (auto _: state)
+    {
+        // The solver of the previous iteration is released
+        problem.ReinitOptimisation = true;
+        if (!OPT_AppelDuSimplexe(options,
+                                 &problem,
+                                 0,
+                                 DEUXIEME_OPTIMISATION,
+                                 *optPeriodStringGenerator,
+                                 writer))
+        {
+            state.SkipWithError("The weekly problem has no solution");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * problem.ProblemeAResoudre->NombreDeVariables);
+}
+
+BENCHMARK(BM_OPT_AppelDuSimplexe)->Arg(2)->Arg(10)->Arg(50)->Unit(benchmark::kMillisecond);
+
+// Formatting of the synthesis of all the output variables (the files are not written)
+static void BM_SurveyResults_Synthesis(benchmark::State& state)
+{
+    SimulatedChainOfAreas chain(state.range(0));
+    for (auto _: state)
+    {
+        chain.simulation->rawSimu().writeResults(true);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_SurveyResults_Synthesis)->Arg(2)->Arg(10)->Unit(benchmark::kMillisecond);
+
+// Accumulation of the results of a MC year into the synthesis of all the output variables
+static void BM_Variables_ComputeSummary(benchmark::State& state)
+{
+    SimulatedChainOfAreas chain(state.range(0));
+    std::map<unsigned int, unsigned int> spaceToYear{{0, 0}};
+    for (auto _: state)
+    {
+        chain.simulation->rawSimu().variables.computeSummary(spaceToYear, 1);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_Variables_ComputeSummary)->Arg(2)->Arg(10)->Arg(50)->Unit(benchmark::kMillisecond);
+
+// Weekly data of the binding constraints (RHS) for the 52 weeks of a MC year, as at the
+// beginning of a simulation: the RHS time-series are looked up again
+static void BM_BindingConstraints_WeeklyRHS(benchmark::State& state)
+{
+    ManyBindingConstraints builder(state.range(0));
+    Study& study = *builder.study;
+    PROBLEME_HEBDO problem;
+    SIM_InitialisationProblemeHebdo(study, problem, Antares::Constants::nbHoursInAWeek, 0);
+    problem.year = 0;
+    const auto scratchmap = study.areas.buildScratchMap(0);
+    HYDRO_VENTILATION_RESULTS hydroVentilationResults(study.areas.size());
+    for (auto& results: hydroVentilationResults)
+    {
+        results.HydrauliqueModulableQuotidien.assign(DAYS_PER_YEAR, 0.);
+    }
+
+    for (auto _: state)
+    {
+        problem.SecondsMembresDesContraintesCouplantes = {};
+        for (unsigned int week = 0; week != 52; ++week)
+        {
+            SIM_RenseignementProblemeHebdo(study,
+                                           problem,
+                                           week,
+                                           week * Antares::Constants::nbHoursInAWeek,
+                                           hydroVentilationResults,
+                                           scratchmap);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 52);
+}
+
+BENCHMARK(BM_BindingConstraints_WeeklyRHS)->Arg(2000)->Arg(20000)->Unit(benchmark::kMillisecond);
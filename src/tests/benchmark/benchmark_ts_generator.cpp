@@ -0,0 +1,75 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define WIN32_LEAN_AND_MEAN
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <antares/mersenne-twister/mersenne-twister.h>
+#include <antares/solver/ts-generator/generator.h>
+
+#include "in-memory-study.h"
+
+namespace
+{
+// A study of a single area, having `nbClusters` thermal clusters subject to forced and planned
+// outages all year long
+struct StudyWithOutages: public StudyBuilder
+{
+    explicit StudyWithOutages(unsigned int nbClusters)
+    {
+        Area* area = addAreaToStudy("area");
+        study->parameters.nbTimeSeriesThermal = 100;
+        for (unsigned int i = 0; i != nbClusters; ++i)
+        {
+            auto cluster = addClusterToArea(area, "cluster " + std::to_string(i));
+            ThermalClusterConfig(cluster.get()).setNominalCapacity(100.).setUnitCount(10);
+
+            auto& data = cluster->prepro->data;
+            data.fillColumn(PreproAvailability::foDuration, 3.);
+            data.fillColumn(PreproAvailability::poDuration, 14.);
+            data.fillColumn(PreproAvailability::foRate, 0.05);
+            data.fillColumn(PreproAvailability::poRate, 0.1);
+            data.fillColumn(PreproAvailability::npoMax, 10.);
+            clusters.push_back(cluster.get());
+        }
+    }
+
+    std::vector<ThermalCluster*> clusters;
+};
+} // namespace
+
+static void BM_ThermalTimeSeries_Generation(benchmark::State& state)
+{
+    StudyWithOutages builder(state.range(0));
+    MersenneTwister random;
+    for (auto _: state)
+    {
+        random.reset();
+        TSGenerator::generateThermalTimeSeries(*builder.study, builder.clusters, random);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ThermalTimeSeries_Generation)->Arg(1)->Arg(10)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,91 @@
+#!/usr/bin/python3
+# Compare two JSON outputs of antares-benchmarks
+# (--benchmark_out=<file> --benchmark_out_format=json) and exit with a non-zero code when a
+# benchmark of the contender is slower than the baseline by more than the threshold, or when a
+# benchmark of the baseline is missing from the contender.
+# With --run, the contender is first written by running the given antares-benchmarks.
+# The benchmarks matching --exclude are not compared.
+import argparse
+import json
+import re
+import subprocess
+import sys
+
+# Google Benchmark time units, in nanoseconds
+TIME_UNITS = {"ns": 1., "us": 1e3, "ms": 1e6, "s": 1e9}
+
+# used to read the real time of each benchmark, in nanoseconds
+# When the benchmarks were repeated, only their median is kept
+def read_times(file_name):
+    with open(file_name) as f:
+        benchmarks = json.load(f)["benchmarks"]
+    times = {}
+    medians = {}
+    for b in benchmarks:
+        time = b["real_time"] * TIME_UNITS[b.get("time_unit", "ns")]
+        if b.get("run_type") == "aggregate":
+            if b.get("aggregate_name") == "median":
+                medians[b["run_name"]] = time
+        elif "error_occurred" not in b:
+            times.setdefault(b.get("run_name", b["name"]), time)
+    times.update(medians)
+    return times
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two runs of antares-benchmarks")
+    parser.add_argument("baseline", help="JSON output of the reference run")
+    parser.add_argument("contender", help="JSON output of the run to check")
+    parser.add_argument("--threshold", type=float, default=0.1,
+                        help="Tolerated slowdown, as a ratio (default: 0.1 for 10%%)")
+    parser.add_argument("--run", metavar="EXECUTABLE",
+                        help="Run these benchmarks to write the contender first")
+    parser.add_argument("--repetitions", type=int, default=5,
+                        help="Repetitions of each benchmark with --run (default: 5)")
+    parser.add_argument("--exclude", metavar="REGEX", action="append", default=[],
+                        help="Do not compare the benchmarks matching this regular expression")
+    args = parser.parse_args()
+
+    if args.run:
+        subprocess.run([args.run,
+                        "--benchmark_repetitions=%d" % args.repetitions,
+                        "--benchmark_report_aggregates_only=true",
+                        "--benchmark_out=" + args.contender,
+                        "--benchmark_out_format=json"],
+                       check=True)
+
+    baseline = read_times(args.baseline)
+    contender = read_times(args.contender)
+    excluded = sorted(name for name in baseline.keys() | contender.keys()
+                      if any(re.search(regex, name) for regex in args.exclude if regex))
+    for name in excluded:
+        baseline.pop(name, None)
+        contender.pop(name, None)
+
+    regressions = []
+    print("%-50s %14s %14s %9s" % ("Benchmark", "Baseline (ns)", "Contender (ns)", "Change"))
+    for name in sorted(baseline.keys() & contender.keys()):
+        change = contender[name] / baseline[name] - 1.
+        status = ""
+        if change > args.threshold:
+            regressions.append(name)
+            status = " REGRESSION"
+        print("%-50s %14.0f %14.0f %+8.1f%%%s"
+              % (name, baseline[name], contender[name], 100. * change, status))
+
+    missing = sorted(baseline.keys() - contender.keys())
+    for name in missing:
+        print("%-50s missing from the contender" % name)
+    for name in sorted(contender.keys() - baseline.keys()):
+        print("%-50s not in the baseline" % name)
+    for name in excluded:
+        print("%-50s excluded" % name)
+
+    if regressions:
+        print("%d benchmark(s) slower by more than %.0f%%"
+              % (len(regressions), 100. * args.threshold))
+    if missing:
+        print("%d benchmark(s) of the baseline missing from the contender" % len(missing))
+    return 1 if regressions or missing else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
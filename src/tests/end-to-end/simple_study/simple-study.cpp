@@ -19,6 +19,12 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 #define BOOST_TEST_MODULE test - end - to - end tests
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -115,6 +121,22 @@ BOOST_FIXTURE_TEST_CASE(thermal_cluster_fullfills_area_demand, StudyFixture)
     BOOST_TEST(output.load(area).hour(0) == loadInArea, tt::tolerance(0.001));
 }
 
+BOOST_FIXTURE_TEST_CASE(no_hourly_synthesis__daily_results_are_still_computed, StudyFixture)
+{
+    setNumberMCyears(1);
+    study->parameters.geographicTrimming = true;
+    area->filterSynthesis = filterDaily | filterAnnual;
+    simulation->create();
+    simulation->run();
+
+    // The hourly values over all the MC years are not allocated
+    BOOST_CHECK(!study->runtime.hourlySynthesis);
+    OutputRetriever output(simulation->rawSimu());
+    BOOST_TEST(output.load(area).day(0) == loadInArea * 24, tt::tolerance(0.001));
+    BOOST_TEST(output.overallCost(area).day(0) == loadInArea * clusterCost * 24,
+               tt::tolerance(0.001));
+}
+
 BOOST_FIXTURE_TEST_CASE(two_MC_years__thermal_cluster_fullfills_area_demand_on_2nd_year_as_well,
                         StudyFixture)
 {
@@ -440,3 +462,135 @@ BOOST_FIXTURE_TEST_CASE(scenario_builder, HydroMaxPowerStudy)
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+// =========================================
+// Year-by-year results
+// =========================================
+
+namespace
+{
+// Keeps the year-by-year results in memory, each one taking `delay` to be written
+class YearByYearResults: public Antares::Solver::IResultWriter
+{
+public:
+    explicit YearByYearResults(std::chrono::milliseconds delay = {}):
+        delay_(delay)
+    {
+    }
+
+    void addEntryFromBuffer(const std::string& path, Yuni::Clob& content) override
+    {
+        add(path, std::string(content.c_str(), content.size()));
+    }
+
+    void addEntryFromBuffer(const std::string& path, std::string& content) override
+    {
+        add(path, content);
+    }
+
+    void addEntryFromFile(const std::filesystem::path&, const std::filesystem::path&) override
+    {
+    }
+
+    void flush() override
+    {
+    }
+
+    bool needsTheJobQueue() const override
+    {
+        return false;
+    }
+
+    void finalize(bool) override
+    {
+    }
+
+    // The results of a MC year (1-based), by path
+    std::map<std::string, std::string> ofYear(unsigned int year)
+    {
+        auto number = std::to_string(year);
+        auto prefix = "mc-ind/" + std::string(5 - number.size(), '0') + number + "/";
+
+        std::lock_guard lock(mutex_);
+        std::map<std::string, std::string> result;
+        for (auto [path, content]: entries_)
+        {
+            std::replace(path.begin(), path.end(), '\\', '/');
+            if (auto position = path.find(prefix); position != std::string::npos)
+            {
+                result[path.substr(position)] = content;
+            }
+        }
+        return result;
+    }
+
+private:
+    void add(const std::string& path, const std::string& content)
+    {
+        std::this_thread::sleep_for(delay_);
+        std::lock_guard lock(mutex_);
+        entries_[path] = content;
+    }
+
+    std::chrono::milliseconds delay_;
+    std::mutex mutex_;
+    std::map<std::string, std::string> entries_;
+};
+
+// The study of the fixture, the load of year y being 5 + y
+struct YearByYearFixture: public StudyFixture
+{
+    explicit YearByYearFixture(unsigned int nbYears = 6)
+    {
+        setNumberMCyears(nbYears);
+        study->parameters.yearByYear = true;
+
+        loadTSconfig.setColumnCount(nbYears);
+        ScenarioBuilderRule scenarioBuilderRule(*study);
+        for (unsigned int y = 0; y != nbYears; ++y)
+        {
+            loadTSconfig.fillColumnWith(y, 5. + y);
+            scenarioBuilderRule.load().setTSnumber(area->index, y, y + 1);
+        }
+    }
+};
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(YEAR_BY_YEAR)
+
+BOOST_AUTO_TEST_CASE(results_exported_in_the_background_are_the_ones_of_their_year)
+{
+    constexpr unsigned int nbYears = 6;
+
+    // Two spaces, and exports slow enough to still be pending when the next year of a space
+    // starts
+    YearByYearResults results(std::chrono::milliseconds(5));
+    {
+        YearByYearFixture fixture;
+        fixture.study->maxNbYearsInParallel = 2;
+        fixture.simulation->useResultWriter(results);
+        fixture.simulation->create();
+        fixture.simulation->run();
+    }
+
+    for (unsigned int y = 0; y != nbYears; ++y)
+    {
+        // Reference: the year alone, its export being done before the end of the simulation
+        YearByYearResults reference;
+        {
+            YearByYearFixture fixture;
+            fixture.playOnlyYear(y);
+            fixture.simulation->useResultWriter(reference);
+            fixture.simulation->create();
+            fixture.simulation->run();
+        }
+
+        auto expected = reference.ofYear(y + 1);
+        BOOST_REQUIRE(!expected.empty());
+        BOOST_CHECK(results.ofYear(y + 1) == expected);
+    }
+    // The years do have different results
+    BOOST_CHECK(results.ofYear(1) != results.ofYear(2));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
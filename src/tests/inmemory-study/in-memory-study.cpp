@@ -54,9 +54,11 @@ void addScratchpadToEachArea(Study& study)
 {
     for (auto& [_, area]: study.areas)
     {
+        auto shared = std::make_shared<const AreaScratchpad::YearIndependentData>(study.runtime,
+                                                                                   *area);
         for (unsigned int i = 0; i < study.maxNbYearsInParallel; ++i)
         {
-            area->scratchpad.emplace_back(study.runtime, *area);
+            area->scratchpad.emplace_back(shared);
         }
     }
 }
@@ -193,8 +195,9 @@ void SimulationHandler::create()
     simulation_ = std::make_shared<ISimulation<Economy>>(study_,
                                                          settings_,
                                                          durationCollector_,
-                                                         resultWriter_,
-                                                         observer_);
+                                                         *resultWriter_,
+                                                         observer_,
+                                                         residentProblems_);
     Antares::Solver::ScenarioBuilderOwner(study_).callScenarioBuilder();
 
     SIM_AllocationTableaux(study_);
@@ -204,13 +204,27 @@ public:
         return *simulation_;
     }
 
+    //! Give the results to `writer` instead of discarding them, to be called before create()
+    void useResultWriter(IResultWriter& writer)
+    {
+        resultWriter_ = &writer;
+    }
+
+    //! Keep the weekly problems in `problems` after the simulation, to be called before create()
+    void useResidentProblems(std::vector<PROBLEME_HEBDO>& problems)
+    {
+        residentProblems_ = &problems;
+    }
+
 private:
     std::shared_ptr<ISimulation<Economy>> simulation_;
     Benchmarking::DurationCollector durationCollector_;
     Settings settings_;
     Study& study_;
-    NullResultWriter resultWriter_;
+    NullResultWriter nullResultWriter_;
+    IResultWriter* resultWriter_ = &nullResultWriter_;
     NullSimulationObserver observer_;
+    std::vector<PROBLEME_HEBDO>* residentProblems_ = nullptr;
 };
 
 // =========================
@@ -24,6 +24,7 @@
 
 #include "tests-matrix-load.h"
 
+#include <cmath>
 #include <fstream>
 #include <iostream>
 #include <stdio.h>
@@ -44,6 +45,7 @@ All loadFromCSVFile(...) entries (some directions to test this big method):
                 d. full of zeros,
                 e. full of numbers (> 0 or < 0)
                 f. strange cases
+                g. numbers written with uncommon syntaxes
         2. Initial matrix state (matrix state when loadFromCSVFile(...) is called) :
                 a. empty
                 b. sized n x m
@@ -206,6 +208,52 @@ BOOST_AUTO_TEST_CASE(fake_file_not_empty__target_mtx_empty___mtx_gets_file_dimen
     BOOST_REQUIRE_EQUAL(mtx.entry[2][1], -5.56);
 }
 
+BOOST_AUTO_TEST_CASE(fake_file_not_empty__load_some_columns___other_columns_released)
+{
+    // Creating a buffer mocking the result of : IO::File::LoadFromFile(...)
+    Matrix_easy_to_fill<double, double> mtx_0(2, 3, {1.5, -2.44444, 3.66666, 0, 8.559, -5.5555});
+    fake_buffer_factory<double, double> buffer_factory_dd;
+    buffer_factory_dd.matrix_to_build_buffer_with(&mtx_0);
+    buffer_factory_dd.set_precision(2);
+    buffer_factory_dd.print_dimensions(false);
+
+    Clob* fake_buffer = buffer_factory_dd.build_buffer();
+
+    // Testing load
+    Matrix_mock_load_to_buffer<double, double> mtx;
+    BOOST_CHECK(
+      mtx.loadColumnsFromCSVFile("path/to/a/file", {true, false, true}, 1, 2, fake_buffer));
+
+    delete fake_buffer;
+
+    BOOST_REQUIRE_EQUAL(mtx.height, 2);
+    BOOST_REQUIRE_EQUAL(mtx.width, 3);
+    BOOST_CHECK(mtx.columnReleased(1));
+    BOOST_REQUIRE_EQUAL(mtx.entry[0][0], 1.5);
+    BOOST_REQUIRE_EQUAL(mtx.entry[2][0], 3.67);
+    BOOST_REQUIRE_EQUAL(mtx.entry[0][1], 0);
+    BOOST_REQUIRE_EQUAL(mtx.entry[2][1], -5.56);
+}
+
+BOOST_AUTO_TEST_CASE(file_with_final_tabs___csv_file_width_ignores_them)
+{
+    std::ofstream fout("width.txt");
+    fout << "1\t2;3,4\t\t\r\n5\t6\t7\t8\t9\n";
+    fout.close();
+
+    BOOST_CHECK_EQUAL(Matrix<>::CSVFileWidth("width.txt"), 4);
+}
+
+BOOST_AUTO_TEST_CASE(file_with_banner___csv_file_width_is_unknown)
+{
+    std::ofstream fout("width.txt");
+    fout << "size:3x2\n1\t2\t3\n4\t5\t6\n";
+    fout.close();
+
+    BOOST_CHECK_EQUAL(Matrix<>::CSVFileWidth("width.txt"), 0);
+    BOOST_CHECK_EQUAL(Matrix<>::CSVFileWidth("path/to/a/missing/file"), 0);
+}
+
 // Specific tests for renewable TS
 // Expected behavior : read 4 digits
 BOOST_AUTO_TEST_CASE(fake_file_double_renewable)
@@ -283,6 +331,27 @@ BOOST_AUTO_TEST_CASE(file_with_alphabetic_char___load_fails_with_warning)
     BOOST_CHECK(logs.warning().contains("Invalid numeric value"));
 }
 
+// 1.g.
+BOOST_AUTO_TEST_CASE(file_with_uncommon_number_syntaxes___values_read_as_strtod_does)
+{
+    Clob* fake_buffer = new Clob;
+    fake_buffer->append("+1.5\t 2\t0x10\n1e400\t-.25\t7.\r\n");
+
+    Matrix_mock_load_to_buffer<double, double> mtx;
+    BOOST_CHECK(mtx.loadFromCSVFile("path/to/a/file", 3, 2, Matrix<>::optNone, fake_buffer));
+
+    delete fake_buffer;
+
+    BOOST_REQUIRE_EQUAL(mtx.width, 3);
+    BOOST_REQUIRE_EQUAL(mtx.height, 2);
+    BOOST_CHECK_EQUAL(mtx.entry[0][0], 1.5);
+    BOOST_CHECK_EQUAL(mtx.entry[1][0], 2.);
+    BOOST_CHECK_EQUAL(mtx.entry[2][0], 16.);
+    BOOST_CHECK(std::isinf(mtx.entry[0][1]));
+    BOOST_CHECK_EQUAL(mtx.entry[1][1], -0.25);
+    BOOST_CHECK_EQUAL(mtx.entry[2][1], 7.);
+}
+
 // 1.f.
 BOOST_AUTO_TEST_CASE(
   binary_file___detect_encoding_when_loading_buffer_is_KO_and_is_probably_dead_code)
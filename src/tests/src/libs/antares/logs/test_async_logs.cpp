@@ -0,0 +1,161 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test - async logs
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/logs/async_logs.h"
+
+using namespace Antares;
+
+namespace
+{
+// Written under the lock of the logger
+std::vector<std::string> written;
+
+void onMessage(int, const std::string& message)
+{
+    written.push_back(message);
+}
+
+struct Fixture
+{
+    Fixture()
+    {
+        written.clear();
+        logs.callback.connect(&onMessage);
+    }
+
+    ~Fixture()
+    {
+        logs.callback.clear();
+    }
+
+    // Messages of a given prefix, in the order they were written
+    static std::vector<std::string> writtenWith(const std::string& prefix)
+    {
+        std::vector<std::string> result;
+        for (const auto& message: written)
+        {
+            if (message.starts_with(prefix))
+            {
+                result.push_back(message);
+            }
+        }
+        return result;
+    }
+};
+
+std::vector<std::string> expectedMessages(const std::string& prefix, int count)
+{
+    std::vector<std::string> result;
+    for (int i = 0; i != count; ++i)
+    {
+        result.push_back(prefix + std::to_string(i));
+    }
+    return result;
+}
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(async_logs, Fixture)
+
+BOOST_AUTO_TEST_CASE(unbound_thread_writes_directly)
+{
+    AsyncLogs sink(1);
+    AsyncLogs::info() << "direct " << 1;
+    BOOST_CHECK(writtenWith("direct") == std::vector<std::string>{"direct 1"});
+}
+
+BOOST_AUTO_TEST_CASE(messages_of_a_queue_keep_their_order)
+{
+    // Much more messages than the capacity of the queue
+    constexpr int count = 1000;
+    {
+        AsyncLogs sink(1, 8);
+        std::thread year(
+          [&sink]
+          {
+              AsyncLogs::Binding binding(sink, 0);
+              for (int i = 0; i != count; ++i)
+              {
+                  AsyncLogs::warning() << "year " << i;
+              }
+          });
+        year.join();
+        sink.flush();
+        BOOST_CHECK(writtenWith("year ") == expectedMessages("year ", count));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(messages_of_the_logger_go_to_the_queue_of_a_bound_thread)
+{
+    constexpr int count = 1000;
+    {
+        AsyncLogs sink(1, 8);
+        std::thread year(
+          [&sink]
+          {
+              AsyncLogs::Binding binding(sink, 0);
+              for (int i = 0; i != count; ++i)
+              {
+                  if (i % 2)
+                  {
+                      logs.info() << "mixed " << i;
+                  }
+                  else
+                  {
+                      AsyncLogs::info() << "mixed " << i;
+                  }
+              }
+          });
+        year.join();
+        sink.flush();
+        BOOST_CHECK(writtenWith("mixed ") == expectedMessages("mixed ", count));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(queues_are_drained_independently)
+{
+    constexpr int count = 300;
+    {
+        AsyncLogs sink(2, 16);
+        auto job = [&sink](uint queue, std::string prefix)
+        {
+            AsyncLogs::Binding binding(sink, queue);
+            for (int i = 0; i != count; ++i)
+            {
+                AsyncLogs::info() << prefix << i;
+            }
+        };
+        std::thread first(job, 0, "first ");
+        std::thread second(job, 1, "second ");
+        first.join();
+        second.join();
+    }
+    // The pending messages are written when the sink is destroyed
+    BOOST_CHECK(writtenWith("first ") == expectedMessages("first ", count));
+    BOOST_CHECK(writtenWith("second ") == expectedMessages("second ", count));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -307,4 +307,44 @@ BOOST_AUTO_TEST_CASE(BC_load_legacy_range)
     BOOST_CHECK_CLOSE((*bc_gt)->RHSTimeSeries()[0][8783], 0.4, 0.0001);
 }
 
+BOOST_AUTO_TEST_CASE(active_constraints_are_selected_at_loading_time)
+{
+    auto study = std::make_shared<Study>();
+    auto* area1 = study->areaAdd("area1");
+    auto* area2 = study->areaAdd("area2");
+    AreaAddLinkBetweenAreas(area1, area2);
+
+    StudyLoadOptions options;
+    BindingConstraintsRepository bindingConstraints;
+
+    auto working_tmp_dir = CREATE_TMP_DIR_BASED_ON_TEST_NAME();
+
+    std::ofstream constraints(working_tmp_dir / "bindingconstraints.ini");
+    for (const std::string enabled: {"true", "false"})
+    {
+        constraints << "[" << enabled << "]\n"
+                    << "name = " << enabled << "\n"
+                    << "id = " << enabled << "\n"
+                    << "enabled = " << enabled << "\n"
+                    << "type = hourly\n"
+                    << "operator = less\n"
+                    << "group = dummy_group\n"
+                    << "area1%area2 = 1.000000\n";
+        std::ofstream rhs(working_tmp_dir / (enabled + "_lt.txt"));
+    }
+    constraints.close();
+    study->header.version = StudyVersion(8, 7);
+    BOOST_REQUIRE(
+      bindingConstraints.loadFromFolder(*study, options, working_tmp_dir.string()));
+    BOOST_CHECK_EQUAL(bindingConstraints.size(), 2);
+
+    // Read as is by the MC years run in parallel
+    const auto& active = bindingConstraints.activeConstraints();
+    BOOST_REQUIRE_EQUAL(active.size(), 1);
+    BOOST_CHECK_EQUAL(active.front()->name(), "true");
+
+    bindingConstraints.remove(active.front().get());
+    BOOST_CHECK(bindingConstraints.activeConstraints().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -22,7 +22,9 @@
 
 #define WIN32_LEAN_AND_MEAN
 
+#include <fstream>
 #include <memory>
+#include <stdexcept>
 #include <vector>
 
 #include <boost/test/unit_test.hpp>
@@ -224,6 +226,108 @@ BOOST_FIXTURE_TEST_CASE(getCoefficient_SingleColumn, Fixture)
     BOOST_CHECK_EQUAL(ts.getCoefficient(1, 1), 74.74);
 }
 
+// RELEASE OF THE UNUSED COLUMNS
+BOOST_FIXTURE_TEST_CASE(releaseUnusedColumns_keepsTheColumnsOfThePlaylist, Fixture)
+{
+    ts.resize(4, HOURS_PER_YEAR);
+    tsnum.reset(3);
+    tsnum[0] = 3;
+    tsnum[1] = 0;
+    tsnum[2] = 1;
+    fillColumn(3);
+
+    // Years 1 and 3 only
+    BOOST_CHECK_EQUAL(ts.releaseUnusedColumns({true, false, true}), 2);
+    BOOST_CHECK_EQUAL(ts.timeSeries.width, 4);
+    BOOST_CHECK(ts.timeSeries.columnReleased(0));
+    BOOST_CHECK(ts.timeSeries.columnReleased(2));
+    BOOST_CHECK(!ts.timeSeries.columnReleased(1));
+    BOOST_CHECK_EQUAL(ts.getCoefficient(0, 12), 12);
+    BOOST_CHECK(ts.getColumn(2) != nullptr);
+
+    // Nothing left to release
+    BOOST_CHECK_EQUAL(ts.releaseUnusedColumns({true, false, true}), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(releaseUnusedColumns_singleColumnIsKept, Fixture)
+{
+    tsnum.reset(2);
+    BOOST_CHECK_EQUAL(ts.releaseUnusedColumns({false, false}), 0);
+    BOOST_CHECK(ts.getColumn(1) != nullptr);
+}
+
+BOOST_FIXTURE_TEST_CASE(usedColumnsLoaded_falseIfAColumnOfTheYearsIsReleased, Fixture)
+{
+    ts.resize(2, HOURS_PER_YEAR);
+    tsnum.reset(2);
+    tsnum[0] = 0;
+    tsnum[1] = 1;
+
+    ts.releaseUnusedColumns({true, false});
+    BOOST_CHECK(ts.usedColumnsLoaded({true, false}));
+    BOOST_CHECK(!ts.usedColumnsLoaded({true, true}));
+    BOOST_CHECK_EQUAL(ts.releasedColumnCount(), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(getColumn_throwsIfTheColumnOfTheYearIsReleased, Fixture)
+{
+    ts.resize(2, HOURS_PER_YEAR);
+    tsnum.reset(2);
+    tsnum[0] = 0;
+    tsnum[1] = 1;
+
+    ts.releaseUnusedColumns({true, false});
+    BOOST_CHECK(ts.getColumn(0) != nullptr);
+    BOOST_CHECK_THROW(ts.getColumn(1), std::runtime_error);
+    BOOST_CHECK_THROW(ts.getCoefficient(1, 0), std::runtime_error);
+}
+
+// DEFERRED LOADING
+static void writeSeriesFile(const std::string& path, unsigned int width)
+{
+    std::ofstream file(path);
+    for (unsigned int h = 0; h < HOURS_PER_YEAR; h++)
+    {
+        for (unsigned int x = 0; x < width; x++)
+        {
+            file << (x + 1) * 10 + h % 10 << (x + 1 < width ? "\t" : "\n");
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(deferLoadingFromFile_onlyTheColumnsOfThePlaylistAreLoaded, Fixture)
+{
+    writeSeriesFile("deferred-series.txt", 3);
+    BOOST_CHECK(ts.deferLoadingFromFile("deferred-series.txt"));
+    BOOST_CHECK(ts.loadingDeferred());
+    BOOST_CHECK_EQUAL(ts.numberOfColumns(), 3);
+    BOOST_CHECK_EQUAL(ts.releasedColumnCount(), 3);
+
+    tsnum.reset(2);
+    tsnum[0] = 2;
+    tsnum[1] = 0;
+
+    // Year 1 only
+    BOOST_CHECK(ts.loadUsedColumns({true, false}));
+    BOOST_CHECK(!ts.loadingDeferred());
+    BOOST_CHECK_EQUAL(ts.numberOfColumns(), 3);
+    BOOST_CHECK_EQUAL(ts.releasedColumnCount(), 2);
+    BOOST_CHECK(!ts.timeSeries.columnReleased(2));
+    BOOST_CHECK_EQUAL(ts.getCoefficient(0, 0), 30);
+    BOOST_CHECK_EQUAL(ts.getCoefficient(0, HOURS_PER_YEAR - 1), 39);
+    BOOST_CHECK(ts.usedColumnsLoaded({true, false}));
+    BOOST_CHECK(!ts.usedColumnsLoaded({true, true}));
+}
+
+BOOST_FIXTURE_TEST_CASE(deferLoadingFromFile_singleColumnIsLoaded, Fixture)
+{
+    writeSeriesFile("deferred-series.txt", 1);
+    BOOST_CHECK(ts.deferLoadingFromFile("deferred-series.txt"));
+    BOOST_CHECK(!ts.loadingDeferred());
+    BOOST_CHECK_EQUAL(ts.releasedColumnCount(), 0);
+    BOOST_CHECK_EQUAL(ts.getCoefficient(0, 1), 11);
+}
+
 // VALID CONFIGURATIONS
 BOOST_FIXTURE_TEST_CASE(checkSizeOK_1TS, FixtureMultipleTS)
 {
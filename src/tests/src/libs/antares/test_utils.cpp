@@ -19,13 +19,19 @@
  * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
  */
 #define BOOST_TEST_MODULE test utils
+#include <cmath>
+#include <cstdio>
 #include <filesystem>
+#include <iterator>
+#include <limits>
+#include <random>
 #include <string>
 
 #include <boost/test/unit_test.hpp>
 
 #include <yuni/io/file.h>
 
+#include <antares/utils/number_format.h>
 #include <antares/utils/utils.h>
 
 namespace fs = std::filesystem;
@@ -44,6 +50,21 @@ T beautify(const T& in)
 constexpr auto beautifyStd = beautify<std::string>;
 constexpr auto beautifyYuni = beautify<Yuni::String>;
 
+std::string printfFixed(double v, unsigned precision)
+{
+    char buffer[Antares::Utils::numberBufferSize];
+    int size = std::snprintf(buffer, sizeof(buffer), "%.*f", (int)precision, v);
+    return std::string(buffer, size);
+}
+
+std::string fixed(double v, unsigned precision)
+{
+    char buffer[Antares::Utils::numberBufferSize];
+    const char* end = Antares::Utils::formatFixed(buffer, std::end(buffer), v, precision);
+    BOOST_REQUIRE(end != nullptr);
+    return std::string(buffer, end - buffer);
+}
+
 } // namespace
 
 BOOST_AUTO_TEST_SUITE(utils)
@@ -106,4 +127,83 @@ BOOST_AUTO_TEST_CASE(yuni_normalize_vs_std_lexically_normal)
     helper(fs::path("a/.///b/../"));
 }
 
+BOOST_AUTO_TEST_CASE(format_fixed_is_identical_to_printf)
+{
+    const double values[] = {0.,
+                             -0.,
+                             0.5,
+                             1.5,
+                             2.5,
+                             -2.5,
+                             0.125,
+                             1e-7,
+                             -1e-7,
+                             0.1 + 0.2,
+                             123456789.987654321,
+                             -42.,
+                             1e22,
+                             std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::lowest(),
+                             std::numeric_limits<double>::denorm_min()};
+    for (unsigned precision = 0; precision <= Antares::Utils::maxFixedPrecision; ++precision)
+    {
+        for (double v: values)
+        {
+            BOOST_CHECK_EQUAL(fixed(v, precision), printfFixed(v, precision));
+        }
+    }
+
+    std::mt19937_64 random(42);
+    std::uniform_real_distribution<double> mantissa(-1., 1.);
+    std::uniform_int_distribution<int> exponent(-8, 12);
+    for (int i = 0; i != 20000; ++i)
+    {
+        double v = std::ldexp(mantissa(random), exponent(random) * 3);
+        unsigned precision = i % 7;
+        BOOST_CHECK_EQUAL(fixed(v, precision), printfFixed(v, precision));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(precision_of_printf_format)
+{
+    BOOST_CHECK_EQUAL(Antares::Utils::precisionOfPrintfFormat("%.0f"), 0);
+    BOOST_CHECK_EQUAL(Antares::Utils::precisionOfPrintfFormat("%.6f"), 6);
+    BOOST_CHECK_EQUAL(Antares::Utils::precisionOfPrintfFormat("%.16f"), 16);
+    BOOST_CHECK_EQUAL(Antares::Utils::precisionOfPrintfFormat("%.17f"), -1);
+    BOOST_CHECK_EQUAL(Antares::Utils::precisionOfPrintfFormat("%f"), -1);
+    BOOST_CHECK_EQUAL(Antares::Utils::precisionOfPrintfFormat("%.2e"), -1);
+    BOOST_CHECK_EQUAL(Antares::Utils::precisionOfPrintfFormat("%.2fx"), -1);
+    BOOST_CHECK_EQUAL(Antares::Utils::precisionOfPrintfFormat(""), -1);
+}
+
+BOOST_AUTO_TEST_CASE(number_writer_appends_in_order)
+{
+    std::string expected;
+    std::string out = "header\n";
+    {
+        Antares::Utils::NumberWriter<std::string> writer(out);
+        // Enough values to flush the chunk several times
+        for (int i = 0; i != 5000; ++i)
+        {
+            double v = i * 1.25 - 300.;
+            writer.put('\t');
+            writer.fixed(v, 2);
+            writer.integer(i);
+            expected += '\t' + printfFixed(v, 2) + std::to_string(i);
+        }
+        writer.fixed(std::numeric_limits<double>::max(), 16);
+        expected += printfFixed(std::numeric_limits<double>::max(), 16);
+    }
+    BOOST_CHECK(out == "header\n" + expected);
+
+    Yuni::Clob clob;
+    {
+        Antares::Utils::NumberWriter<Yuni::Clob> writer(clob);
+        writer.put("N/A", 3);
+        writer.put('\t');
+        writer.fixed(0.5, 0);
+    }
+    BOOST_CHECK(clob == "N/A\t0");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#define BOOST_TEST_MODULE test_simulation_request
+#define WIN32_LEAN_AND_MEAN
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/application/SimulationSession.h>
+
+using namespace Antares::Solver;
+
+BOOST_AUTO_TEST_CASE(empty_request_keeps_the_study_parameters)
+{
+    auto request = parseSimulationRequest("", 10);
+    BOOST_CHECK(request.name.empty());
+    BOOST_CHECK(!request.playlist);
+    BOOST_CHECK(!request.activeRules);
+    BOOST_CHECK(!request.yearByYear);
+}
+
+BOOST_AUTO_TEST_CASE(playlist_years_are_one_based_and_ranges_are_expanded)
+{
+    auto request = parseSimulationRequest("playlist=1,3,5-7 name=what-if", 10);
+    BOOST_REQUIRE(request.playlist);
+    std::vector<uint> expected{0, 2, 4, 5, 6};
+    BOOST_CHECK_EQUAL_COLLECTIONS(request.playlist->begin(),
+                                  request.playlist->end(),
+                                  expected.begin(),
+                                  expected.end());
+    BOOST_CHECK_EQUAL(request.name, "what-if");
+}
+
+BOOST_AUTO_TEST_CASE(rules_and_year_by_year_are_read)
+{
+    auto request = parseSimulationRequest(" rules=Custom  year-by-year=false ", 10);
+    BOOST_REQUIRE(request.activeRules);
+    BOOST_CHECK_EQUAL(*request.activeRules, "Custom");
+    BOOST_REQUIRE(request.yearByYear);
+    BOOST_CHECK(!*request.yearByYear);
+}
+
+BOOST_AUTO_TEST_CASE(malformed_requests_are_rejected)
+{
+    BOOST_CHECK_THROW(parseSimulationRequest("playlist", 10), std::invalid_argument);
+    BOOST_CHECK_THROW(parseSimulationRequest("unknown=1", 10), std::invalid_argument);
+    BOOST_CHECK_THROW(parseSimulationRequest("playlist=0", 10), std::invalid_argument);
+    BOOST_CHECK_THROW(parseSimulationRequest("playlist=5-2", 10), std::invalid_argument);
+    BOOST_CHECK_THROW(parseSimulationRequest("playlist=x", 10), std::invalid_argument);
+    BOOST_CHECK_THROW(parseSimulationRequest("year-by-year=maybe", 10), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(years_out_of_the_study_are_rejected_before_expanding_the_ranges)
+{
+    BOOST_CHECK_NO_THROW(parseSimulationRequest("playlist=10", 10));
+    BOOST_CHECK_THROW(parseSimulationRequest("playlist=11", 10), std::invalid_argument);
+    BOOST_CHECK_THROW(parseSimulationRequest("playlist=1-4000000000", 10), std::invalid_argument);
+    BOOST_CHECK_THROW(parseSimulationRequest("playlist=11-12", 10), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(serve_answers_each_request_on_a_single_line)
+{
+    std::istringstream in("run name=first\n"
+                          "\n"
+                          "run playlist=2-3\n"
+                          "stop\n"
+                          "run playlist=0\n"
+                          "quit\n"
+                          "run name=ignored\n");
+    std::ostringstream out;
+    std::vector<SimulationRequest> requests;
+    auto answered = serveSimulationRequests(in,
+                                            out,
+                                            10,
+                                            [&requests](const SimulationRequest& request)
+                                            {
+                                                requests.push_back(request);
+                                                return "output-" + std::to_string(requests.size());
+                                            });
+
+    BOOST_CHECK_EQUAL(answered, 4);
+    BOOST_CHECK_EQUAL(out.str(),
+                      "[service] ready\n"
+                      "[service] ok output-1\n"
+                      "[service] ok output-2\n"
+                      "[service] error unknown command 'stop'\n"
+                      "[service] error invalid MC year '0'\n");
+    BOOST_REQUIRE_EQUAL(requests.size(), 2);
+    BOOST_CHECK_EQUAL(requests[0].name, "first");
+    BOOST_REQUIRE(requests[1].playlist);
+    BOOST_CHECK_EQUAL(requests[1].playlist->size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(serve_reports_the_failure_of_a_simulation_and_goes_on)
+{
+    std::istringstream in("run\nrun\n");
+    std::ostringstream out;
+    int calls = 0;
+    serveSimulationRequests(in,
+                            out,
+                            10,
+                            [&calls](const SimulationRequest&) -> std::string
+                            {
+                                if (++calls == 1)
+                                {
+                                    throw std::runtime_error("no space left");
+                                }
+                                return "output";
+                            });
+
+    BOOST_CHECK_EQUAL(out.str(),
+                      "[service] ready\n"
+                      "[service] error no space left\n"
+                      "[service] ok output\n");
+}
+
+BOOST_AUTO_TEST_CASE(service_output_sends_the_logs_to_the_standard_error)
+{
+    std::ostringstream standardOutput;
+    std::ostringstream standardError;
+    auto* coutBuffer = std::cout.rdbuf(standardOutput.rdbuf());
+    auto* cerrBuffer = std::cerr.rdbuf(standardError.rdbuf());
+    {
+        ServiceOutput output;
+        std::cout << "log" << std::endl;
+        output.answers() << "answer" << std::endl;
+    }
+    std::cout << "after" << std::endl;
+    std::cout.rdbuf(coutBuffer);
+    std::cerr.rdbuf(cerrBuffer);
+
+    BOOST_CHECK_EQUAL(standardOutput.str(), "answer\nafter\n");
+    BOOST_CHECK_EQUAL(standardError.str(), "log\n");
+}
@@ -0,0 +1,525 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE cycle basis of the constraints builder
+#define WIN32_LEAN_AND_MEAN
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/solver/constraints-builder/cbuilder.h>
+
+using namespace Antares::Graph;
+
+namespace
+{
+struct Area
+{
+};
+
+// Lines of a grid, between the nodes 0 to nodeCount - 1
+struct Mesh
+{
+    struct Line
+    {
+        uint origin;
+        uint destination;
+        long weight;
+    };
+
+    uint nodeCount = 0;
+    std::vector<Line> lines;
+};
+
+using Loops = std::vector<std::vector<int>>;
+
+std::string nodeName(uint node)
+{
+    return "n" + std::to_string(node);
+}
+
+// Nodes are added in the order of their index, then the lines in their order
+void fillGrid(Grid<Area>& grid, std::vector<Area>& areas, const Mesh& mesh)
+{
+    areas.resize(mesh.nodeCount);
+    for (uint n = 0; n != mesh.nodeCount; ++n)
+    {
+        grid.addNode(areas[n], nodeName(n));
+    }
+    for (auto& line: mesh.lines)
+    {
+        grid.addEdge(grid.findNodeFromName(nodeName(line.origin)),
+                     grid.findNodeFromName(nodeName(line.destination)),
+                     line.weight);
+    }
+}
+
+// The edges of the grid: there is at most one between two nodes, the first line (see
+// Grid::addEdge()). The loops index these edges.
+Mesh withoutParallelLines(const Mesh& mesh)
+{
+    Mesh edges;
+    edges.nodeCount = mesh.nodeCount;
+    std::set<std::pair<uint, uint>> known;
+    for (auto& line: mesh.lines)
+    {
+        if (known.insert(std::minmax(line.origin, line.destination)).second)
+        {
+            edges.lines.push_back(line);
+        }
+    }
+    return edges;
+}
+
+/*!
+** \brief Loops of the mesh, searched as the constraints builder did before its optimizations
+**
+** Plain de Pina algorithm: Kruskal by stable sort, witnesses as vectors of bits, and Dijkstra
+** selecting the closest node by a linear search (the first one in the order of the nodes).
+*/
+Loops referenceMesh(const Mesh& mesh)
+{
+    const std::vector<Mesh::Line> lines = withoutParallelLines(mesh).lines;
+    const uint edgeCount = (uint)lines.size();
+
+    // Kruskal
+    std::vector<uint> order(edgeCount);
+    for (uint e = 0; e != edgeCount; ++e)
+    {
+        order[e] = e;
+    }
+    std::stable_sort(order.begin(),
+                     order.end(),
+                     [&lines](uint a, uint b) { return lines[a].weight < lines[b].weight; });
+    std::vector<uint> component(mesh.nodeCount);
+    for (uint n = 0; n != mesh.nodeCount; ++n)
+    {
+        component[n] = n;
+    }
+    std::vector<bool> inTree(edgeCount, false);
+    for (uint e: order)
+    {
+        uint from = component[lines[e].origin];
+        uint to = component[lines[e].destination];
+        if (from != to)
+        {
+            inTree[e] = true;
+            std::replace(component.begin(), component.end(), to, from);
+        }
+    }
+
+    std::vector<std::vector<char>> witnesses;
+    for (uint e = 0; e != edgeCount; ++e)
+    {
+        if (!inTree[e])
+        {
+            witnesses.emplace_back(edgeCount, 0)[e] = 1;
+        }
+    }
+
+    // Signed grid: the node n is split into 2n (+) and 2n + 1 (-)
+    const uint signedCount = 2 * mesh.nodeCount;
+    const long infinity = std::numeric_limits<long>::max();
+    Loops loops;
+    for (uint i = 0; i != witnesses.size(); ++i)
+    {
+        std::vector<std::vector<std::pair<uint, uint>>> adjacency(signedCount);
+        std::vector<uint> adjacentNodes;
+        for (uint e = 0; e != edgeCount; ++e)
+        {
+            uint o = lines[e].origin;
+            uint d = lines[e].destination;
+            uint crossed = witnesses[i][e];
+            adjacency[2 * o].emplace_back(2 * d + crossed, e);
+            adjacency[2 * d + crossed].emplace_back(2 * o, e);
+            adjacency[2 * o + 1].emplace_back(2 * d + 1 - crossed, e);
+            adjacency[2 * d + 1 - crossed].emplace_back(2 * o + 1, e);
+            if (crossed)
+            {
+                for (uint n: {o, d})
+                {
+                    if (std::find(adjacentNodes.begin(), adjacentNodes.end(), n)
+                        == adjacentNodes.end())
+                    {
+                        adjacentNodes.push_back(n);
+                    }
+                }
+            }
+        }
+
+        std::vector<int> shortest;
+        long shortestLength = infinity;
+        for (uint n: adjacentNodes)
+        {
+            std::vector<long> dist(signedCount, infinity);
+            std::vector<int> prevEdge(signedCount, -1);
+            std::vector<uint> prevNode(signedCount, 0);
+            std::vector<bool> visited(signedCount, false);
+            dist[2 * n] = 0;
+            while (true)
+            {
+                uint u = signedCount;
+                for (uint v = 0; v != signedCount; ++v)
+                {
+                    if (!visited[v] && dist[v] != infinity
+                        && (u == signedCount || dist[v] < dist[u]))
+                    {
+                        u = v;
+                    }
+                }
+                if (u == signedCount || u == 2 * n + 1)
+                {
+                    break;
+                }
+                visited[u] = true;
+                for (auto [v, e]: adjacency[u])
+                {
+                    if (dist[u] + lines[e].weight < dist[v])
+                    {
+                        dist[v] = dist[u] + lines[e].weight;
+                        prevEdge[v] = (int)e;
+                        prevNode[v] = u;
+                    }
+                }
+            }
+
+            std::vector<int> path;
+            long length = 0;
+            for (uint v = 2 * n + 1; prevEdge[v] >= 0; v = prevNode[v])
+            {
+                path.push_back(prevEdge[v]);
+                length += lines[prevEdge[v]].weight;
+            }
+            if (length < shortestLength)
+            {
+                shortestLength = length;
+                shortest = path;
+            }
+        }
+
+        std::vector<char> loop(edgeCount, 0);
+        for (int e: shortest)
+        {
+            loop[e] ^= 1;
+        }
+        for (uint j = i + 1; j != witnesses.size(); ++j)
+        {
+            int parity = 0;
+            for (uint e = 0; e != edgeCount; ++e)
+            {
+                parity ^= loop[e] & witnesses[j][e];
+            }
+            if (parity)
+            {
+                for (uint e = 0; e != edgeCount; ++e)
+                {
+                    witnesses[j][e] ^= witnesses[i][e];
+                }
+            }
+        }
+        loops.push_back(shortest);
+    }
+    return loops;
+}
+
+Loops buildMesh(const Mesh& mesh,
+                Yuni::Job::QueueService* threads = nullptr,
+                const std::vector<std::vector<EdgeDefinition>>& previousMesh = {})
+{
+    Grid<Area> grid;
+    std::vector<Area> areas;
+    fillGrid(grid, areas, mesh);
+    grid.buildMesh(threads, previousMesh);
+    return grid.getMeshIndexMatrix();
+}
+
+std::vector<std::vector<EdgeDefinition>> meshDefinition(const Mesh& mesh)
+{
+    Grid<Area> grid;
+    std::vector<Area> areas;
+    fillGrid(grid, areas, mesh);
+    grid.buildMesh();
+    return grid.getMeshDefinition();
+}
+
+// Number of loops of a cycle basis: edges - nodes + connected components
+uint cycleSpaceDimension(const Mesh& edges)
+{
+    std::vector<uint> component(edges.nodeCount);
+    for (uint n = 0; n != edges.nodeCount; ++n)
+    {
+        component[n] = n;
+    }
+    uint dimension = 0;
+    for (auto& line: edges.lines)
+    {
+        uint from = component[line.origin];
+        uint to = component[line.destination];
+        if (from == to)
+        {
+            ++dimension;
+        }
+        std::replace(component.begin(), component.end(), to, from);
+    }
+    return dimension;
+}
+
+// Check that the loops are cycles of the grid, and form a basis of its cycle space
+void checkIsCycleBasis(const Mesh& mesh, const Loops& loops)
+{
+    const Mesh edges = withoutParallelLines(mesh);
+    BOOST_REQUIRE_EQUAL(loops.size(), cycleSpaceDimension(edges));
+
+    // Gaussian elimination over GF(2), on the incidence vectors of the loops
+    std::vector<std::vector<char>> rows;
+    for (auto& loop: loops)
+    {
+        std::vector<char> row(edges.lines.size(), 0);
+        std::vector<uint> degree(edges.nodeCount, 0);
+        for (int e: loop)
+        {
+            row[e] ^= 1;
+            ++degree[edges.lines[e].origin];
+            ++degree[edges.lines[e].destination];
+        }
+        BOOST_CHECK(!loop.empty());
+        BOOST_CHECK(std::all_of(degree.begin(), degree.end(), [](uint d) { return d % 2 == 0; }));
+
+        for (auto& pivotRow: rows)
+        {
+            auto pivot = std::find(pivotRow.begin(), pivotRow.end(), 1) - pivotRow.begin();
+            if (row[pivot])
+            {
+                for (uint e = 0; e != row.size(); ++e)
+                {
+                    row[e] ^= pivotRow[e];
+                }
+            }
+        }
+        BOOST_REQUIRE(std::find(row.begin(), row.end(), 1) != row.end());
+        rows.push_back(row);
+    }
+}
+
+long totalWeight(const Mesh& mesh, const Loops& loops)
+{
+    const Mesh edges = withoutParallelLines(mesh);
+    long weight = 0;
+    for (auto& loop: loops)
+    {
+        for (int e: loop)
+        {
+            weight += edges.lines[e].weight;
+        }
+    }
+    return weight;
+}
+
+// width x height nodes, each one linked to its right and bottom neighbours
+Mesh lattice(uint width, uint height, uint firstNode = 0)
+{
+    Mesh mesh;
+    mesh.nodeCount = firstNode + width * height;
+    for (uint y = 0; y != height; ++y)
+    {
+        for (uint x = 0; x != width; ++x)
+        {
+            uint n = firstNode + y * width + x;
+            if (x + 1 != width)
+            {
+                mesh.lines.push_back({n, n + 1, 1 + (long)((x * 7 + y * 3) % 4)});
+            }
+            if (y + 1 != height)
+            {
+                mesh.lines.push_back({n, n + width, 1 + (long)((x * 5 + y) % 3)});
+            }
+        }
+    }
+    return mesh;
+}
+
+Mesh ring(uint size)
+{
+    Mesh mesh;
+    mesh.nodeCount = size;
+    for (uint n = 0; n != size; ++n)
+    {
+        mesh.lines.push_back({n, (n + 1) % size, 1});
+    }
+    return mesh;
+}
+
+// A spanning tree, then random chords
+Mesh randomMesh(uint nodeCount, uint lineCount, unsigned seed)
+{
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<long> weights(1, 4);
+    Mesh mesh;
+    mesh.nodeCount = nodeCount;
+    std::set<std::pair<uint, uint>> known;
+    for (uint n = 1; n != nodeCount; ++n)
+    {
+        uint parent = std::uniform_int_distribution<uint>(0, n - 1)(random);
+        known.insert({parent, n});
+        mesh.lines.push_back({parent, n, weights(random)});
+    }
+    std::uniform_int_distribution<uint> nodes(0, nodeCount - 1);
+    while (mesh.lines.size() < lineCount)
+    {
+        uint a = nodes(random);
+        uint b = nodes(random);
+        if (a != b && known.insert(std::minmax(a, b)).second)
+        {
+            mesh.lines.push_back({a, b, weights(random)});
+        }
+    }
+    return mesh;
+}
+
+// Two lattices and a tree, without any line between them
+Mesh disconnectedMesh()
+{
+    Mesh mesh = lattice(4, 3);
+    Mesh second = lattice(3, 3, mesh.nodeCount);
+    mesh.lines.insert(mesh.lines.end(), second.lines.begin(), second.lines.end());
+    uint root = second.nodeCount;
+    mesh.nodeCount = root + 4;
+    for (uint n = root + 1; n != mesh.nodeCount; ++n)
+    {
+        mesh.lines.push_back({root, n, 2});
+    }
+    return mesh;
+}
+
+// Some lines are doubled, in both directions
+Mesh meshWithParallelLines()
+{
+    Mesh mesh = lattice(4, 4);
+    mesh.lines.push_back({5, 1, 1});
+    mesh.lines.push_back({6, 7, 3});
+    mesh.lines.push_back({0, 1, 4});
+    return mesh;
+}
+
+std::vector<Mesh> testMeshes()
+{
+    return {ring(6),
+            lattice(5, 5),
+            randomMesh(40, 80, 1),
+            randomMesh(60, 120, 2),
+            disconnectedMesh(),
+            meshWithParallelLines()};
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(basis_is_the_one_of_the_original_algorithm)
+{
+    for (const Mesh& mesh: testMeshes())
+    {
+        Loops loops = buildMesh(mesh);
+        BOOST_CHECK(loops == referenceMesh(mesh));
+        checkIsCycleBasis(mesh, loops);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(basis_searched_in_parallel_is_the_same)
+{
+    Yuni::Job::QueueService threads;
+    threads.maximumThreadCount(4);
+    threads.start();
+    for (const Mesh& mesh: testMeshes())
+    {
+        BOOST_CHECK(buildMesh(mesh, &threads) == referenceMesh(mesh));
+    }
+    threads.stop();
+}
+
+BOOST_AUTO_TEST_CASE(all_loops_are_kept_when_the_grid_has_not_changed)
+{
+    for (const Mesh& mesh: testMeshes())
+    {
+        BOOST_CHECK(buildMesh(mesh, nullptr, meshDefinition(mesh)) == referenceMesh(mesh));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(only_the_loops_crossing_a_changed_line_are_searched)
+{
+    for (const Mesh& mesh: testMeshes())
+    {
+        const auto previousMesh = meshDefinition(mesh);
+        const Loops previousLoops = referenceMesh(mesh);
+
+        // Lines indexed as the edges of the grid
+        const Mesh edges = withoutParallelLines(mesh);
+        for (long change: {+3, -1})
+        {
+            // Change the weight of a line crossed by the first loop
+            Mesh changed = edges;
+            const int line = previousLoops.front().front();
+            changed.lines[line].weight = std::max(1l, changed.lines[line].weight + change);
+
+            Loops loops = buildMesh(changed, nullptr, previousMesh);
+            checkIsCycleBasis(changed, loops);
+
+            // The loops not crossing the line come first, unchanged
+            uint kept = 0;
+            for (auto& previous: previousLoops)
+            {
+                if (std::find(previous.begin(), previous.end(), line) == previous.end())
+                {
+                    BOOST_REQUIRE_LT(kept, loops.size());
+                    BOOST_CHECK(loops[kept] == previous);
+                    ++kept;
+                }
+            }
+
+            // A heavier line does not shorten any loop: the basis is still a minimum one
+            if (change > 0)
+            {
+                BOOST_CHECK_EQUAL(totalWeight(changed, loops),
+                                  totalWeight(changed, referenceMesh(changed)));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(loops_crossing_a_removed_line_are_searched_again)
+{
+    for (const Mesh& mesh: testMeshes())
+    {
+        const auto previousMesh = meshDefinition(mesh);
+        const Loops previousLoops = referenceMesh(mesh);
+
+        // Remove a line of the last loop, and add a line
+        Mesh changed = withoutParallelLines(mesh);
+        const int line = previousLoops.back().front();
+        changed.lines.erase(changed.lines.begin() + line);
+        changed.lines.push_back({0, changed.nodeCount - 1, 2});
+
+        checkIsCycleBasis(changed, buildMesh(changed, nullptr, previousMesh));
+    }
+}
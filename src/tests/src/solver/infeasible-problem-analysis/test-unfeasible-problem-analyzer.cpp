@@ -214,6 +214,23 @@ BOOST_AUTO_TEST_CASE(analysis_should_ignore_ill_named_constraint)
     BOOST_CHECK(!analysis.hasDetectedInfeasibilityCause());
 }
 
+static const std::string illNamedConstraints[] = {"BC-name-1::hourlyish::hour<36>",
+                                                  "BC-name-2-daily::day<67>",
+                                                  "Area-FictiveLoads::area<some-area>::hour<25>",
+                                                  "AreaHydroLevel<some-area>::hour<8>"};
+
+BOOST_DATA_TEST_CASE(analysis_should_ignore_names_only_partially_matching,
+                     bdata::make(illNamedConstraints),
+                     constraintName)
+{
+    std::unique_ptr<MPSolver> unfeasibleProblem = createUnfeasibleProblem(constraintName);
+    BOOST_CHECK(unfeasibleProblem->Solve() == MPSolver::INFEASIBLE);
+
+    ConstraintSlackAnalysis analysis;
+    analysis.run(unfeasibleProblem.get());
+    BOOST_CHECK(!analysis.hasDetectedInfeasibilityCause());
+}
+
 BOOST_AUTO_TEST_CASE(analysis_should_ignore_feasible_constraints)
 {
     std::unique_ptr<MPSolver> feasibleProblem = createFeasibleProblem("BC-name::hourly::hour<36>");
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#define BOOST_TEST_MODULE test_element_names
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/optimisation/opt_rename_problem.h"
+
+namespace
+{
+struct Fixture
+{
+    Fixture()
+    {
+        problem.NombreDeVariables = 2;
+        problem.NombreDeContraintes = 1;
+        problem.DescriptionDesVariables.resize(2);
+        problem.DescriptionDesContraintes.resize(1);
+        problem.NomDesVariables.resize(2);
+        problem.NomDesContraintes.resize(1);
+    }
+
+    PROBLEME_ANTARES_A_RESOUDRE problem;
+    VariableNamer variables{problem.DescriptionDesVariables};
+    ConstraintNamer constraints{problem.DescriptionDesContraintes};
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(element_names, Fixture)
+
+BOOST_AUTO_TEST_CASE(names_are_only_built_on_demand)
+{
+    variables.UpdateArea("fr");
+    variables.UpdateTimeStep(3);
+    variables.HydProd(0);
+    BOOST_CHECK(problem.NomDesVariables[0].empty());
+
+    BuildNames(problem);
+    BOOST_CHECK_EQUAL(problem.NomDesVariables[0], "HydProd::area<fr>::hour<3>");
+    // Not described
+    BOOST_CHECK(problem.NomDesVariables[1].empty());
+}
+
+BOOST_AUTO_TEST_CASE(names_of_the_variables)
+{
+    const std::string cluster = "gas ccg";
+    const std::string storage = "battery";
+    variables.UpdateArea("fr");
+    variables.UpdateTimeStep(170);
+
+    variables.NODU(0, cluster);
+    BOOST_CHECK_EQUAL(problem.DescriptionDesVariables[0].str(),
+                      "NODU::area<fr>::ThermalCluster<gas*ccg>::hour<170>");
+    variables.NTCDirect(0, "be", "fr");
+    BOOST_CHECK_EQUAL(problem.DescriptionDesVariables[0].str(),
+                      "NTCDirect::link<be$$fr>::hour<170>");
+    variables.ShortTermStorageLevel(0, storage);
+    BOOST_CHECK_EQUAL(problem.DescriptionDesVariables[0].str(),
+                      "Level::area<fr>::ShortTermStorage<battery>::hour<170>");
+    variables.LayerStorage(0, 2);
+    BOOST_CHECK_EQUAL(problem.DescriptionDesVariables[0].str(),
+                      "LayerStorage::area<fr>::Layer<2>::hour<170>");
+}
+
+BOOST_AUTO_TEST_CASE(names_of_the_constraints)
+{
+    constraints.UpdateArea("fr");
+    constraints.UpdateTimeStep(1);
+
+    constraints.MaxPumping(0);
+    BOOST_CHECK_EQUAL(problem.DescriptionDesContraintes[0].str(), "MaxPumping::area<fr>::week<1>");
+    constraints.BindingConstraintDay(0, "bc north");
+    BOOST_CHECK_EQUAL(problem.DescriptionDesContraintes[0].str(), "bc*north::daily::day<1>");
+    constraints.BindingConstraintWeek(0, "bc");
+    BOOST_CHECK_EQUAL(problem.DescriptionDesContraintes[0].str(), "bc::weekly::week<1>");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
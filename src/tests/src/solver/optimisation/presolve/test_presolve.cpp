@@ -0,0 +1,197 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test presolve of the linear problems
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/optimisation/LinearProblemPresolve.h"
+#include "antares/solver/optimisation/opt_structure_probleme_a_resoudre.h"
+
+extern "C"
+{
+#include "spx_definition_arguments.h"
+}
+
+using Antares::Optimization::LinearProblemPresolve;
+
+namespace
+{
+void addConstraint(PROBLEME_ANTARES_A_RESOUDRE& problem,
+                   const std::vector<int>& columns,
+                   const std::vector<double>& coefficients,
+                   char sense,
+                   double rhs)
+{
+    problem.IndicesDebutDeLigne.push_back((int)problem.IndicesColonnes.size());
+    problem.NombreDeTermesDesLignes.push_back((int)columns.size());
+    problem.IndicesColonnes.insert(problem.IndicesColonnes.end(), columns.begin(), columns.end());
+    problem.CoefficientsDeLaMatriceDesContraintes.insert(
+      problem.CoefficientsDeLaMatriceDesContraintes.end(),
+      coefficients.begin(),
+      coefficients.end());
+    problem.Sens.push_back(sense);
+    problem.SecondMembre.push_back(rhs);
+    problem.NombreDeContraintes++;
+}
+
+// x0 in [2, 2], x1 in [0, 10], x2 in [0, 10]
+// c0: x0 + x1 <= 5
+// c1: 3 x0 = 6
+// c2: x1 + 2 x2 >= 1
+struct Fixture
+{
+    Fixture()
+    {
+        problem.NombreDeVariables = 3;
+        problem.NombreDeContraintes = 0;
+        problem.CoutLineaire = {4., 1., 2.};
+        problem.TypeDeVariable.assign(3, VARIABLE_BORNEE_DES_DEUX_COTES);
+        problem.Xmin = {2., 0., 0.};
+        problem.Xmax = {2., 10., 10.};
+        problem.X.assign(3, 0.);
+        problem.CoutsReduits.assign(3, 0.);
+        problem.PositionDeLaVariable.assign(3, 0);
+        problem.NomDesVariables = {"x0", "x1", "x2"};
+        problem.VariablesEntieres.assign(3, false);
+
+        addConstraint(problem, {0, 1}, {1., 1.}, '<', 5.);
+        addConstraint(problem, {0}, {3.}, '=', 6.);
+        addConstraint(problem, {1, 2}, {1., 2.}, '>', 1.);
+        problem.CoutsMarginauxDesContraintes.assign(3, -1.);
+        problem.ComplementDeLaBase.assign(3, 0);
+        problem.NomDesContraintes = {"c0", "c1", "c2"};
+    }
+
+    PROBLEME_ANTARES_A_RESOUDRE problem;
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(presolve, Fixture)
+
+BOOST_AUTO_TEST_CASE(fixed_variables_and_empty_constraints_are_removed)
+{
+    LinearProblemPresolve presolve;
+    BOOST_CHECK(!presolve.matches(problem));
+
+    presolve.build(problem);
+    BOOST_REQUIRE(presolve.update(problem));
+
+    const auto& reduced = presolve.reducedProblem();
+    BOOST_CHECK_EQUAL(presolve.removedVariables(), 1);
+    BOOST_CHECK_EQUAL(presolve.removedConstraints(), 1);
+    BOOST_CHECK_EQUAL(reduced.NombreDeVariables, 2);
+    BOOST_CHECK_EQUAL(reduced.NombreDeContraintes, 2);
+    BOOST_CHECK_EQUAL(reduced.NomDesVariables[0], "x1");
+    BOOST_CHECK_EQUAL(reduced.NomDesContraintes[1], "c2");
+
+    // x0 moved to the right-hand side of c0
+    BOOST_CHECK_EQUAL(reduced.NombreDeTermesDesLignes[0], 1);
+    BOOST_CHECK_EQUAL(reduced.IndicesColonnes[reduced.IndicesDebutDeLigne[0]], 0);
+    BOOST_CHECK_CLOSE(reduced.SecondMembre[0], 3., 1e-9);
+    BOOST_CHECK_CLOSE(reduced.SecondMembre[1], 1., 1e-9);
+    BOOST_CHECK_CLOSE(reduced.CoutLineaire[1], 2., 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(structure_is_kept_while_the_removed_variables_stay_fixed)
+{
+    LinearProblemPresolve presolve;
+    presolve.build(problem);
+
+    // Fixed to another value: the right-hand sides change, not the structure
+    problem.Xmin[0] = problem.Xmax[0] = 1.;
+    problem.SecondMembre[1] = 3.;
+    BOOST_CHECK(presolve.matches(problem));
+    BOOST_REQUIRE(presolve.update(problem));
+    BOOST_CHECK_CLOSE(presolve.reducedProblem().SecondMembre[0], 4., 1e-9);
+
+    // A removed constraint which is not satisfied
+    problem.SecondMembre[1] = 6.;
+    BOOST_CHECK(!presolve.update(problem));
+
+    // A removed variable which is not fixed anymore
+    problem.Xmax[0] = 2.;
+    BOOST_CHECK(!presolve.matches(problem));
+}
+
+BOOST_AUTO_TEST_CASE(solution_is_given_back_to_the_complete_problem)
+{
+    LinearProblemPresolve presolve;
+    presolve.build(problem);
+    BOOST_REQUIRE(presolve.update(problem));
+
+    auto& reduced = presolve.reducedProblem();
+    reduced.ExistenceDUneSolution = OUI_SPX;
+    reduced.X = {0.5, 0.25};
+    reduced.CoutsReduits = {0., 0.};
+    reduced.CoutsMarginauxDesContraintes = {-3., 1.};
+
+    presolve.postsolve(problem);
+
+    BOOST_CHECK_EQUAL(problem.ExistenceDUneSolution, OUI_SPX);
+    BOOST_CHECK_CLOSE(problem.X[0], 2., 1e-9);
+    BOOST_CHECK_CLOSE(problem.X[1], 0.5, 1e-9);
+    BOOST_CHECK_CLOSE(problem.X[2], 0.25, 1e-9);
+
+    BOOST_CHECK_CLOSE(problem.CoutsMarginauxDesContraintes[0], -3., 1e-9);
+    BOOST_CHECK_EQUAL(problem.CoutsMarginauxDesContraintes[1], 0.);
+    BOOST_CHECK_CLOSE(problem.CoutsMarginauxDesContraintes[2], 1., 1e-9);
+
+    // Cost of x0 minus the marginal cost of c0, x0 being on its lower bound
+    BOOST_CHECK_CLOSE(problem.CoutsReduits[0], 7., 1e-9);
+    BOOST_CHECK_EQUAL(problem.PositionDeLaVariable[0], HORS_BASE_SUR_BORNE_INF);
+}
+
+BOOST_AUTO_TEST_CASE(redundant_constraints_are_removed_while_they_stay_redundant)
+{
+    // c3: x1 + x2 <= 25, satisfied within the bounds of x1 and x2
+    addConstraint(problem, {1, 2}, {1., 1.}, '<', 25.);
+    problem.CoutsMarginauxDesContraintes.push_back(-1.);
+    problem.ComplementDeLaBase.push_back(0);
+    problem.NomDesContraintes.push_back("c3");
+
+    LinearProblemPresolve presolve;
+    presolve.build(problem);
+    BOOST_REQUIRE(presolve.update(problem));
+    BOOST_CHECK_EQUAL(presolve.removedConstraints(), 2);
+    BOOST_CHECK_EQUAL(presolve.reducedProblem().NombreDeContraintes, 2);
+
+    auto& reduced = presolve.reducedProblem();
+    reduced.ExistenceDUneSolution = OUI_SPX;
+    reduced.X = {0.5, 0.25};
+    reduced.CoutsReduits = {0., 0.};
+    reduced.CoutsMarginauxDesContraintes = {-3., 1.};
+    presolve.postsolve(problem);
+    BOOST_CHECK_EQUAL(problem.CoutsMarginauxDesContraintes[3], 0.);
+
+    // Down to 20, c3 may still be removed
+    problem.SecondMembre[3] = 20.;
+    BOOST_CHECK(presolve.matches(problem));
+
+    // Below 20, c3 must be given to the solver
+    problem.SecondMembre[3] = 15.;
+    BOOST_CHECK(!presolve.matches(problem));
+    presolve.build(problem);
+    BOOST_CHECK_EQUAL(presolve.removedConstraints(), 1);
+    BOOST_CHECK_EQUAL(presolve.reducedProblem().NombreDeContraintes, 3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test start-up costs min number of units
+#define WIN32_LEAN_AND_MEAN
+
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/optimisation/opt_fonctions.h"
+#include "antares/solver/simulation/sim_structure_probleme_economique.h"
+
+namespace
+{
+PROBLEME_HEBDO makeProblem(int nbTimeSteps, int minUpDuration, int minDownDuration)
+{
+    PROBLEME_HEBDO problem;
+    problem.NombreDePasDeTemps = nbTimeSteps;
+
+    problem.PaliersThermiquesDuPays.resize(1);
+    PALIERS_THERMIQUES& clusters = problem.PaliersThermiquesDuPays[0];
+    clusters.NombreDePaliersThermiques = 1;
+    clusters.DureeMinimaleDeMarcheDUnGroupeDuPalierThermique = {minUpDuration};
+    clusters.DureeMinimaleDArretDUnGroupeDuPalierThermique = {minDownDuration};
+    clusters.PuissanceDisponibleEtCout.resize(1);
+    clusters.PuissanceDisponibleEtCout[0].NombreMaxDeGroupesEnMarcheDuPalierThermique.assign(
+      nbTimeSteps,
+      0);
+
+    problem.ResultatsHoraires.resize(1);
+    auto& production = problem.ResultatsHoraires[0].ProductionThermique;
+    production.resize(nbTimeSteps);
+    for (auto& hour: production)
+    {
+        hour.NombreDeGroupesQuiDemarrentDuPalier.assign(1, 0.);
+        hour.NombreDeGroupesQuiSArretentDuPalier.assign(1, 0.);
+        hour.NombreDeGroupesQuiTombentEnPanneDuPalier.assign(1, 0.);
+    }
+    return problem;
+}
+
+std::vector<int>& maxNumberOfUnits(PROBLEME_HEBDO& problem)
+{
+    return problem.PaliersThermiquesDuPays[0]
+      .PuissanceDisponibleEtCout[0]
+      .NombreMaxDeGroupesEnMarcheDuPalierThermique;
+}
+
+std::vector<int> adjust(PROBLEME_HEBDO& problem,
+                        std::vector<int> minNumberOfUnits,
+                        bool alwaysSolve)
+{
+    OPT_PbLineairePourAjusterLeNombreMinDeGroupesDemarresCoutsDeDemarrage(&problem,
+                                                                          minNumberOfUnits,
+                                                                          0,
+                                                                          0,
+                                                                          alwaysSolve);
+    return minNumberOfUnits;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(unit_started_for_one_hour_is_kept_running_for_the_min_up_duration)
+{
+    PROBLEME_HEBDO problem = makeProblem(24, 3, 1);
+    maxNumberOfUnits(problem).assign(24, 2);
+
+    std::vector<int> minNumberOfUnits(24, 0);
+    minNumberOfUnits[1] = 1;
+
+    std::vector<int> expected(24, 0);
+    expected[1] = expected[2] = expected[3] = 1;
+
+    BOOST_CHECK(adjust(problem, minNumberOfUnits, false) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(min_number_of_units_already_satisfying_durations_is_left_unchanged)
+{
+    PROBLEME_HEBDO problem = makeProblem(24, 4, 4);
+    maxNumberOfUnits(problem).assign(24, 3);
+
+    std::vector<int> minNumberOfUnits(24, 1);
+    for (int hour = 8; hour < 16; ++hour)
+    {
+        minNumberOfUnits[hour] = 3;
+    }
+
+    BOOST_CHECK(adjust(problem, minNumberOfUnits, false) == minNumberOfUnits);
+    BOOST_CHECK(adjust(problem, minNumberOfUnits, true) == minNumberOfUnits);
+}
+
+// Skipping the linear problem must not change anything: compare with a forced resolution on
+// random weeks, with and without feasible rounded solutions
+BOOST_AUTO_TEST_CASE(skipping_the_linear_problem_gives_the_same_results)
+{
+    constexpr int nbTimeSteps = 168;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> duration(1, 12);
+    std::uniform_int_distribution<int> units(0, 4);
+    std::uniform_int_distribution<int> blockLength(1, 24);
+
+    for (int draw = 0; draw < 200; ++draw)
+    {
+        PROBLEME_HEBDO problem = makeProblem(nbTimeSteps, duration(gen), duration(gen));
+
+        std::vector<int>& maxUnits = maxNumberOfUnits(problem);
+        std::vector<int> minNumberOfUnits(nbTimeSteps);
+        int maxLevel = 0;
+        int minLevel = 0;
+        int remainingHours = 0;
+        for (int hour = 0; hour < nbTimeSteps; ++hour, --remainingHours)
+        {
+            if (remainingHours == 0)
+            {
+                remainingHours = blockLength(gen);
+                maxLevel = 1 + units(gen);
+                minLevel = units(gen) % (maxLevel + 1);
+            }
+            maxUnits[hour] = maxLevel;
+            minNumberOfUnits[hour] = minLevel;
+        }
+
+        BOOST_CHECK(adjust(problem, minNumberOfUnits, false)
+                    == adjust(problem, minNumberOfUnits, true));
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE sharding
+#define WIN32_LEAN_AND_MEAN
+
+#include <algorithm>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/antares/fatal-error.h>
+#include "antares/solver/simulation/sharding.h"
+
+using namespace Antares::Solver::Simulation;
+using MinMaxValues = std::vector<Antares::Solver::Variable::R::AllYears::MinMaxData::Data>;
+
+BOOST_AUTO_TEST_SUITE(shard_years)
+
+BOOST_AUTO_TEST_CASE(shards_are_contiguous_blocks_of_the_playlist)
+{
+    // Performed years: 0, 2, 3, 5, 6
+    const std::vector<bool> playlist{true, false, true, true, false, true, true};
+
+    BOOST_CHECK((shardYearsFilter(playlist, 0, 2)
+                 == std::vector<bool>{true, false, true, false, false, false, false}));
+    BOOST_CHECK((shardYearsFilter(playlist, 1, 2)
+                 == std::vector<bool>{false, false, false, true, false, true, true}));
+}
+
+BOOST_AUTO_TEST_CASE(shards_cover_the_playlist_exactly_once)
+{
+    const std::vector<bool> playlist(10, true);
+    const uint count = 3;
+    std::vector<uint> performed(playlist.size(), 0);
+    for (uint i = 0; i != count; ++i)
+    {
+        auto filter = shardYearsFilter(playlist, i, count);
+        for (uint y = 0; y != filter.size(); ++y)
+        {
+            performed[y] += filter[y];
+        }
+    }
+    BOOST_CHECK(std::ranges::all_of(performed, [](uint n) { return n == 1; }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(shard_accumulators)
+
+BOOST_AUTO_TEST_CASE(accumulators_are_added_and_extrema_merged)
+{
+    double sums[2] = {1., 2.};
+    MinMaxValues minimums{{5., 1}, {3., 2}};
+    double highest = 10.;
+
+    AccumulatorsWriter writer({1, 2, 4, 4});
+    writer.sum(sums, 2);
+    writer.minimum(minimums);
+    writer.maximum(highest);
+
+    double merged[2] = {10., 20.};
+    MinMaxValues mergedMinimums{{4., 3}, {3. + 1e-8, 4}};
+    double mergedHighest = 7.;
+
+    AccumulatorsMerger merger(writer.content(), "test");
+    BOOST_CHECK_EQUAL(merger.header().index, 1);
+    BOOST_CHECK_EQUAL(merger.header().count, 2);
+    merger.sum(merged, 2);
+    merger.minimum(mergedMinimums);
+    merger.maximum(mergedHighest);
+    BOOST_CHECK_NO_THROW(merger.checkAllMerged());
+
+    BOOST_CHECK_EQUAL(merged[0], 11.);
+    BOOST_CHECK_EQUAL(merged[1], 22.);
+    // Not lower than the current minimum
+    BOOST_CHECK_EQUAL(mergedMinimums[0].indice, 3);
+    // Equal within the tolerance: the first MC year found is kept
+    BOOST_CHECK_EQUAL(mergedMinimums[1].indice, 4);
+    BOOST_CHECK_EQUAL(mergedHighest, 10.);
+}
+
+BOOST_AUTO_TEST_CASE(accumulators_not_matching_the_study_are_rejected)
+{
+    double sums[2] = {1., 2.};
+    AccumulatorsWriter writer({0, 1, 4, 4});
+    writer.sum(sums, 2);
+
+    double more[3] = {0., 0., 0.};
+    AccumulatorsMerger tooLong(writer.content(), "test");
+    BOOST_CHECK_THROW(tooLong.sum(more, 3), Antares::FatalError);
+
+    AccumulatorsMerger tooShort(writer.content(), "test");
+    tooShort.sum(more, 1);
+    BOOST_CHECK_THROW(tooShort.checkAllMerged(), Antares::FatalError);
+
+    BOOST_CHECK_THROW(AccumulatorsMerger("garbage", "test"), Antares::FatalError);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,254 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE thermal cluster aggregation
+#define WIN32_LEAN_AND_MEAN
+
+#include <cmath>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/study/study.h>
+#include "antares/solver/simulation/sim_structure_probleme_economique.h"
+#include "antares/solver/simulation/thermal_cluster_aggregation.h"
+
+using namespace Antares::Data;
+
+struct StudyFixture
+{
+    StudyFixture()
+    {
+        area = study->areaAdd("area");
+    }
+
+    std::shared_ptr<ThermalCluster> addCluster(const std::string& name,
+                                               double marketBidCost,
+                                               double availablePower)
+    {
+        auto cluster = std::make_shared<ThermalCluster>(area);
+        cluster->setName(name);
+        cluster->index = area->thermal.list.enabledAndNotMustRunCount();
+        cluster->nominalCapacityWithSpinning = 100.;
+        cluster->unitCount = static_cast<uint>(std::ceil(availablePower / 100.));
+        cluster->minStablePower = 20.;
+        cluster->marketBidCost = marketBidCost;
+        cluster->modulation.reset(thermalModulationMax, HOURS_PER_YEAR, true);
+        cluster->modulation.fill(1.);
+        cluster->series.timeSeries.resize(1, HOURS_PER_YEAR);
+        cluster->series.timeSeries.fill(availablePower);
+        area->thermal.list.addToCompleteList(cluster);
+        return cluster;
+    }
+
+    //! Weekly problem of the area, the first results being those of the aggregated clusters
+    static PROBLEME_HEBDO makeProblem(uint nbHours, uint nbClusters)
+    {
+        PROBLEME_HEBDO problem;
+        problem.NombreDePasDeTemps = nbHours;
+        problem.NombreDePasDeTempsPourUneOptimisation = nbHours;
+        problem.ResultatsHoraires.resize(1);
+        auto& results = problem.ResultatsHoraires[0].ProductionThermique;
+        results.resize(nbHours);
+        for (auto& hourly: results)
+        {
+            hourly.ProductionThermiqueDuPalier.assign(nbClusters, 0.);
+            hourly.NombreDeGroupesEnMarcheDuPalier.assign(nbClusters, 0.);
+            hourly.NombreDeGroupesQuiDemarrentDuPalier.assign(nbClusters, 0.);
+            hourly.NombreDeGroupesQuiSArretentDuPalier.assign(nbClusters, 0.);
+            hourly.NombreDeGroupesQuiTombentEnPanneDuPalier.assign(nbClusters, 0.);
+        }
+        return problem;
+    }
+
+    Study::Ptr study = std::make_shared<Study>();
+    Area* area = nullptr;
+};
+
+BOOST_FIXTURE_TEST_SUITE(thermal_cluster_aggregation, StudyFixture)
+
+BOOST_AUTO_TEST_CASE(identical_clusters_are_merged_in_the_order_of_the_clusters)
+{
+    auto a = addCluster("a", 50., 100.);
+    auto b = addCluster("b", 80., 100.);
+    auto c = addCluster("c", 50., 300.);
+    auto d = addCluster("d", 80., 100.);
+    d->minUpTime = 5;
+
+    ThermalClusterAggregation aggregation(study->areas, {});
+
+    BOOST_CHECK_EQUAL(aggregation.totalClusterCount(), 4u);
+    BOOST_CHECK_EQUAL(aggregation.totalAggregateCount(), 3u);
+    BOOST_CHECK_EQUAL(aggregation.aggregateCount(area->index), 3u);
+
+    BOOST_CHECK_EQUAL(aggregation.aggregateOf(area->index, a->index), 0u);
+    BOOST_CHECK_EQUAL(aggregation.aggregateOf(area->index, b->index), 1u);
+    BOOST_CHECK_EQUAL(aggregation.aggregateOf(area->index, c->index), 0u);
+    BOOST_CHECK_EQUAL(aggregation.aggregateOf(area->index, d->index), 2u);
+
+    const auto& merged = aggregation.clustersOf(area->index, 0);
+    BOOST_REQUIRE_EQUAL(merged.size(), 2u);
+    BOOST_CHECK(merged[0] == a.get());
+    BOOST_CHECK(merged[1] == c.get());
+}
+
+BOOST_AUTO_TEST_CASE(clusters_with_different_market_bid_modulations_are_not_merged)
+{
+    addCluster("a", 50., 100.);
+    auto b = addCluster("b", 50., 100.);
+    b->modulation[thermalModulationMarketBid][10] = 2.;
+
+    ThermalClusterAggregation aggregation(study->areas, {});
+
+    BOOST_CHECK_EQUAL(aggregation.aggregateCount(area->index), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(generation_is_split_pro_rata_of_the_available_power)
+{
+    auto a = addCluster("a", 50., 100.);
+    auto b = addCluster("b", 50., 300.);
+    a->series.timeSeries[0][1] = 0.;
+    b->series.timeSeries[0][1] = 0.;
+
+    ThermalClusterAggregation aggregation(study->areas, {});
+
+    PROBLEME_HEBDO problem = makeProblem(2, 2);
+    auto& results = problem.ResultatsHoraires[0].ProductionThermique;
+    results[0].ProductionThermiqueDuPalier[0] = 200.;
+    results[1].ProductionThermiqueDuPalier[0] = 60.;
+
+    aggregation.disaggregate(problem, 0, 0);
+
+    BOOST_CHECK_CLOSE(results[0].ProductionThermiqueDuPalier[a->index], 50., 1e-9);
+    BOOST_CHECK_CLOSE(results[0].ProductionThermiqueDuPalier[b->index], 150., 1e-9);
+    // Nothing available, the clusters share equally
+    BOOST_CHECK_CLOSE(results[1].ProductionThermiqueDuPalier[a->index], 30., 1e-9);
+    BOOST_CHECK_CLOSE(results[1].ProductionThermiqueDuPalier[b->index], 30., 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(results_are_split_back_between_the_clusters)
+{
+    auto a = addCluster("a", 50., 100.);
+    auto b = addCluster("b", 80., 200.);
+    auto c = addCluster("c", 50., 300.);
+
+    ThermalClusterAggregation aggregation(study->areas, {});
+
+    PROBLEME_HEBDO problem = makeProblem(1, 3);
+    auto& results = problem.ResultatsHoraires[0].ProductionThermique;
+    results[0].ProductionThermiqueDuPalier = {200., 150., 0.};
+    results[0].NombreDeGroupesEnMarcheDuPalier = {3., 1.5, 0.};
+    results[0].NombreDeGroupesQuiDemarrentDuPalier = {0., 0.5, 0.};
+
+    aggregation.disaggregate(problem, 0, 0);
+
+    const auto& production = results[0].ProductionThermiqueDuPalier;
+    BOOST_CHECK_CLOSE(production[a->index], 50., 1e-9);
+    BOOST_CHECK_CLOSE(production[b->index], 150., 1e-9);
+    BOOST_CHECK_CLOSE(production[c->index], 150., 1e-9);
+
+    // The fewest units producing the share of each merged cluster
+    const auto& unitsOn = results[0].NombreDeGroupesEnMarcheDuPalier;
+    BOOST_CHECK_EQUAL(unitsOn[a->index], 1.);
+    BOOST_CHECK_EQUAL(unitsOn[c->index], 2.);
+
+    // A cluster left alone keeps the results of the optimization
+    BOOST_CHECK_EQUAL(unitsOn[b->index], 1.5);
+    BOOST_CHECK_EQUAL(results[0].NombreDeGroupesQuiDemarrentDuPalier[b->index], 0.5);
+}
+
+BOOST_AUTO_TEST_CASE(units_on_of_clusters_of_unequal_sizes_do_not_exceed_their_unit_count)
+{
+    auto a = addCluster("a", 50., 100.);
+    auto b = addCluster("b", 50., 400.);
+    auto c = addCluster("c", 50., 150.);
+    // Derated: the available power of c exceeds its units
+    c->unitCount = 1;
+
+    ThermalClusterAggregation aggregation(study->areas, {});
+    BOOST_REQUIRE_EQUAL(aggregation.aggregateCount(area->index), 1u);
+
+    PROBLEME_HEBDO problem = makeProblem(1, 3);
+    auto& results = problem.ResultatsHoraires[0].ProductionThermique;
+    results[0].ProductionThermiqueDuPalier[0] = 650.;
+    results[0].NombreDeGroupesEnMarcheDuPalier[0] = 7.;
+
+    aggregation.disaggregate(problem, 0, 0);
+
+    const auto& unitsOn = results[0].NombreDeGroupesEnMarcheDuPalier;
+    BOOST_CHECK_EQUAL(unitsOn[a->index], 1.);
+    BOOST_CHECK_EQUAL(unitsOn[b->index], 4.);
+    BOOST_CHECK_EQUAL(unitsOn[c->index], 1.);
+    for (const auto& cluster: {a, b, c})
+    {
+        BOOST_CHECK_LE(unitsOn[cluster->index], cluster->unitCount);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(starting_and_stopping_units_follow_the_units_on_of_each_cluster)
+{
+    auto a = addCluster("a", 50., 100.);
+    auto b = addCluster("b", 50., 300.);
+
+    ThermalClusterAggregation aggregation(study->areas, {});
+
+    PROBLEME_HEBDO problem = makeProblem(3, 2);
+    auto& results = problem.ResultatsHoraires[0].ProductionThermique;
+    const std::vector<double> production = {400., 200., 0.};
+    const std::vector<double> unitsOn = {4., 2., 0.};
+    const std::vector<double> starting = {4., 0., 0.};
+    const std::vector<double> stopping = {0., 2., 2.};
+    const std::vector<double> breakingDown = {0., 1., 2.};
+    for (uint h = 0; h != 3; ++h)
+    {
+        results[h].ProductionThermiqueDuPalier[0] = production[h];
+        results[h].NombreDeGroupesEnMarcheDuPalier[0] = unitsOn[h];
+        results[h].NombreDeGroupesQuiDemarrentDuPalier[0] = starting[h];
+        results[h].NombreDeGroupesQuiSArretentDuPalier[0] = stopping[h];
+        results[h].NombreDeGroupesQuiTombentEnPanneDuPalier[0] = breakingDown[h];
+    }
+
+    aggregation.disaggregate(problem, 0, 0);
+
+    // a: 1, 1, 0 units ON, b: 3, 2, 0, the first hour following the last one
+    const std::vector<std::vector<double>> expectedUnitsOn = {{1., 3.}, {1., 2.}, {0., 0.}};
+    const std::vector<std::vector<double>> expectedStarting = {{1., 3.}, {0., 0.}, {0., 0.}};
+    const std::vector<std::vector<double>> expectedStopping = {{0., 0.}, {0., 1.}, {1., 2.}};
+    // Pro rata of the available power, rounded up and limited to the stopping units
+    const std::vector<std::vector<double>> expectedBreakingDown = {{0., 0.},
+                                                                   {0., 1.},
+                                                                   {1., 2.}};
+    for (uint h = 0; h != 3; ++h)
+    {
+        for (const auto& cluster: {a, b})
+        {
+            const uint c = cluster->index;
+            BOOST_CHECK_EQUAL(results[h].NombreDeGroupesEnMarcheDuPalier[c],
+                              expectedUnitsOn[h][c]);
+            BOOST_CHECK_EQUAL(results[h].NombreDeGroupesQuiDemarrentDuPalier[c],
+                              expectedStarting[h][c]);
+            BOOST_CHECK_EQUAL(results[h].NombreDeGroupesQuiSArretentDuPalier[c],
+                              expectedStopping[h][c]);
+            BOOST_CHECK_EQUAL(results[h].NombreDeGroupesQuiTombentEnPanneDuPalier[c],
+                              expectedBreakingDown[h][c]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE weekly inputs
+#define WIN32_LEAN_AND_MEAN
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/simulation/simulation.h"
+
+#include "in-memory-study.h"
+
+using namespace Antares::Data;
+
+namespace
+{
+const unsigned int nbHoursInAWeek = Antares::Constants::nbHoursInAWeek;
+
+// Every input of the second week differs from one area and one hour to another
+double loadAt(unsigned int area, unsigned int hour)
+{
+    return 1000. + 100. * area + hour;
+}
+
+double rorAt(unsigned int area, unsigned int hour)
+{
+    return 10. * area + hour % 24;
+}
+
+double miscGenAt(unsigned int area, unsigned int hour)
+{
+    return area + hour % 7;
+}
+
+double mustrunAt(unsigned int area, unsigned int hour)
+{
+    return 2. * area + hour % 5;
+}
+
+double renewableAt(unsigned int area, unsigned int cluster, unsigned int hour)
+{
+    return 3. * area + 5. * cluster + hour % 11;
+}
+
+// Two linked areas having run-of-river, misc generation and two renewable clusters, the flow on
+// the link being bounded by an hourly binding constraint
+struct WeeklyInputsFixture: public StudyBuilder
+{
+    WeeklyInputsFixture()
+    {
+        simulationBetweenDays(0, 14);
+        study->parameters.renewableGeneration.toClusters();
+
+        for (unsigned int k = 0; k != nbAreas; ++k)
+        {
+            Area* area = addAreaToStudy("area " + std::to_string(k));
+            TimeSeriesConfigurer(area->load.series.timeSeries).setColumnCount(1);
+            TimeSeriesConfigurer(area->hydro.series->ror.timeSeries).setColumnCount(1);
+            for (unsigned int h = 0; h != HOURS_PER_YEAR; ++h)
+            {
+                area->load.series.timeSeries[0][h] = loadAt(k, h);
+                area->hydro.series->ror.timeSeries[0][h] = rorAt(k, h);
+                area->miscGen[0][h] = miscGenAt(k, h);
+            }
+
+            for (unsigned int c = 0; c != 2; ++c)
+            {
+                auto cluster = std::make_shared<RenewableCluster>(area);
+                cluster->setName("renewable " + std::to_string(c));
+                cluster->tsMode = RenewableCluster::powerGeneration;
+                TimeSeriesConfigurer(cluster->series.timeSeries).setColumnCount(1);
+                for (unsigned int h = 0; h != HOURS_PER_YEAR; ++h)
+                {
+                    cluster->series.timeSeries[0][h] = renewableAt(k, c, h);
+                }
+                area->renewable.list.addToCompleteList(cluster);
+            }
+            areas.push_back(area);
+        }
+
+        AreaLink* link = AreaAddLinkBetweenAreas(areas[0], areas[1]);
+        configureLinkCapacities(link);
+        auto bc = addBindingConstraints(*study, "bc", "group");
+        bc->weight(link, 1);
+        bc->enabled(true);
+        bc->setTimeGranularity(BindingConstraint::typeHourly);
+        bc->operatorType(BindingConstraint::opLess);
+        TimeSeriesConfigurer(bc->RHSTimeSeries()).setColumnCount(1);
+        for (unsigned int h = 0; h != HOURS_PER_YEAR; ++h)
+        {
+            bc->RHSTimeSeries()[0][h] = 50. + h;
+        }
+
+        setNumberMCyears(1);
+        study->bindingConstraintsGroups.resizeAllTimeseriesNumbers(1);
+        simulation->create();
+
+        // Usually computed by the simulation from the thermal clusters in must-run mode
+        for (unsigned int k = 0; k != nbAreas; ++k)
+        {
+            for (unsigned int h = 0; h != HOURS_PER_YEAR; ++h)
+            {
+                areas[k]->scratchpad[0].mustrunSum[h] = mustrunAt(k, h);
+            }
+        }
+    }
+
+    // Fill the weekly problem with the inputs of the second week
+    PROBLEME_HEBDO& secondWeek()
+    {
+        SIM_InitialisationProblemeHebdo(*study, problem, nbHoursInAWeek, 0);
+        problem.year = 0;
+        HYDRO_VENTILATION_RESULTS hydroVentilationResults(nbAreas);
+        for (auto& results: hydroVentilationResults)
+        {
+            results.HydrauliqueModulableQuotidien.assign(DAYS_PER_YEAR, 0.);
+        }
+        SIM_RenseignementProblemeHebdo(*study,
+                                       problem,
+                                       1,
+                                       nbHoursInAWeek,
+                                       hydroVentilationResults,
+                                       study->areas.buildScratchMap(0));
+        return problem;
+    }
+
+    static constexpr unsigned int nbAreas = 2;
+    std::vector<Area*> areas;
+    PROBLEME_HEBDO problem;
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(weekly_inputs, WeeklyInputsFixture)
+
+BOOST_AUTO_TEST_CASE(must_run_generation_and_net_load_are_read_for_each_area_and_hour)
+{
+    const auto& week = secondWeek();
+    for (unsigned int k = 0; k != nbAreas; ++k)
+    {
+        for (unsigned int hour = 0; hour != nbHoursInAWeek; ++hour)
+        {
+            const unsigned int h = nbHoursInAWeek + hour;
+            const double mustRun = miscGenAt(k, h) + rorAt(k, h) + mustrunAt(k, h)
+                                   + renewableAt(k, 0, h) + renewableAt(k, 1, h);
+            BOOST_CHECK_EQUAL(week.AllMustRunGeneration[hour].AllMustRunGenerationOfArea[k],
+                              mustRun);
+            BOOST_CHECK_EQUAL(week.ConsommationsAbattues[hour].ConsommationAbattueDuPays[k],
+                              loadAt(k, h) - mustRun);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hourly_rhs_of_the_binding_constraints_are_those_of_the_week)
+{
+    BOOST_REQUIRE_EQUAL(study->bindingConstraints.activeConstraints().size(), 1);
+
+    const auto& rhs = secondWeek().MatriceDesContraintesCouplantes[0]
+                        .SecondMembreDeLaContrainteCouplante;
+    for (unsigned int hour = 0; hour != nbHoursInAWeek; ++hour)
+    {
+        BOOST_CHECK_EQUAL(rhs[hour], 50. + nbHoursInAWeek + hour);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
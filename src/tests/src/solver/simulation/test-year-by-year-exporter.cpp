@@ -0,0 +1,150 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+
+#define BOOST_TEST_MODULE year_by_year_exporter
+#define WIN32_LEAN_AND_MEAN
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/simulation/year_by_year_exporter.h"
+
+using namespace Antares::Solver::Simulation;
+
+namespace
+{
+constexpr uint nbSpaces = 2;
+constexpr uint nbYears = 6;
+
+// The results of the years computed in each space, exported as year -> values
+struct Spaces
+{
+    std::vector<std::vector<double>> values = std::vector<std::vector<double>>(nbSpaces);
+    std::map<uint, std::vector<double>> exported;
+    std::mutex mutex;
+
+    // What a year job does before handing its results over to the exporter
+    void compute(uint year, uint space)
+    {
+        values[space].assign(10, 0.);
+        for (uint i = 0; i != values[space].size(); ++i)
+        {
+            values[space][i] = 100. * year + i;
+        }
+    }
+
+    void write(uint year, uint space)
+    {
+        std::lock_guard lock(mutex);
+        exported[year] = values[space];
+    }
+};
+
+// The years exported synchronously, right after being computed
+std::map<uint, std::vector<double>> synchronousExport()
+{
+    Spaces spaces;
+    for (uint year = 0; year != nbYears; ++year)
+    {
+        spaces.compute(year, year % nbSpaces);
+        spaces.write(year, year % nbSpaces);
+    }
+    return spaces.exported;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(exports_in_the_background_match_the_synchronous_ones)
+{
+    Spaces spaces;
+    {
+        YearByYearExporter exporter(nbSpaces);
+        for (uint year = 0; year != nbYears; ++year)
+        {
+            uint space = year % nbSpaces;
+            exporter.waitFor(space);
+            spaces.compute(year, space);
+            exporter.add(space,
+                         [&spaces, year, space]
+                         {
+                             std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                             spaces.write(year, space);
+                         });
+        }
+        exporter.waitAll();
+    }
+    BOOST_CHECK(spaces.exported == synchronousExport());
+}
+
+BOOST_AUTO_TEST_CASE(a_space_is_not_reused_before_the_end_of_its_pending_export)
+{
+    Spaces spaces;
+    YearByYearExporter exporter(nbSpaces);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    // The export of the first year is stuck until released
+    spaces.compute(0, 0);
+    exporter.add(0,
+                 [&spaces, released]
+                 {
+                     released.wait();
+                     spaces.write(0, 0);
+                 });
+
+    // The next year of the same space
+    std::atomic<bool> nextYearStarted = false;
+    std::thread nextYear(
+      [&]
+      {
+          exporter.waitFor(0);
+          nextYearStarted = true;
+          spaces.compute(2, 0);
+          exporter.add(0, [&spaces] { spaces.write(2, 0); });
+      });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    BOOST_CHECK(!nextYearStarted);
+
+    release.set_value();
+    nextYear.join();
+    exporter.waitAll();
+
+    BOOST_CHECK(nextYearStarted);
+    auto expected = synchronousExport();
+    BOOST_CHECK(spaces.exported[0] == expected[0]);
+    BOOST_CHECK(spaces.exported[2] == expected[2]);
+}
+
+BOOST_AUTO_TEST_CASE(the_failure_of_an_export_is_reported_when_its_space_is_reused)
+{
+    YearByYearExporter exporter(nbSpaces);
+    exporter.add(1, [] { throw std::runtime_error("disk full"); });
+    BOOST_CHECK_NO_THROW(exporter.waitFor(0));
+    BOOST_CHECK_THROW(exporter.waitFor(1), std::runtime_error);
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE parallel ts generation
+#define WIN32_LEAN_AND_MEAN
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/logs/logs.h>
+#include <antares/solver/ts-generator/generator.h>
+#include <antares/solver/ts-generator/prepro.h>
+
+#include "in-memory-study.h"
+
+namespace fs = std::filesystem;
+using namespace Antares::TSGenerator;
+
+namespace
+{
+// Outage parameters giving outages all year long
+void fillOutages(Data::PreproAvailability& prepro)
+{
+    prepro.reset();
+    auto& data = prepro.data;
+    data.fillColumn(Data::PreproAvailability::foDuration, 3.);
+    data.fillColumn(Data::PreproAvailability::poDuration, 14.);
+    data.fillColumn(Data::PreproAvailability::foRate, 0.05);
+    data.fillColumn(Data::PreproAvailability::poRate, 0.1);
+    data.fillColumn(Data::PreproAvailability::npoMax, 10.);
+}
+
+std::string contentOf(const fs::path& file)
+{
+    std::ifstream in(file);
+    std::ostringstream content;
+    content << in.rdbuf();
+    return content.str();
+}
+
+// Messages written in the logs while it is alive
+struct LogsCollector
+{
+    LogsCollector()
+    {
+        messages().clear();
+        logs.callback.connect(&onMessage);
+    }
+
+    ~LogsCollector()
+    {
+        logs.callback.clear();
+    }
+
+    static std::vector<std::string>& messages()
+    {
+        static std::vector<std::string> written;
+        return written;
+    }
+
+    static void onMessage(int, const std::string& message)
+    {
+        messages().push_back(message);
+    }
+
+    static bool contains(const std::string& text)
+    {
+        return std::ranges::any_of(messages(),
+                                   [&text](const std::string& message)
+                                   { return message.find(text) != std::string::npos; });
+    }
+};
+
+struct OutputFolders
+{
+    OutputFolders()
+    {
+        fs::remove_all(root);
+    }
+
+    ~OutputFolders()
+    {
+        fs::remove_all(root);
+    }
+
+    const fs::path root = fs::temp_directory_path() / "antares-test-parallel-ts-generation";
+    const fs::path oneThread = root / "1-thread";
+    const fs::path fourThreads = root / "4-threads";
+};
+
+// A study of two areas, having thermal clusters of different sizes
+struct StudyWithOutages: public StudyBuilder
+{
+    StudyWithOutages()
+    {
+        study->parameters.nbTimeSeriesThermal = 20;
+        for (const std::string areaName: {"area 1", "area 2"})
+        {
+            Area* area = addAreaToStudy(areaName);
+            for (unsigned int i = 0; i != 3; ++i)
+            {
+                auto cluster = addClusterToArea(area, "cluster " + std::to_string(i));
+                ThermalClusterConfig(cluster.get())
+                  .setNominalCapacity(100. * (i + 1))
+                  .setUnitCount(5 + i);
+                fillOutages(*cluster->prepro);
+                clusters.push_back(cluster.get());
+            }
+        }
+    }
+
+    std::vector<ThermalCluster*> clusters;
+};
+
+LinkTSgenerationParams makeLink(const std::string& from, const std::string& to)
+{
+    LinkTSgenerationParams link;
+    link.namesPair = {from, to};
+    link.unitCount = 4;
+    link.nominalCapacity = 250.;
+    link.prepro = std::make_unique<Data::PreproAvailability>(from + "/" + to, link.unitCount);
+    fillOutages(*link.prepro);
+    link.modulationCapacityDirect.reset(1, HOURS_PER_YEAR);
+    link.modulationCapacityDirect.fill(1.);
+    link.modulationCapacityIndirect.reset(1, HOURS_PER_YEAR);
+    link.modulationCapacityIndirect.fill(0.5);
+    return link;
+}
+
+std::vector<LinkTSgenerationParams> makeLinks()
+{
+    std::vector<LinkTSgenerationParams> links;
+    links.push_back(makeLink("a", "b"));
+    links.push_back(makeLink("a", "c"));
+    links.push_back(makeLink("b", "c"));
+    links.push_back(makeLink("c", "d"));
+    return links;
+}
+
+StudyParamsForLinkTS linkParams()
+{
+    StudyParamsForLinkTS params;
+    params.nbLinkTStoGenerate = 20;
+    params.seed = 12345;
+    return params;
+}
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(thermal_clusters, OutputFolders)
+
+BOOST_AUTO_TEST_CASE(series_do_not_depend_on_the_number_of_threads)
+{
+    StudyWithOutages builder;
+
+    BOOST_REQUIRE(generateThermalTimeSeriesInParallel(*builder.study,
+                                                      builder.clusters,
+                                                      42,
+                                                      1,
+                                                      oneThread));
+    std::vector<Matrix<>> seriesWithOneThread;
+    for (auto* cluster: builder.clusters)
+    {
+        seriesWithOneThread.emplace_back().copyFrom(cluster->series.timeSeries);
+    }
+
+    BOOST_REQUIRE(generateThermalTimeSeriesInParallel(*builder.study,
+                                                      builder.clusters,
+                                                      42,
+                                                      4,
+                                                      fourThreads));
+
+    for (unsigned int i = 0; i != builder.clusters.size(); ++i)
+    {
+        const auto* cluster = builder.clusters[i];
+        const auto& series = cluster->series.timeSeries;
+        BOOST_REQUIRE_EQUAL(series.width, 20);
+        BOOST_REQUIRE_EQUAL(series.height, HOURS_PER_YEAR);
+        for (unsigned int ts = 0; ts != series.width; ++ts)
+        {
+            BOOST_CHECK_EQUAL_COLLECTIONS(series[ts],
+                                          series[ts] + series.height,
+                                          seriesWithOneThread[i][ts],
+                                          seriesWithOneThread[i][ts] + series.height);
+        }
+
+        auto file = fs::path(cluster->parentArea->id.to<std::string>())
+                    / (cluster->id() + ".txt");
+        BOOST_CHECK(!contentOf(oneThread / file).empty());
+        BOOST_CHECK_EQUAL(contentOf(oneThread / file), contentOf(fourThreads / file));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_FIXTURE_TEST_SUITE(links, OutputFolders)
+
+BOOST_AUTO_TEST_CASE(series_do_not_depend_on_the_number_of_threads)
+{
+    auto links = makeLinks();
+
+    BOOST_REQUIRE(generateLinkTimeSeriesInParallel(links, linkParams(), 1, oneThread));
+    BOOST_REQUIRE(generateLinkTimeSeriesInParallel(links, linkParams(), 4, fourThreads));
+
+    for (const auto& link: links)
+    {
+        for (const std::string suffix: {"_direct.txt", "_indirect.txt"})
+        {
+            auto file = fs::path(link.namesPair.first) / (link.namesPair.second + suffix);
+            BOOST_CHECK(!contentOf(oneThread / file).empty());
+            BOOST_CHECK_EQUAL(contentOf(oneThread / file), contentOf(fourThreads / file));
+        }
+    }
+    // The links do not share their series
+    BOOST_CHECK_NE(contentOf(oneThread / "a" / "b_direct.txt"),
+                   contentOf(oneThread / "a" / "c_direct.txt"));
+}
+
+BOOST_AUTO_TEST_CASE(links_without_generation___series_of_the_other_links_unchanged)
+{
+    auto links = makeLinks();
+    BOOST_REQUIRE(generateLinkTimeSeriesInParallel(links, linkParams(), 2, oneThread));
+
+    links[0].forceNoGeneration = true;
+    links[2].forceNoGeneration = true;
+    BOOST_REQUIRE(generateLinkTimeSeriesInParallel(links, linkParams(), 2, fourThreads));
+
+    BOOST_CHECK(!fs::exists(fourThreads / "a" / "b_direct.txt"));
+    BOOST_CHECK(!fs::exists(fourThreads / "b" / "c_direct.txt"));
+    for (const fs::path file: {fs::path("a") / "c_direct.txt", fs::path("c") / "d_indirect.txt"})
+    {
+        BOOST_CHECK_EQUAL(contentOf(oneThread / file), contentOf(fourThreads / file));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(invalid_links___all_of_them_reported_and_nothing_generated)
+{
+    auto links = makeLinks();
+    links[1].hasValidData = false;
+    links[3].hasValidData = false;
+
+    LogsCollector collector;
+    BOOST_CHECK(!generateLinkTimeSeriesInParallel(links, linkParams(), 2, oneThread));
+
+    BOOST_CHECK(collector.contains("Missing data for link a/c"));
+    BOOST_CHECK(collector.contains("Missing data for link c/d"));
+    BOOST_CHECK(!collector.contains("a/b"));
+    BOOST_CHECK(!fs::exists(oneThread));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
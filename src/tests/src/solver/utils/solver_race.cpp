@@ -0,0 +1,183 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE test solver racing
+
+#define WIN32_LEAN_AND_MEAN
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <antares/optimization-options/options.h>
+#include <antares/solver/utils/basis_status.h>
+#include <antares/solver/utils/named_problem.h>
+#include <antares/solver/utils/ortools_utils.h>
+
+using namespace Antares::Optimization;
+
+// SCIP supports the interruptions, as a linear and as a mixed integer solver
+static const std::string solverName = "scip";
+
+// min x, s.t. x >= 0.5, 0 <= x <= 1
+struct Fixture
+{
+    Fixture():
+        problem(variableNames, constraintNames, integerVariables, basisStatus, false, false)
+    {
+        problem.NombreDeVariables = 1;
+        problem.CoutLineaire = cost.data();
+        problem.Xmin = xmin.data();
+        problem.Xmax = xmax.data();
+        problem.TypeDeVariable = variableType.data();
+        problem.X = x.data();
+        problem.CoutsReduits = reducedCosts.data();
+
+        problem.NombreDeContraintes = 1;
+        problem.IndicesDebutDeLigne = rowStart.data();
+        problem.NombreDeTermesDesLignes = rowTermCount.data();
+        problem.IndicesColonnes = columns.data();
+        problem.CoefficientsDeLaMatriceDesContraintes = coefficients.data();
+        problem.Sens = sense.data();
+        problem.SecondMembre = rhs.data();
+        problem.CoutsMarginauxDesContraintes = duals.data();
+
+        options.ortoolsUsed = true;
+        options.ortoolsSolver = solverName;
+        mainSolver.reset(MPSolverFactory(&problem, solverName));
+    }
+
+    std::vector<std::string> variableNames{"x"};
+    std::vector<std::string> constraintNames{"c"};
+    std::vector<bool> integerVariables{false};
+    BasisStatus basisStatus;
+
+    std::vector<double> cost{1.};
+    std::vector<double> xmin{0.};
+    std::vector<double> xmax{1.};
+    std::vector<int> variableType{VARIABLE_BORNEE_DES_DEUX_COTES};
+    std::vector<double> x{-1.};
+    std::vector<double> reducedCosts{0.};
+    std::vector<int> rowStart{0};
+    std::vector<int> rowTermCount{1};
+    std::vector<int> columns{0};
+    std::vector<double> coefficients{1.};
+    std::vector<char> sense{'>'};
+    std::vector<double> rhs{0.5};
+    std::vector<double> duals{0.};
+
+    PROBLEME_SIMPLEXE_NOMME problem;
+    Antares::Solver::Optimization::OptimizationOptions options;
+    // Never solved here, only interrupted by the challenger
+    std::unique_ptr<MPSolver> mainSolver;
+    Yuni::Job::QueueService queue;
+};
+
+BOOST_AUTO_TEST_CASE(only_the_solvers_supporting_interruptions_can_race)
+{
+    BOOST_CHECK(ortoolsSolverSupportsInterruption("scip"));
+    BOOST_CHECK(!ortoolsSolverSupportsInterruption("sirius"));
+}
+
+BOOST_FIXTURE_TEST_CASE(challenger_rescues_a_failed_main_resolution, Fixture)
+{
+    queue.maximumThreadCount(1);
+    queue.start();
+
+    SolverRace race(solverName, problem, options);
+    race.start(mainSolver.get(), queue);
+    // The race is settled once the challenger is done, if it started
+    while (!race.challengerStarted())
+    {
+        std::this_thread::yield();
+    }
+
+    problem.ExistenceDUneSolution = NON_SPX;
+    BOOST_CHECK(race.finish(problem));
+    BOOST_CHECK_EQUAL(problem.ExistenceDUneSolution, OUI_SPX);
+    BOOST_CHECK_CLOSE(x[0], 0.5, 1e-6);
+
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(challenger_not_started_is_cancelled, Fixture)
+{
+    // The queue is not started yet: the challenger can not start before the race is settled
+    SolverRace race(solverName, problem, options);
+    race.start(mainSolver.get(), queue);
+
+    problem.ExistenceDUneSolution = NON_SPX;
+    BOOST_CHECK(!race.finish(problem));
+    BOOST_CHECK(!race.challengerStarted());
+    BOOST_CHECK_EQUAL(problem.ExistenceDUneSolution, NON_SPX);
+
+    // The cancelled challenger returns without solving
+    queue.start();
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+    BOOST_CHECK(!race.challengerStarted());
+    BOOST_CHECK_EQUAL(x[0], -1.);
+}
+
+BOOST_FIXTURE_TEST_CASE(challenger_is_cancelled_when_the_race_is_destroyed, Fixture)
+{
+    {
+        SolverRace race(solverName, problem, options);
+        race.start(mainSolver.get(), queue);
+    }
+
+    // The task of the challenger outlives the race
+    queue.start();
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+    BOOST_CHECK_EQUAL(x[0], -1.);
+}
+
+BOOST_FIXTURE_TEST_CASE(main_solver_is_only_interrupted_while_solving, Fixture)
+{
+    // The main solver of the weekly problems is reused from a resolution to the next
+    ProblemSimplexeNommeConverter converter(solverName, &problem);
+    mainSolver.reset(converter.Convert());
+    queue.maximumThreadCount(1);
+    queue.start();
+
+    {
+        SolverRace race(solverName, problem, options);
+        race.start(mainSolver.get(), queue);
+        while (!race.challengerStarted())
+        {
+            std::this_thread::yield();
+        }
+        // The challenger wins while the main solver has not started solving
+        problem.ExistenceDUneSolution = NON_SPX;
+        BOOST_CHECK(race.finish(problem));
+    }
+    queue.wait(Yuni::qseIdle);
+    queue.stop();
+
+    x[0] = -1.;
+    problem.ExistenceDUneSolution = NON_SPX;
+    ORTOOLS_Simplexe(&problem, mainSolver.get(), false, options);
+    BOOST_CHECK_EQUAL(problem.ExistenceDUneSolution, OUI_SPX);
+    BOOST_CHECK_CLOSE(x[0], 0.5, 1e-6);
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE aggregation
+#define WIN32_LEAN_AND_MEAN
+
+#include <cmath>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/variable/storage/aggregation.h"
+
+using namespace Antares::Solver::Variable;
+
+namespace
+{
+constexpr uint blockSize = 24;
+constexpr double untouched = -12345.;
+
+// Values whose sum depends on the order of the additions
+std::vector<double> hourlyValues(uint count)
+{
+    std::vector<double> values(count);
+    for (uint i = 0; i != count; ++i)
+    {
+        values[i] = (i % 3 == 0) ? 1e16 : std::sin(i) * (i % 7 + 1);
+    }
+    return values;
+}
+
+double plainSum(const double* values, uint count)
+{
+    double sum = 0.;
+    for (uint i = 0; i != count; ++i)
+    {
+        sum += values[i];
+    }
+    return sum;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(sum_per_block___same_as_a_plain_loop_whatever_the_number_of_blocks)
+{
+    // Multiple of the number of lanes or not, less than one set of lanes
+    for (uint nbBlocks: {0u, 1u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 365u})
+    {
+        auto values = hourlyValues(nbBlocks * blockSize);
+        std::vector<double> sums(nbBlocks + 1, untouched);
+
+        Aggregation::sumPerBlock<blockSize>(values.data(), nbBlocks, sums.data());
+
+        for (uint b = 0; b != nbBlocks; ++b)
+        {
+            BOOST_CHECK_EQUAL(sums[b], plainSum(values.data() + b * blockSize, blockSize));
+        }
+        BOOST_CHECK_EQUAL(sums[nbBlocks], untouched);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sum_per_block__range_not_starting_on_day_0___only_its_days_are_written)
+{
+    const uint firstDay = 3;
+    const uint nbDays = 10;
+    auto values = hourlyValues(365 * blockSize);
+    std::vector<double> sums(365, untouched);
+
+    Aggregation::sumPerBlock<blockSize>(values.data() + firstDay * blockSize,
+                                        nbDays,
+                                        sums.data() + firstDay);
+
+    for (uint d = 0; d != sums.size(); ++d)
+    {
+        if (d < firstDay || d >= firstDay + nbDays)
+        {
+            BOOST_CHECK_EQUAL(sums[d], untouched);
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL(sums[d], plainSum(values.data() + d * blockSize, blockSize));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(any_positive_per_block___value_only_for_blocks_with_a_positive_value)
+{
+    // Positive values at the first, inner and last hour of a block, and blocks with zeros or
+    // negative values only
+    const uint nbBlocks = 7;
+    std::vector<double> values(nbBlocks * blockSize, 0.);
+    values[0 * blockSize] = 1.;
+    values[1 * blockSize + 10] = 1e-12;
+    values[2 * blockSize + blockSize - 1] = 3.;
+    std::fill(values.begin() + 3 * blockSize, values.begin() + 4 * blockSize, -1.);
+    values[6 * blockSize + blockSize - 1] = 2.;
+    std::vector<double> flags(nbBlocks + 1, untouched);
+
+    Aggregation::anyPositivePerBlock<blockSize>(values.data(), nbBlocks, 100., flags.data());
+
+    std::vector<double> expected = {100., 100., 100., 0., 0., 0., 100., untouched};
+    BOOST_CHECK_EQUAL_COLLECTIONS(flags.begin(), flags.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(
+  any_positive_per_block__range_not_starting_on_day_0___only_its_days_are_written)
+{
+    const uint firstDay = 2;
+    std::vector<double> values(6 * blockSize, 1.);
+    values[3 * blockSize + 5] = 0.;
+    std::fill(values.begin() + 4 * blockSize, values.begin() + 5 * blockSize, 0.);
+    std::vector<double> flags(6, untouched);
+
+    Aggregation::anyPositivePerBlock<blockSize>(values.data() + firstDay * blockSize,
+                                                3,
+                                                0.5,
+                                                flags.data() + firstDay);
+
+    std::vector<double> expected = {untouched, untouched, 0.5, 0.5, 0., untouched};
+    BOOST_CHECK_EQUAL_COLLECTIONS(flags.begin(), flags.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(sum_of_range___same_as_a_plain_loop_on_the_range)
+{
+    auto values = hourlyValues(40);
+    BOOST_CHECK_EQUAL(Aggregation::sumOfRange(values.data(), 5, 5), 0.);
+    BOOST_CHECK_EQUAL(Aggregation::sumOfRange(values.data(), 0, 40), plainSum(values.data(), 40));
+    BOOST_CHECK_EQUAL(Aggregation::sumOfRange(values.data(), 3, 31),
+                      plainSum(values.data() + 3, 28));
+}
+
+BOOST_AUTO_TEST_CASE(any_positive_in_range___only_the_values_of_the_range_count)
+{
+    std::vector<double> values = {1., 0., -2., 0., 3.};
+    BOOST_CHECK(!Aggregation::anyPositiveInRange(values.data(), 1, 4));
+    BOOST_CHECK(!Aggregation::anyPositiveInRange(values.data(), 2, 2));
+    BOOST_CHECK(Aggregation::anyPositiveInRange(values.data(), 0, 1));
+    BOOST_CHECK(Aggregation::anyPositiveInRange(values.data(), 2, 5));
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2007-2024, RTE (https://www.rte-france.com)
+ * See AUTHORS.txt
+ * SPDX-License-Identifier: MPL-2.0
+ * This file is part of Antares-Simulator,
+ * Adequacy and Performance assessment for interconnected energy networks.
+ *
+ * Antares_Simulator is free software: you can redistribute it and/or modify
+ * it under the terms of the Mozilla Public Licence 2.0 as published by
+ * the Mozilla Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Antares_Simulator is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * Mozilla Public Licence 2.0 for more details.
+ *
+ * You should have received a copy of the Mozilla Public Licence 2.0
+ * along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
+ */
+#define BOOST_TEST_MODULE optimal units on
+#define WIN32_LEAN_AND_MEAN
+
+#include <algorithm>
+#include <random>
+
+#include <boost/test/unit_test.hpp>
+
+#include "antares/solver/variable/state.h"
+
+using namespace Antares::Solver::Variable;
+
+using Hours = std::array<uint, HOURS_PER_YEAR>;
+
+namespace
+{
+// The look-ahead visiting every hour, without skipping any block
+Hours referenceOptimalNbClustersON(uint maxDurationON,
+                                   const Hours& ON_min,
+                                   const Hours& ON_max,
+                                   uint begin,
+                                   uint end)
+{
+    Hours ON_opt;
+    ON_opt[begin] = ON_min[begin];
+    uint h = begin + 1;
+    while (h < end)
+    {
+        if (ON_min[h] >= ON_opt[h - 1])
+        {
+            ON_opt[h] = ON_min[h];
+            ++h;
+            continue;
+        }
+        uint portee = 0;
+        uint nivmin = ON_min[h];
+        uint nivmax = std::min(ON_max[h], ON_opt[h - 1]);
+        if (nivmax > nivmin)
+        {
+            for (uint k = 1; k <= maxDurationON && h + k < end; ++k)
+            {
+                if (ON_max[h + k] <= ON_min[h])
+                {
+                    break;
+                }
+                if (ON_max[h + k] < nivmax)
+                {
+                    nivmax = ON_max[h + k];
+                    if (nivmax < nivmin)
+                    {
+                        break;
+                    }
+                }
+                if (ON_min[h + k] > ON_min[h])
+                {
+                    if (ON_min[h + k] >= nivmax)
+                    {
+                        nivmin = nivmax;
+                        portee = k;
+                        break;
+                    }
+                    else if (ON_min[h + k] >= nivmin)
+                    {
+                        portee = k;
+                        nivmin = ON_min[h + k];
+                    }
+                }
+            }
+        }
+        if (portee == 0)
+        {
+            ON_opt[h] = ON_min[h];
+            ++h;
+        }
+        else
+        {
+            std::fill(ON_opt.begin() + h, ON_opt.begin() + h + portee, nivmin);
+            h += portee;
+        }
+    }
+    return ON_opt;
+}
+
+void checkSameAsReference(uint maxDurationON,
+                          const Hours& ON_min,
+                          const Hours& ON_max,
+                          uint begin,
+                          uint end)
+{
+    auto expected = referenceOptimalNbClustersON(maxDurationON, ON_min, ON_max, begin, end);
+    auto actual = computeEconomicallyOptimalNbClustersON(maxDurationON, ON_min, ON_max, begin, end);
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin() + begin,
+                                  actual.begin() + end,
+                                  expected.begin() + begin,
+                                  expected.begin() + end);
+}
+
+// ON_min <= ON_max, both changing at the given hours only
+void fillSteps(Hours& ON_min, Hours& ON_max, const std::vector<uint>& changes, std::mt19937& rng)
+{
+    std::uniform_int_distribution<uint> level(0, 10);
+    uint low = 0;
+    uint high = 0;
+    for (uint h = 0; h < HOURS_PER_YEAR; ++h)
+    {
+        if (h == 0 || std::ranges::find(changes, h) != changes.end())
+        {
+            low = level(rng);
+            high = low + level(rng);
+        }
+        ON_min[h] = low;
+        ON_max[h] = high;
+    }
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(bounds_varying_inside_blocks___same_as_the_look_ahead_without_skipping)
+{
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<uint> level(0, 10);
+    Hours ON_min;
+    Hours ON_max;
+    for (uint h = 0; h < HOURS_PER_YEAR; ++h)
+    {
+        ON_min[h] = level(rng);
+        ON_max[h] = ON_min[h] + level(rng);
+    }
+    for (uint duration: {1u, 5u, 63u, 64u, 65u, 200u, HOURS_PER_YEAR})
+    {
+        checkSameAsReference(duration, ON_min, ON_max, 0, HOURS_PER_YEAR);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(
+  bounds_changing_around_block_boundaries___same_as_the_look_ahead_without_skipping)
+{
+    // Steps one hour before, at and one hour after the boundaries of the blocks of 64 hours, and
+    // a few inside them
+    std::vector<uint> changes;
+    for (uint boundary = 64; boundary < HOURS_PER_YEAR; boundary += 64 * 3)
+    {
+        changes.insert(changes.end(), {boundary - 1, boundary, boundary + 1, boundary + 30});
+    }
+    std::mt19937 rng(2);
+    for (uint draw = 0; draw < 20; ++draw)
+    {
+        Hours ON_min;
+        Hours ON_max;
+        fillSteps(ON_min, ON_max, changes, rng);
+        for (uint duration: {1u, 63u, 64u, 127u, 128u, 500u, HOURS_PER_YEAR})
+        {
+            checkSameAsReference(duration, ON_min, ON_max, 0, HOURS_PER_YEAR);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(seasonal_step_down_profile___same_as_the_look_ahead_without_skipping)
+{
+    // Long plateaus, where whole blocks are skipped, with single hours dropping inside them
+    Hours ON_min;
+    Hours ON_max;
+    for (uint h = 0; h < HOURS_PER_YEAR; ++h)
+    {
+        ON_max[h] = 20 - h / 1000;
+        ON_min[h] = (h % 24 < 8) ? 2 : 12 - h / 1000;
+    }
+    ON_max[1000] = 3;
+    ON_max[2047] = 5;
+    ON_min[3071] = 15;
+    ON_max[3071] = 17;
+    for (uint duration: {10u, 64u, 1000u, HOURS_PER_YEAR})
+    {
+        checkSameAsReference(duration, ON_min, ON_max, 0, HOURS_PER_YEAR);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(
+  simulation_range_not_on_block_boundaries___same_as_the_look_ahead_without_skipping)
+{
+    std::mt19937 rng(3);
+    std::vector<uint> changes;
+    for (uint h = 100; h < HOURS_PER_YEAR; h += 97)
+    {
+        changes.push_back(h);
+    }
+    Hours ON_min;
+    Hours ON_max;
+    fillSteps(ON_min, ON_max, changes, rng);
+    for (auto [begin, end]: {std::pair{0u, 24u * 7},
+                             std::pair{10u, 700u},
+                             std::pair{63u, 129u},
+                             std::pair{168u * 3, 168u * 10 + 5},
+                             std::pair{5000u, HOURS_PER_YEAR}})
+    {
+        for (uint duration: {1u, 64u, 300u, HOURS_PER_YEAR})
+        {
+            checkSameAsReference(duration, ON_min, ON_max, begin, end);
+        }
+    }
+}
@@ -25,6 +25,7 @@ private:
     std::string linksFromCmdLineOptions_;
     fs::path studyFolder_;
     bool generateTSforAllLinks_ = false;
+    bool parallel_ = false;
     std::vector<LinkTSgenerationParams> linkList_;
     StudyParamsForLinkTS generalParams_;
 };
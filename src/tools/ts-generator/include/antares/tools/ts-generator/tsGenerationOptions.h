@@ -20,6 +20,9 @@ struct Settings
     bool allLinks = false;
     /// generate TS for a list "area.link;area2.link2;"
     std::string linksListToGen;
+
+    /// generate the elements in parallel, with a random numbers generator per element
+    bool parallel = false;
 };
 
 bool parseOptions(int, const char*[], Settings&);
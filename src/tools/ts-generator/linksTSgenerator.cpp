@@ -1,4 +1,7 @@
 
+#include <algorithm>
+#include <thread>
+
 #include "antares/tools/ts-generator/linksTSgenerator.h"
 
 #include "antares/utils/utils.h"
@@ -59,6 +62,7 @@ bool readLinkGeneralProperty(StudyParamsForLinkTS& params,
             return false;
         }
         params.random.reset(seed);
+        params.seed = seed;
         return true;
     }
     return true;
@@ -239,7 +243,8 @@ void readPreproTimeSeries(std::vector<LinkTSgenerationParams>& linkList, fs::pat
 LinksTSgenerator::LinksTSgenerator(Settings& settings):
     linksFromCmdLineOptions_(settings.linksListToGen),
     studyFolder_(settings.studyFolder),
-    generateTSforAllLinks_(settings.allLinks)
+    generateTSforAllLinks_(settings.allLinks),
+    parallel_(settings.parallel)
 {
 }
 
@@ -341,6 +346,13 @@ bool LinksTSgenerator::generate()
     saveTSpath /= "ts-generator";
     saveTSpath /= "links";
 
+    if (parallel_)
+    {
+        return generateLinkTimeSeriesInParallel(linkList_,
+                                                generalParams_,
+                                                std::max(std::thread::hardware_concurrency(), 1u),
+                                                saveTSpath);
+    }
     return generateLinkTimeSeries(linkList_, generalParams_, saveTSpath);
 }
 
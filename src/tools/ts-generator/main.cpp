@@ -18,9 +18,11 @@
 ** You should have received a copy of the Mozilla Public Licence 2.0
 ** along with Antares_Simulator. If not, see <https://opensource.org/license/mpl-2-0/>.
 */
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <thread>
 
 #include <antares/logs/logs.h>
 #include <antares/solver/ts-generator/generator.h>
@@ -102,17 +104,31 @@ int main(int argc, const char* argv[])
             clusters = getClustersToGen(study->areas, settings.thermalListToGen);
         }
 
-        // === TS generation ===
-        MersenneTwister thermalRandom;
-        thermalRandom.reset(study->parameters.seed[Data::seedTsGenThermal]);
-        return_code = TSGenerator::generateThermalTimeSeries(*study, clusters, thermalRandom);
-
-        // === Writing generated TS on disk ===
         auto thermalSavePath = fs::path(settings.studyFolder) / "output"
                                / FormattedTime("%Y%m%d-%H%M");
         thermalSavePath /= "ts-generator";
         thermalSavePath /= "thermal";
-        writeThermalTimeSeries(clusters, thermalSavePath);
+
+        if (settings.parallel)
+        {
+            // === TS generation and writing on disk, cluster by cluster ===
+            return_code = generateThermalTimeSeriesInParallel(
+              *study,
+              clusters,
+              study->parameters.seed[Data::seedTsGenThermal],
+              std::max(std::thread::hardware_concurrency(), 1u),
+              thermalSavePath);
+        }
+        else
+        {
+            // === TS generation ===
+            MersenneTwister thermalRandom;
+            thermalRandom.reset(study->parameters.seed[Data::seedTsGenThermal]);
+            return_code = TSGenerator::generateThermalTimeSeries(*study, clusters, thermalRandom);
+
+            // === Writing generated TS on disk ===
+            writeThermalTimeSeries(clusters, thermalSavePath);
+        }
     }
 
     if (linkTSrequired(settings))
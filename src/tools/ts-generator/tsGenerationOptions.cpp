@@ -27,6 +27,12 @@ std::unique_ptr<Yuni::GetOpt::Parser> createTsGeneratorParser(Settings& settings
                     "Generate TS capacities for a list of 2 area IDs, "
                     "usage: --links=\"areaID.area2ID;area3ID.area1ID\"");
 
+    parser->addFlag(settings.parallel,
+                    ' ',
+                    "parallel",
+                    "Generate the clusters and the links in parallel, each one with its own "
+                    "random numbers generator (the TS differ from a sequential generation)");
+
     parser->remainingArguments(settings.studyFolder);
 
     return parser;